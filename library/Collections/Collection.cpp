@@ -33,6 +33,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <Collections/Collection.h>
+#include <LibUtilities/BasicUtils/Thread.h>
+#include <LocalRegions/Expansion.h>
 #include <sstream>
 
 using namespace std;
@@ -40,16 +42,237 @@ using namespace std;
 namespace Nektar {
 namespace Collections {
 
+/**
+ * @brief Applies an operator to one block of the elements of a collection.
+ */
+class CollectionJob : public Thread::ThreadJob
+{
+    public:
+        CollectionJob(
+                OperatorSharedPtr                   op,
+                int                                 dir,
+                const Array<OneD, const NekDouble> &input,
+                const Array<OneD,       NekDouble> &output0,
+                const Array<OneD,       NekDouble> &output1,
+                const Array<OneD,       NekDouble> &output2)
+            : m_op(op), m_dir(dir), m_input(input), m_output0(output0),
+              m_output1(output1), m_output2(output2)
+        {
+        }
+
+        virtual void Run()
+        {
+            // Workspace is allocated here so that it is local to the
+            // worker thread.
+            Array<OneD, NekDouble> wsp(m_op->GetWspSize());
+
+            if (m_dir < 0)
+            {
+                (*m_op)(m_input, m_output0, m_output1, m_output2, wsp);
+            }
+            else
+            {
+                (*m_op)(m_dir, m_input, m_output0, wsp);
+            }
+        }
+
+    private:
+        OperatorSharedPtr            m_op;
+        int                          m_dir;
+        Array<OneD, const NekDouble> m_input;
+        Array<OneD,       NekDouble> m_output0;
+        Array<OneD,       NekDouble> m_output1;
+        Array<OneD,       NekDouble> m_output2;
+};
+
+/**
+ * @brief Gathers the coalesced geometric data of one block of elements.
+ *
+ * This is run on the worker threads so that the storage is first touched,
+ * and hence placed in memory, by the thread that will later operate on it.
+ */
+class CollectionGeomJob : public Thread::ThreadJob
+{
+    public:
+        CollectionGeomJob(
+                CoalescedGeomDataSharedPtr                 geomData,
+                vector<StdRegions::StdExpansionSharedPtr> &collExp,
+                bool jac, bool jacStdWeights, bool derivFactors)
+            : m_geomData(geomData), m_collExp(collExp), m_jac(jac),
+              m_jacStdWeights(jacStdWeights), m_derivFactors(derivFactors)
+        {
+        }
+
+        virtual void Run()
+        {
+            if (m_jac)
+            {
+                m_geomData->GetJac(m_collExp);
+            }
+            if (m_jacStdWeights)
+            {
+                m_geomData->GetJacWithStdWeights(m_collExp);
+            }
+            if (m_derivFactors)
+            {
+                m_geomData->GetDerivFactors(m_collExp);
+            }
+        }
+
+    private:
+        CoalescedGeomDataSharedPtr                 m_geomData;
+        vector<StdRegions::StdExpansionSharedPtr> &m_collExp;
+        bool                                       m_jac;
+        bool                                       m_jacStdWeights;
+        bool                                       m_derivFactors;
+};
+
+/**
+ * @brief Returns @p in offset by @p offset, or @p in itself if it is empty.
+ */
+static inline Array<OneD, NekDouble> OffsetArray(
+        const Array<OneD, NekDouble> &in, unsigned int offset)
+{
+    return in.num_elements() > 0 ? in + offset : in;
+}
+
 /**
  *
  */
 Collection::Collection(
         vector<StdRegions::StdExpansionSharedPtr>    pCollExp,
-        OperatorImpMap                              &impTypes)
+        OperatorImpMap                              &impTypes,
+        unsigned int                                 nThreads)
 {
     // Initialise geometry data.
     m_geomData = MemoryManager<CoalescedGeomData>::AllocateSharedPtr();
 
+    m_nCoeffs = pCollExp[0]->GetNcoeffs();
+    m_nPhys   = pCollExp[0]->GetTotPoints();
+
+    unsigned int nBlocks = min(nThreads, (unsigned int)pCollExp.size());
+
+    if (nBlocks < 2)
+    {
+        CreateOperators(pCollExp, impTypes, m_geomData, m_ops);
+        return;
+    }
+
+    // Determine which coalesced geometric data the operators will request.
+    // Anything missed here is still gathered on construction of the
+    // operator, but on the master thread.
+    auto impType = [&impTypes](OperatorType op)
+    {
+        auto it = impTypes.find(op);
+        return it == impTypes.end() ? eNoCollection : it->second;
+    };
+
+    ImplementationType iprod = impType(eIProductWRTBase);
+    ImplementationType iderv = impType(eIProductWRTDerivBase);
+    ImplementationType deriv = impType(ePhysDeriv);
+
+    bool jac           = iprod == eStdMat || iderv == eStdMat ||
+                         iderv == eIterPerExp;
+    bool jacStdWeights = iprod == eIterPerExp || iprod == eSumFac ||
+                         iderv == eSumFac;
+    bool derivFactors  = iderv != eNoCollection || deriv != eNoCollection;
+
+    // Operators without a collection implementation fall back to the
+    // LocalRegions routines of each element, which fill lazily built caches
+    // (geometric factors, elemental matrices) without locking. These are
+    // therefore applied serially over all the elements.
+    OperatorImpMap blockImpTypes, serialImpTypes;
+    for (auto &it : impTypes)
+    {
+        if (it.second == eNoCollection)
+        {
+            serialImpTypes[it.first] = it.second;
+        }
+        else
+        {
+            blockImpTypes[it.first] = it.second;
+        }
+    }
+    CreateOperators(pCollExp, serialImpTypes, m_geomData, m_ops);
+
+    // Regular elements share their geometric factors, whose caches are not
+    // thread safe, so fill them on the master thread first.
+    LibUtilities::PointsKeyVector ptsKeys = pCollExp[0]->GetPointsKeys();
+    for (auto &exp : pCollExp)
+    {
+        LocalRegions::ExpansionSharedPtr lexp =
+            std::dynamic_pointer_cast<LocalRegions::Expansion>(exp);
+
+        if (jac || jacStdWeights)
+        {
+            lexp->GetMetricInfo()->GetJac(ptsKeys);
+        }
+        if (derivFactors)
+        {
+            lexp->GetMetricInfo()->GetDerivFactors(ptsKeys);
+        }
+    }
+
+    // Split the elements into contiguous blocks of near-equal size.
+    vector<vector<StdRegions::StdExpansionSharedPtr> > blockExp(nBlocks);
+    vector<CoalescedGeomDataSharedPtr>                 blockGeom(nBlocks);
+    vector<Thread::ThreadJob *>                        jobs(nBlocks);
+
+    m_blockOffset.resize(nBlocks);
+    m_blockOps.resize(nBlocks);
+
+    unsigned int nElmt = pCollExp.size();
+    for (unsigned int b = 0, offset = 0; b < nBlocks; ++b)
+    {
+        unsigned int nBlockElmt = nElmt / nBlocks + (b < nElmt % nBlocks);
+
+        m_blockOffset[b] = offset;
+        blockExp[b]      = vector<StdRegions::StdExpansionSharedPtr>(
+            pCollExp.begin() + offset,
+            pCollExp.begin() + offset + nBlockElmt);
+        blockGeom[b]     =
+            MemoryManager<CoalescedGeomData>::AllocateSharedPtr();
+        jobs[b]          = new CollectionGeomJob(
+            blockGeom[b], blockExp[b], jac, jacStdWeights, derivFactors);
+
+        offset += nBlockElmt;
+    }
+
+    Thread::ThreadManagerSharedPtr tm = Thread::GetThreadMaster().GetInstance(
+        Thread::ThreadMaster::SessionJob);
+
+    if (tm->IsInitialised() && !tm->InThread())
+    {
+        tm->QueueJobs(jobs);
+        tm->Wait();
+    }
+    else
+    {
+        for (auto &job : jobs)
+        {
+            job->Run();
+            delete job;
+        }
+    }
+
+    // Operator construction may create matrices and bases through the
+    // global managers, so is done on the master thread.
+    for (unsigned int b = 0; b < nBlocks; ++b)
+    {
+        CreateOperators(blockExp[b], blockImpTypes, blockGeom[b],
+                        m_blockOps[b]);
+    }
+}
+
+/**
+ * @brief Create the operators given in @p impTypes for a list of elements.
+ */
+void Collection::CreateOperators(
+        vector<StdRegions::StdExpansionSharedPtr>    &pCollExp,
+        OperatorImpMap                               &impTypes,
+        CoalescedGeomDataSharedPtr                   &geomData,
+        OperatorMap                                  &ops)
+{
     // Loop over all operator types.
     for (int i = 0; i < SIZE_OperatorType; ++i)
     {
@@ -68,12 +291,101 @@ Collection::Collection(
             ASSERTL0(GetOperatorFactory().ModuleExists(opKey),
                  "Requested unknown operator "+ss.str());
 
-            m_ops[opType] = GetOperatorFactory().CreateInstance(
-                                                opKey, pCollExp, m_geomData);
+            ops[opType] = GetOperatorFactory().CreateInstance(
+                                                opKey, pCollExp, geomData);
         }
     }
 }
 
+/**
+ * @brief Update the constant factors, such as the Helmholtz constant, of an
+ * operator.
+ */
+void Collection::UpdateFactors(
+        const OperatorType               &op,
+        const StdRegions::ConstFactorMap &factors)
+{
+    if (IsThreaded(op))
+    {
+        for (auto &ops : m_blockOps)
+        {
+            ops[op]->UpdateFactors(factors);
+        }
+    }
+    else
+    {
+        m_ops[op]->UpdateFactors(factors);
+    }
 }
+
+/**
+ * @brief Apply an operator with each block of elements handled by a separate
+ * worker thread.
+ *
+ * A negative @p dir denotes the operator form without a direction.
+ */
+void Collection::ApplyThreaded(
+        const OperatorType                 &op,
+              int                           dir,
+        const Array<OneD, const NekDouble> &inarray,
+              Array<OneD,       NekDouble> &output0,
+              Array<OneD,       NekDouble> &output1,
+              Array<OneD,       NekDouble> &output2)
+{
+    // Determine whether each argument is in coefficient or physical space.
+    // For IProductWRTDerivBase the inputs occupy all but the last of the
+    // given arrays, which holds the output coefficients.
+    bool inCoeff     = op == eBwdTrans || op == eHelmholtz;
+    bool outCoeff[3] = {op == eIProductWRTBase || op == eHelmholtz,
+                        false, false};
+
+    if (op == eIProductWRTDerivBase)
+    {
+        if (output2.num_elements() > 0)
+        {
+            outCoeff[2] = true;
+        }
+        else if (output1.num_elements() > 0)
+        {
+            outCoeff[1] = true;
+        }
+        else
+        {
+            outCoeff[0] = true;
+        }
+    }
+
+    Thread::ThreadManagerSharedPtr tm = Thread::GetThreadMaster().GetInstance(
+        Thread::ThreadMaster::SessionJob);
+    bool serial = !tm->IsInitialised() || tm->InThread();
+
+    vector<Thread::ThreadJob *> jobs(m_blockOps.size());
+
+    for (int b = 0; b < m_blockOps.size(); ++b)
+    {
+        unsigned int offCoeff = m_blockOffset[b] * m_nCoeffs;
+        unsigned int offPhys  = m_blockOffset[b] * m_nPhys;
+
+        jobs[b] = new CollectionJob(
+            m_blockOps[b][op], dir,
+            inarray + (inCoeff ? offCoeff : offPhys),
+            OffsetArray(output0, outCoeff[0] ? offCoeff : offPhys),
+            OffsetArray(output1, outCoeff[1] ? offCoeff : offPhys),
+            OffsetArray(output2, outCoeff[2] ? offCoeff : offPhys));
+
+        if (serial)
+        {
+            jobs[b]->Run();
+            delete jobs[b];
+        }
+    }
+
+    if (!serial)
+    {
+        tm->QueueJobs(jobs);
+        tm->Wait();
+    }
 }
 
+}
+}
@@ -56,7 +56,8 @@ class Collection
 
         COLLECTIONS_EXPORT Collection(
                 std::vector<StdRegions::StdExpansionSharedPtr>  pCollExp,
-                OperatorImpMap                                 &impTypes);
+                OperatorImpMap                                 &impTypes,
+                unsigned int                                    nThreads = 1);
 
         inline void ApplyOperator(
                 const OperatorType                           &op,
@@ -84,12 +85,44 @@ class Collection
 
         inline bool HasOperator(const OperatorType &op);
 
+        COLLECTIONS_EXPORT void UpdateFactors(
+                const OperatorType                           &op,
+                const StdRegions::ConstFactorMap             &factors);
+
     protected:
+        typedef std::unordered_map<OperatorType, OperatorSharedPtr, EnumHash>
+            OperatorMap;
+
         StdRegions::StdExpansionSharedPtr                             m_stdExp;
         std::vector<SpatialDomains::GeometrySharedPtr>                m_geom;
-        std::unordered_map<OperatorType, OperatorSharedPtr, EnumHash> m_ops;
+        OperatorMap                                                   m_ops;
         CoalescedGeomDataSharedPtr                                    m_geomData;
 
+        /// Operators for each block of elements when split across threads.
+        /// Operators without a collection implementation are kept in #m_ops.
+        std::vector<OperatorMap>                                      m_blockOps;
+        /// Offset of the first element of each block.
+        std::vector<unsigned int>                                     m_blockOffset;
+        /// Number of coefficients per element.
+        unsigned int                                                  m_nCoeffs;
+        /// Number of quadrature points per element.
+        unsigned int                                                  m_nPhys;
+
+        COLLECTIONS_EXPORT static void CreateOperators(
+                std::vector<StdRegions::StdExpansionSharedPtr> &pCollExp,
+                OperatorImpMap                                 &impTypes,
+                CoalescedGeomDataSharedPtr                     &geomData,
+                OperatorMap                                    &ops);
+
+        inline bool IsThreaded(const OperatorType &op);
+
+        COLLECTIONS_EXPORT void ApplyThreaded(
+                const OperatorType                           &op,
+                      int                                     dir,
+                const Array<OneD, const NekDouble>           &inarray,
+                      Array<OneD,       NekDouble>           &output0,
+                      Array<OneD,       NekDouble>           &output1,
+                      Array<OneD,       NekDouble>           &output2);
 };
 
 typedef std::vector<Collection> CollectionVector;
@@ -104,6 +137,13 @@ inline void Collection::ApplyOperator(
         const Array<OneD, const NekDouble> &inarray,
               Array<OneD,       NekDouble> &output)
 {
+    if (IsThreaded(op))
+    {
+        ApplyThreaded(op, -1, inarray, output, NullNekDouble1DArray,
+                      NullNekDouble1DArray);
+        return;
+    }
+
     Array<OneD, NekDouble> wsp(m_ops[op]->GetWspSize());
     (*m_ops[op])(inarray, output, NullNekDouble1DArray,
                  NullNekDouble1DArray, wsp);
@@ -119,6 +159,13 @@ inline void Collection::ApplyOperator(
               Array<OneD,       NekDouble> &output0,
               Array<OneD,       NekDouble> &output1)
 {
+    if (IsThreaded(op))
+    {
+        ApplyThreaded(op, -1, inarray, output0, output1,
+                      NullNekDouble1DArray);
+        return;
+    }
+
     Array<OneD, NekDouble> wsp(m_ops[op]->GetWspSize());
     (*m_ops[op])(inarray, output0, output1, NullNekDouble1DArray, wsp);
 }
@@ -134,6 +181,12 @@ inline void Collection::ApplyOperator(
               Array<OneD,       NekDouble> &output1,
               Array<OneD,       NekDouble> &output2)
 {
+    if (IsThreaded(op))
+    {
+        ApplyThreaded(op, -1, inarray, output0, output1, output2);
+        return;
+    }
+
     Array<OneD, NekDouble> wsp(m_ops[op]->GetWspSize());
     (*m_ops[op])(inarray, output0, output1, output2, wsp);
 }
@@ -147,13 +200,29 @@ inline void Collection::ApplyOperator(
         const Array<OneD, const NekDouble> &inarray,
               Array<OneD,       NekDouble> &output)
 {
+    if (IsThreaded(op))
+    {
+        ApplyThreaded(op, dir, inarray, output, NullNekDouble1DArray,
+                      NullNekDouble1DArray);
+        return;
+    }
+
     Array<OneD, NekDouble> wsp(m_ops[op]->GetWspSize());
     (*m_ops[op])(dir, inarray, output, wsp);
 }
 
 inline bool Collection::HasOperator(const OperatorType &op)
 {
-    return (m_ops.find(op) != m_ops.end());
+    return IsThreaded(op) || m_ops.find(op) != m_ops.end();
+}
+
+/**
+ * @brief Whether the operator @p op is split across worker threads.
+ */
+inline bool Collection::IsThreaded(const OperatorType &op)
+{
+    return m_blockOps.size() > 0 &&
+           m_blockOps[0].find(op) != m_blockOps[0].end();
 }
 
 }
@@ -34,9 +34,15 @@
 
 #include <boost/core/ignore_unused.hpp>
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/algorithm/string/trim.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <thread>
 
 #include <Collections/CollectionOptimisation.h>
 #include <LibUtilities/BasicUtils/ParseUtils.h>
+#include <LibUtilities/BasicUtils/Thread.h>
 #include <LibUtilities/BasicUtils/Timer.h>
 
 using namespace std;
@@ -48,6 +54,8 @@ namespace Collections
 
 // static manager for Operator ImplementationMap
 map<OpImpTimingKey,OperatorImpMap> CollectionOptimisation::m_opImpMap;
+map<string, OperatorImpMap>        CollectionOptimisation::m_impCache;
+set<string>                        CollectionOptimisation::m_readCaches;
 
 CollectionOptimisation::CollectionOptimisation(
         LibUtilities::SessionReaderSharedPtr pSession,
@@ -62,6 +70,9 @@ CollectionOptimisation::CollectionOptimisation(
     m_setByXml    = false;
     m_autotune    = false;
     m_maxCollSize = 0;
+    m_numThreads  = 1;
+    m_writeCache  = (pSession.get()) &&
+                    (pSession->GetComm()->GetRank() == 0);
     m_defaultType = defaultType == eNoImpType ? eIterPerExp : defaultType;
 
     map<string, LibUtilities::ShapeType> elTypes;
@@ -137,6 +148,34 @@ CollectionOptimisation::CollectionOptimisation(
             const char *maxSize = xmlCol->Attribute("MAXSIZE");
             m_maxCollSize = (maxSize ? atoi(maxSize) : 0);
 
+            // Set the number of threads each collection is split across
+            // and start the worker threads if this has not been done.
+            const char *numThreads = xmlCol->Attribute("NUMTHREADS");
+            m_numThreads = (numThreads ? atoi(numThreads) : 1);
+            ASSERTL0(m_numThreads > 0, "NUMTHREADS must be positive.");
+
+            if (m_numThreads > 1)
+            {
+                Thread::ThreadMaster &tms = Thread::GetThreadMaster();
+                if (!tms.GetInstance(Thread::ThreadMaster::SessionJob)
+                         ->IsInitialised())
+                {
+                    tms.SetThreadingType("ThreadManagerBoost");
+                    tms.CreateInstance(Thread::ThreadMaster::SessionJob,
+                                       m_numThreads);
+                }
+
+                if (verbose)
+                {
+                    cout << "Collections split across " << m_numThreads
+                         << " threads" << endl;
+                }
+            }
+
+            // File in which autotuning results are kept between runs.
+            const char *cacheFile = xmlCol->Attribute("CACHE");
+            m_cacheFile = (cacheFile ? string(cacheFile) : "");
+
             const char *defaultImpl = xmlCol->Attribute("DEFAULT");
             m_defaultType = defaultType;
 
@@ -311,6 +350,16 @@ OperatorImpMap  CollectionOptimisation::GetOperatorImpMap(
             impType = it2->second;
         }
 
+        // Not every operator provides every implementation (e.g. Helmholtz
+        // has no StdMat variant), so fall back to the LocalRegions
+        // implementation where the requested one does not exist.
+        OperatorKey opKey(pExp->DetShapeType(), it.first, impType,
+                          pExp->IsNodalNonTensorialExp());
+        if (!GetOperatorFactory().ModuleExists(opKey))
+        {
+            impType = eNoCollection;
+        }
+
         ret[it.first] = impType;
     }
 
@@ -463,5 +512,328 @@ OperatorImpMap CollectionOptimisation::SetWithTimings(
     return ret;
 }
 
+/**
+ * @brief Determine the implementation of each operator for a set of
+ * collections, consistently across all processes of @p comm.
+ *
+ * Results are looked up in the autotuning cache, which is read from the
+ * file given by the CACHE attribute of the COLLECTIONS element. Each
+ * collection key missing from the cache is timed once only, on the lowest
+ * rank which holds such a collection, and the choice is shared with every
+ * other rank. New results are written back to the cache file by the root
+ * process. This must be called collectively on @p comm.
+ */
+vector<OperatorImpMap> CollectionOptimisation::SetWithTimings(
+        LibUtilities::CommSharedPtr                           comm,
+        vector<vector<StdRegions::StdExpansionSharedPtr> > &pCollExp,
+        bool                                                  verbose)
+{
+    const int rank  = comm->GetRank();
+    const int nProc = comm->GetSize();
+    const int nOps  = SIZE_OperatorType;
+
+    if (rank == 0 || m_writeCache)
+    {
+        ReadCache();
+    }
+
+    // Determine the key of each collection, and the first collection
+    // holding each distinct key.
+    vector<string>   keys(pCollExp.size());
+    map<string, int> localKeys;
+    for (int i = 0; i < pCollExp.size(); ++i)
+    {
+        keys[i] = GetTimingKey(pCollExp[i]);
+        localKeys.insert(make_pair(keys[i], i));
+    }
+
+    // Gather the keys of all processes, so that every process knows the
+    // full list of keys and the lowest rank holding each one.
+    string sendStr = "\n";
+    for (auto &it : localKeys)
+    {
+        sendStr += it.first + "\n";
+    }
+
+    vector<char>     sendBuf(sendStr.begin(), sendStr.end());
+    vector<char>     recvBuf = sendBuf;
+    Array<OneD, int> sizes  (nProc, 0);
+    Array<OneD, int> offsets(nProc, 0);
+
+    sizes[rank] = sendBuf.size();
+    if (nProc > 1)
+    {
+        comm->AllReduce(sizes, LibUtilities::ReduceSum);
+        for (int p = 1; p < nProc; ++p)
+        {
+            offsets[p] = offsets[p-1] + sizes[p-1];
+        }
+
+        recvBuf.resize(offsets[nProc-1] + sizes[nProc-1]);
+        comm->AllGatherv(sendBuf, recvBuf, sizes, offsets);
+    }
+
+    map<string, int> owner;
+    for (int p = 0; p < nProc; ++p)
+    {
+        stringstream keyStream(string(&recvBuf[offsets[p]], sizes[p]));
+        string key;
+        while (getline(keyStream, key))
+        {
+            if (!key.empty())
+            {
+                owner.insert(make_pair(key, p));
+            }
+        }
+    }
+
+    // Share the cached results. A key is only taken from the cache if all
+    // operators are present, so that new operators are tuned.
+    Array<OneD, int> imps(owner.size() * nOps, 0);
+    int n = 0;
+    for (auto &it : owner)
+    {
+        auto cached = m_impCache.find(it.first);
+        if (cached != m_impCache.end() && cached->second.size() == nOps)
+        {
+            for (auto &op : cached->second)
+            {
+                imps[n*nOps + op.first] = op.second;
+            }
+        }
+        ++n;
+    }
+    comm->AllReduce(imps, LibUtilities::ReduceMax);
+
+    // Time the remaining keys on their owning process.
+    bool tuned = false;
+    n = 0;
+    for (auto &it : owner)
+    {
+        bool missing = false;
+        for (int i = 0; i < nOps; ++i)
+        {
+            missing = missing || imps[n*nOps + i] == eNoImpType;
+        }
+
+        if (missing)
+        {
+            tuned = true;
+            Vmath::Zero(nOps, &imps[n*nOps], 1);
+
+            if (it.second == rank)
+            {
+                OperatorImpMap impTypes;
+                impTypes = SetWithTimings(pCollExp[localKeys[it.first]],
+                                          impTypes, verbose);
+                for (auto &op : impTypes)
+                {
+                    imps[n*nOps + op.first] = op.second;
+                }
+            }
+            else if (verbose)
+            {
+                cout << "Collection Implementation for " << it.first
+                     << " timed on process " << it.second << endl;
+            }
+        }
+        ++n;
+    }
+
+    if (tuned)
+    {
+        comm->AllReduce(imps, LibUtilities::ReduceMax);
+    }
+
+    n = 0;
+    for (auto &it : owner)
+    {
+        OperatorImpMap &impTypes = m_impCache[it.first];
+        for (int i = 0; i < nOps; ++i)
+        {
+            impTypes[(OperatorType)i] = (ImplementationType)imps[n*nOps + i];
+        }
+        ++n;
+    }
+
+    if (tuned)
+    {
+        WriteCache();
+    }
+
+    vector<OperatorImpMap> ret(pCollExp.size());
+    for (int i = 0; i < pCollExp.size(); ++i)
+    {
+        ret[i] = m_impCache[keys[i]];
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Key of a collection in the autotuning cache.
+ *
+ * The key consists of the shape, the basis keys, the collection size and
+ * the signature of the host CPU. As in OpImpTimingKey, collections of 100
+ * or more elements are considered to be of the same size.
+ */
+string CollectionOptimisation::GetTimingKey(
+        vector<StdRegions::StdExpansionSharedPtr> &pCollExp)
+{
+    StdRegions::StdExpansionSharedPtr pExp = pCollExp[0];
+
+    stringstream key;
+    key << LibUtilities::ShapeTypeMap[pExp->DetShapeType()];
+    if (pExp->IsNodalNonTensorialExp())
+    {
+        key << " Nodal";
+    }
+
+    for (int i = 0; i < pExp->GetNumBases(); ++i)
+    {
+        const LibUtilities::BasisKey &bkey = pExp->GetBasis(i)->GetBasisKey();
+        key << " " << LibUtilities::BasisTypeMap[bkey.GetBasisType()]
+            << ":" << bkey.GetNumModes()
+            << ":" << LibUtilities::kPointsTypeStr[bkey.GetPointsType()]
+            << ":" << bkey.GetNumPoints();
+    }
+
+    key << " " << min((int)pCollExp.size(), 100) << " " << GetCPUSignature();
+
+    return key.str();
+}
+
+/**
+ * @brief Signature of the host CPU, given by its model name and the number
+ * of hardware threads.
+ */
+string CollectionOptimisation::GetCPUSignature()
+{
+    static string signature;
+
+    if (signature.empty())
+    {
+        string model = "unknown";
+        string line;
+        ifstream cpuinfo("/proc/cpuinfo");
+        while (getline(cpuinfo, line))
+        {
+            if (boost::starts_with(line, "model name"))
+            {
+                model = line.substr(line.find(':') + 1);
+                boost::trim(model);
+                break;
+            }
+        }
+
+        stringstream s;
+        s << "(" << model << " x" << std::thread::hardware_concurrency()
+          << ")";
+        signature = s.str();
+    }
+
+    return signature;
+}
+
+/**
+ * @brief Read the autotuning cache file, if it exists.
+ */
+void CollectionOptimisation::ReadCache()
+{
+    if (m_cacheFile.empty() || m_readCaches.count(m_cacheFile))
+    {
+        return;
+    }
+    m_readCaches.insert(m_cacheFile);
+
+    TiXmlDocument doc(m_cacheFile.c_str());
+    if (!doc.LoadFile())
+    {
+        return;
+    }
+
+    TiXmlElement *cache = doc.FirstChildElement("COLLECTIONCACHE");
+    if (!cache)
+    {
+        return;
+    }
+
+    map<string, OperatorType> opTypes;
+    for (int i = 0; i < SIZE_OperatorType; ++i)
+    {
+        opTypes[OperatorTypeMap[i]] = (OperatorType)i;
+    }
+
+    map<string, ImplementationType> impTypes;
+    for (int i = 0; i < SIZE_ImplementationType; ++i)
+    {
+        impTypes[ImplementationTypeMap[i]] = (ImplementationType)i;
+    }
+
+    TiXmlElement *entry = cache->FirstChildElement("ENTRY");
+    while (entry)
+    {
+        const char *key = entry->Attribute("KEY");
+        if (key && m_impCache.count(key) == 0)
+        {
+            OperatorImpMap &imp = m_impCache[key];
+
+            TiXmlElement *op = entry->FirstChildElement("OPERATOR");
+            while (op)
+            {
+                const char *opType  = op->Attribute("TYPE");
+                const char *impType = op->Attribute("IMPTYPE");
+
+                // Silently skip operators unknown to this version.
+                if (opType && impType && opTypes.count(opType) &&
+                    impTypes.count(impType))
+                {
+                    imp[opTypes[opType]] = impTypes[impType];
+                }
+                op = op->NextSiblingElement("OPERATOR");
+            }
+        }
+        entry = entry->NextSiblingElement("ENTRY");
+    }
+}
+
+/**
+ * @brief Write all autotuning results, including those of other CPUs read
+ * from the cache, to the cache file.
+ */
+void CollectionOptimisation::WriteCache()
+{
+    if (m_cacheFile.empty() || !m_writeCache)
+    {
+        return;
+    }
+
+    TiXmlDocument doc;
+    doc.LinkEndChild(new TiXmlDeclaration("1.0", "utf-8", ""));
+
+    TiXmlElement *cache = new TiXmlElement("COLLECTIONCACHE");
+    for (auto &entry : m_impCache)
+    {
+        TiXmlElement *e = new TiXmlElement("ENTRY");
+        e->SetAttribute("KEY", entry.first.c_str());
+
+        for (auto &op : entry.second)
+        {
+            TiXmlElement *o = new TiXmlElement("OPERATOR");
+            o->SetAttribute("TYPE",    OperatorTypeMap[op.first]);
+            o->SetAttribute("IMPTYPE", ImplementationTypeMap[op.second]);
+            e->LinkEndChild(o);
+        }
+        cache->LinkEndChild(e);
+    }
+    doc.LinkEndChild(cache);
+
+    if (!doc.SaveFile(m_cacheFile.c_str()))
+    {
+        NEKERROR(ErrorUtil::ewarning,
+                 "Unable to write collection cache file " + m_cacheFile);
+    }
+}
+
 }
 }
@@ -40,6 +40,9 @@
 #include <LibUtilities/BasicUtils/SessionReader.h>
 #include <tinyxml.h>
 
+#include <set>
+#include <string>
+
 namespace Nektar
 {
 namespace Collections
@@ -135,6 +138,11 @@ class CollectionOptimisation
             return m_autotune;
         }
 
+        unsigned int GetNumThreads()
+        {
+            return m_numThreads;
+        }
+
         /// Get Operator Implementation Map from XMl or using default;
         COLLECTIONS_EXPORT OperatorImpMap  GetOperatorImpMap(
                 StdRegions::StdExpansionSharedPtr pExp);
@@ -145,6 +153,18 @@ class CollectionOptimisation
                 OperatorImpMap &impTypes,
                 bool verbose = true);
 
+        // Get Maps for a set of collections by autotuning across a
+        // communicator, using and updating the on-disk cache.
+        COLLECTIONS_EXPORT std::vector<OperatorImpMap> SetWithTimings(
+                LibUtilities::CommSharedPtr comm,
+                std::vector<std::vector<StdRegions::StdExpansionSharedPtr> >
+                    &pCollExp,
+                bool verbose = true);
+
+        /// Key identifying a collection in the autotuning cache.
+        COLLECTIONS_EXPORT static std::string GetTimingKey(
+                std::vector<StdRegions::StdExpansionSharedPtr> &pCollExp);
+
         bool SetByXml(void)
         {
             return m_setByXml;
@@ -154,11 +174,22 @@ class CollectionOptimisation
         typedef std::pair<LibUtilities::ShapeType, int> ElmtOrder;
 
         static std::map<OpImpTimingKey,OperatorImpMap> m_opImpMap;
+        /// Autotuned maps keyed by GetTimingKey, shared with the cache file.
+        static std::map<std::string, OperatorImpMap> m_impCache;
+        /// Cache files which have already been read.
+        static std::set<std::string> m_readCaches;
         std::map<OperatorType, std::map<ElmtOrder, ImplementationType> > m_global;
         bool m_setByXml;
         bool m_autotune;
         ImplementationType m_defaultType;
         unsigned int m_maxCollSize;
+        unsigned int m_numThreads;
+        std::string m_cacheFile;
+        bool m_writeCache;
+
+        static std::string GetCPUSignature();
+        void ReadCache();
+        void WriteCache();
 };
 
 }
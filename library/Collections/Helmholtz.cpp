@@ -0,0 +1,314 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: Helmholtz.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Helmholtz operator implementations
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <boost/core/ignore_unused.hpp>
+
+#include <Collections/Operator.h>
+#include <Collections/Collection.h>
+
+using namespace std;
+
+namespace Nektar {
+namespace Collections {
+
+using LibUtilities::eSegment;
+using LibUtilities::eQuadrilateral;
+using LibUtilities::eTriangle;
+using LibUtilities::eHexahedron;
+using LibUtilities::eTetrahedron;
+using LibUtilities::ePrism;
+using LibUtilities::ePyramid;
+
+/**
+ * @brief Helmholtz operator using original LocalRegions implementation.
+ */
+class Helmholtz_NoCollection : public Operator
+{
+    public:
+        OPERATOR_CREATE(Helmholtz_NoCollection)
+
+        virtual ~Helmholtz_NoCollection()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output0,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(output1, output2, wsp);
+
+            const int nCoeffs = m_expList[0]->GetNcoeffs();
+            Array<OneD, NekDouble> tmp;
+
+            for (int i = 0; i < m_numElmt; ++i)
+            {
+                StdRegions::StdMatrixKey mkey(StdRegions::eHelmholtz,
+                                              m_expList[i]->DetShapeType(),
+                                              *m_expList[i], m_factors);
+
+                m_expList[i]->GeneralMatrixOp(input + i*nCoeffs,
+                                              tmp = output0 + i*nCoeffs,
+                                              mkey);
+            }
+        }
+
+        virtual void operator()(
+                      int                           dir,
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(dir, input, output, wsp);
+            NEKERROR(ErrorUtil::efatal, "Not valid for this operator.");
+        }
+
+        virtual void UpdateFactors(const StdRegions::ConstFactorMap &factors)
+        {
+            m_factors = factors;
+        }
+
+    protected:
+        vector<StdRegions::StdExpansionSharedPtr> m_expList;
+        StdRegions::ConstFactorMap                m_factors;
+
+    private:
+        Helmholtz_NoCollection(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Operator(pCollExp, pGeomData)
+        {
+            m_expList = pCollExp;
+            m_factors[StdRegions::eFactorLambda] = 0.0;
+        }
+};
+
+/// Factory initialisation for the Helmholtz_NoCollection operators
+OperatorKey Helmholtz_NoCollection::m_typeArr[] =
+{
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       eHelmholtz, eNoCollection,false),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eHelmholtz, eNoCollection,false),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eHelmholtz, eNoCollection,true),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eHelmholtz, eNoCollection,false),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eHelmholtz, eNoCollection,false),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eHelmholtz, eNoCollection,true),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       eHelmholtz, eNoCollection,false),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eHelmholtz, eNoCollection,false),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eHelmholtz, eNoCollection,true),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eHelmholtz, eNoCollection,false),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_Hex")
+};
+
+
+/**
+ * @brief Matrix-free Helmholtz operator using sum-factorisation.
+ *
+ * The operator \f$ (\nabla \phi_i, \nabla u) + \lambda (\phi_i, u) \f$ is
+ * evaluated by composing the sum-factorisation BwdTrans, PhysDeriv,
+ * IProductWRTDerivBase and IProductWRTBase operators of the same shape, so
+ * that no elemental matrices are stored. The coalesced geometric data is
+ * shared between these operators.
+ */
+class Helmholtz_SumFac : public Operator
+{
+    public:
+        OPERATOR_CREATE(Helmholtz_SumFac)
+
+        virtual ~Helmholtz_SumFac()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output0,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(output1, output2);
+
+            const int nPhys   = m_numElmt * m_stdExp->GetTotPoints();
+            const int nCoeffs = m_numElmt * m_stdExp->GetNcoeffs();
+
+            Array<OneD, NekDouble> phys = wsp;
+            Array<OneD, Array<OneD, NekDouble> > deriv(3);
+            for (int i = 0; i < 3; ++i)
+            {
+                deriv[i] = i < m_coordim ? wsp + (i + 1) * nPhys
+                                         : NullNekDouble1DArray;
+            }
+            Array<OneD, NekDouble> coeffs = wsp + (m_coordim + 1) * nPhys;
+            Array<OneD, NekDouble> opWsp  = coeffs + nCoeffs;
+
+            // Backward transform and take the gradient.
+            (*m_bwdTrans)(input, phys, NullNekDouble1DArray,
+                          NullNekDouble1DArray, opWsp);
+            (*m_physDeriv)(phys, deriv[0], deriv[1], deriv[2], opWsp);
+
+            // Laplacian term: the output of IProductWRTDerivBase follows the
+            // coordim input components.
+            switch (m_coordim)
+            {
+                case 1:
+                    (*m_iprodDeriv)(deriv[0], output0, NullNekDouble1DArray,
+                                    NullNekDouble1DArray, opWsp);
+                    break;
+                case 2:
+                    (*m_iprodDeriv)(deriv[0], deriv[1], output0,
+                                    NullNekDouble1DArray, opWsp);
+                    break;
+                case 3:
+                    (*m_iprodDeriv)(deriv[0], deriv[1], deriv[2], output0,
+                                    opWsp);
+                    break;
+                default:
+                    ASSERTL0(false, "Unknown dimension.");
+            }
+
+            // Mass term.
+            if (m_lambda != 0.0)
+            {
+                Vmath::Smul(nPhys, m_lambda, phys, 1, phys, 1);
+                (*m_iprod)(phys, coeffs, NullNekDouble1DArray,
+                           NullNekDouble1DArray, opWsp);
+                Vmath::Vadd(nCoeffs, coeffs, 1, output0, 1, output0, 1);
+            }
+        }
+
+        virtual void operator()(
+                      int                           dir,
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(dir, input, output, wsp);
+            NEKERROR(ErrorUtil::efatal, "Not valid for this operator.");
+        }
+
+        virtual void UpdateFactors(const StdRegions::ConstFactorMap &factors)
+        {
+            auto x = factors.find(StdRegions::eFactorLambda);
+            m_lambda = x == factors.end() ? 0.0 : x->second;
+        }
+
+    protected:
+        OperatorSharedPtr m_bwdTrans;
+        OperatorSharedPtr m_physDeriv;
+        OperatorSharedPtr m_iprod;
+        OperatorSharedPtr m_iprodDeriv;
+        int               m_coordim;
+        NekDouble         m_lambda;
+
+    private:
+        Helmholtz_SumFac(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Operator(pCollExp, pGeomData),
+              m_coordim(pCollExp[0]->GetCoordim()),
+              m_lambda(0.0)
+        {
+            LibUtilities::ShapeType shape = pCollExp[0]->DetShapeType();
+
+            m_bwdTrans   = GetOperatorFactory().CreateInstance(
+                OperatorKey(shape, eBwdTrans, eSumFac, false),
+                pCollExp, pGeomData);
+            m_physDeriv  = GetOperatorFactory().CreateInstance(
+                OperatorKey(shape, ePhysDeriv, eSumFac, false),
+                pCollExp, pGeomData);
+            m_iprod      = GetOperatorFactory().CreateInstance(
+                OperatorKey(shape, eIProductWRTBase, eSumFac, false),
+                pCollExp, pGeomData);
+            m_iprodDeriv = GetOperatorFactory().CreateInstance(
+                OperatorKey(shape, eIProductWRTDerivBase, eSumFac, false),
+                pCollExp, pGeomData);
+
+            int nPhys   = m_numElmt * m_stdExp->GetTotPoints();
+            int nCoeffs = m_numElmt * m_stdExp->GetNcoeffs();
+
+            m_wspSize = (m_coordim + 1) * nPhys + nCoeffs +
+                max(max(m_bwdTrans->GetWspSize(), m_physDeriv->GetWspSize()),
+                    max(m_iprod->GetWspSize(), m_iprodDeriv->GetWspSize()));
+        }
+};
+
+/// Factory initialisation for the Helmholtz_SumFac operators
+OperatorKey Helmholtz_SumFac::m_typeArr[] =
+{
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       eHelmholtz, eSumFac, false),
+        Helmholtz_SumFac::create, "Helmholtz_SumFac_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eHelmholtz, eSumFac, false),
+        Helmholtz_SumFac::create, "Helmholtz_SumFac_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eHelmholtz, eSumFac, false),
+        Helmholtz_SumFac::create, "Helmholtz_SumFac_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eHelmholtz, eSumFac, false),
+        Helmholtz_SumFac::create, "Helmholtz_SumFac_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       eHelmholtz, eSumFac, false),
+        Helmholtz_SumFac::create, "Helmholtz_SumFac_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eHelmholtz, eSumFac, false),
+        Helmholtz_SumFac::create, "Helmholtz_SumFac_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eHelmholtz, eSumFac, false),
+        Helmholtz_SumFac::create, "Helmholtz_SumFac_Hex")
+};
+
+}
+}
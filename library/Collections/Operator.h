@@ -68,6 +68,7 @@ enum OperatorType
     eIProductWRTBase,
     eIProductWRTDerivBase,
     ePhysDeriv,
+    eHelmholtz,
     SIZE_OperatorType
 };
 
@@ -76,7 +77,8 @@ const char* const OperatorTypeMap[] =
     "BwdTrans",
     "IProductWRTBase",
     "IProductWRTDerivBase",
-    "PhysDeriv"
+    "PhysDeriv",
+    "Helmholtz"
 };
 
 enum ImplementationType
@@ -138,6 +140,14 @@ class Operator
 
         COLLECTIONS_EXPORT virtual ~Operator();
 
+        /// Update the constant factors of the operator, such as the
+        /// Helmholtz constant. Operators without factors ignore this.
+        COLLECTIONS_EXPORT virtual void UpdateFactors(
+                const StdRegions::ConstFactorMap &factors)
+        {
+            boost::ignore_unused(factors);
+        }
+
         /// Get the size of the required workspace
         int GetWspSize()
         {
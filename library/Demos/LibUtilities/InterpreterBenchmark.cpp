@@ -0,0 +1,126 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  File: InterpreterBenchmark.cpp
+//
+//  For more information, please see: http://www.nektar.info/
+//
+//  The MIT License
+//
+//  Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+//  Department of Aeronautics, Imperial College London (UK), and Scientific
+//  Computing and Imaging Institute, University of Utah (USA).
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included
+//  in all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Description: Timing of the stack and fused backends of the Interpreter.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/BasicUtils/Timer.h>
+#include <LibUtilities/BasicUtils/VmathArray.hpp>
+#include <LibUtilities/Interpreter/Interpreter.h>
+
+using namespace std;
+using namespace Nektar;
+
+int main(int argc, char *argv[])
+{
+    if (argc > 3)
+    {
+        fprintf(stderr, "Usage: InterpreterBenchmark [npts] [ntest]\n");
+        exit(1);
+    }
+
+    int npts  = argc > 1 ? atoi(argv[1]) : 100000;
+    int ntest = argc > 2 ? atoi(argv[2]) : 100;
+
+    // Expressions typical of boundary conditions, forcing functions and
+    // initial conditions.
+    vector<string> exprs = {
+        "x + y*z - t",
+        "(1 - y*y)*U0",
+        "sin(PI*x)*cos(PI*y)*exp(-2*PI*PI*nu*t)",
+        "U0*tanh((y - 0.5)/delta)*(1 + eps*sin(2*PI*x/L))",
+        "(x <= 0.5)*(1 - 4*(y - 0.5)^2) + 0.1*sqrt(x*x + z*z)"
+    };
+
+    Array<OneD, NekDouble> x(npts), y(npts), z(npts), t(npts, 0.3);
+    Vmath::FillWhiteNoise(npts, 1.0, x, 1, 1);
+    Vmath::FillWhiteNoise(npts, 1.0, y, 1, 2);
+    Vmath::FillWhiteNoise(npts, 1.0, z, 1, 3);
+
+    LibUtilities::Interpreter interp[2];
+    interp[0].SetBackend(LibUtilities::Interpreter::eStack);
+    interp[1].SetBackend(LibUtilities::Interpreter::eFused);
+
+    for (int b = 0; b < 2; ++b)
+    {
+        interp[b].SetParameter("U0",    1.5);
+        interp[b].SetParameter("nu",    0.01);
+        interp[b].SetParameter("delta", 0.05);
+        interp[b].SetParameter("eps",   0.1);
+        interp[b].SetParameter("L",     2.0);
+    }
+
+    cout << "Interpreter, npts = " << npts << ", ntest = " << ntest << endl;
+    cout << setw(10) << "Stack" << setw(14) << "Fused" << setw(10)
+         << "Speedup" << setw(10) << "Diff" << "  Expression" << endl;
+
+    LibUtilities::Timer timer;
+    int status = 0;
+
+    for (auto &expr : exprs)
+    {
+        Array<OneD, NekDouble> result[2];
+        NekDouble time[2];
+
+        for (int b = 0; b < 2; ++b)
+        {
+            int id    = interp[b].DefineFunction("x y z t", expr);
+            result[b] = Array<OneD, NekDouble>(npts);
+
+            timer.Start();
+            for (int n = 0; n < ntest; ++n)
+            {
+                interp[b].Evaluate(id, x, y, z, t, result[b]);
+            }
+            timer.Stop();
+            time[b] = timer.TimePerTest(ntest);
+        }
+
+        // The backends must give identical results.
+        Vmath::Vsub(npts, result[1], 1, result[0], 1, result[0], 1);
+        NekDouble diff = Vmath::Vamax(npts, result[0], 1);
+        status = status || diff != 0.0;
+
+        cout << setw(10) << time[0] << setw(14) << time[1] << setw(10)
+             << time[0] / time[1] << setw(10) << diff << "  " << expr
+             << endl;
+    }
+
+    return status;
+}
@@ -0,0 +1,178 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: PointLocation.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Compares locating points one at a time with GetExpIndex
+// against the batched GetExpIndices, in time and in result.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/BasicUtils/Timer.h>
+#include <MultiRegions/ExpList1D.h>
+#include <MultiRegions/ExpList2D.h>
+#include <MultiRegions/ExpList3D.h>
+#include <SpatialDomains/MeshGraph.h>
+
+using namespace std;
+using namespace Nektar;
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        cerr << "Usage: PointLocation session.xml" << endl;
+        cerr << "Locates the quadrature points of the mesh, in random order,"
+             << endl
+             << "with GetExpIndex and GetExpIndices. Set the parameter"
+             << endl
+             << "PointLocatorNumThreads to thread GetExpIndices." << endl;
+        return 1;
+    }
+
+    LibUtilities::SessionReaderSharedPtr vSession
+            = LibUtilities::SessionReader::CreateInstance(argc, argv);
+    SpatialDomains::MeshGraphSharedPtr graph =
+            SpatialDomains::MeshGraph::Read(vSession);
+
+    MultiRegions::ExpListSharedPtr exp;
+    switch (graph->GetMeshDimension())
+    {
+        case 1:
+            exp = MemoryManager<MultiRegions::ExpList1D>::AllocateSharedPtr(
+                vSession, graph);
+            break;
+        case 2:
+            exp = MemoryManager<MultiRegions::ExpList2D>::AllocateSharedPtr(
+                vSession, graph);
+            break;
+        case 3:
+            exp = MemoryManager<MultiRegions::ExpList3D>::AllocateSharedPtr(
+                vSession, graph);
+            break;
+        default:
+            ASSERTL0(false, "Unsupported mesh dimension");
+    }
+
+    // Use the quadrature points of the mesh as query points, shuffled so
+    // that consecutive points are not in the same element.
+    int nq = exp->GetTotPoints();
+    Array<OneD, Array<OneD, NekDouble> > xc(3), pts(3);
+    for (int j = 0; j < 3; ++j)
+    {
+        xc[j]  = Array<OneD, NekDouble>(nq, 0.0);
+        pts[j] = Array<OneD, NekDouble>(nq);
+    }
+    exp->GetCoords(xc[0], xc[1], xc[2]);
+
+    vector<int> perm(nq);
+    for (int i = 0; i < nq; ++i)
+    {
+        perm[i] = i;
+    }
+    shuffle(perm.begin(), perm.end(), mt19937(1));
+    for (int j = 0; j < 3; ++j)
+    {
+        for (int i = 0; i < nq; ++i)
+        {
+            pts[j][i] = xc[j][perm[i]];
+        }
+    }
+
+    cout << "Elements: " << exp->GetExpSize() << ", points: " << nq << endl;
+
+    LibUtilities::Timer timer;
+    NekDouble tol = NekConstants::kGeomFactorsTol;
+
+    // Locate the first point, which builds the search tree of the mesh,
+    // before timing.
+    Array<OneD, NekDouble> coords(3);
+    Array<OneD, NekDouble> locCoords(exp->GetShapeDimension());
+    for (int j = 0; j < 3; ++j)
+    {
+        coords[j] = pts[j][0];
+    }
+    exp->GetExpIndex(coords, locCoords, tol);
+
+    Array<OneD, int> ids(nq);
+    Array<OneD, Array<OneD, NekDouble> > locs(nq);
+    for (int i = 0; i < nq; ++i)
+    {
+        locs[i] = Array<OneD, NekDouble>(exp->GetShapeDimension());
+    }
+
+    timer.Start();
+    for (int i = 0; i < nq; ++i)
+    {
+        for (int j = 0; j < 3; ++j)
+        {
+            coords[j] = pts[j][i];
+        }
+        ids[i] = exp->GetExpIndex(coords, locs[i], tol);
+    }
+    timer.Stop();
+    NekDouble tSingle = timer.TimePerTest(1);
+
+    Array<OneD, int> batchIds;
+    Array<OneD, Array<OneD, NekDouble> > batchLocs;
+    timer.Start();
+    exp->GetExpIndices(pts, batchIds, batchLocs, tol);
+    timer.Stop();
+    NekDouble tBatch = timer.TimePerTest(1);
+
+    // GetExpIndices should return exactly the element and local coordinates
+    // found by GetExpIndex, including for the points on element boundaries.
+    int nFound = 0, nMismatch = 0;
+    for (int i = 0; i < nq; ++i)
+    {
+        nFound += ids[i] >= 0;
+
+        bool match = ids[i] == batchIds[i] &&
+                     locs[i].num_elements() == batchLocs[i].num_elements();
+        for (int j = 0; match && j < locs[i].num_elements(); ++j)
+        {
+            match = locs[i][j] == batchLocs[i][j];
+        }
+        nMismatch += !match;
+    }
+
+    cout << "GetExpIndex:   " << tSingle << " s" << endl;
+    cout << "GetExpIndices: " << tBatch  << " s, speed-up: "
+         << tSingle / tBatch << endl;
+    cout << "Points found: " << nFound << endl;
+    cout << "Mismatches: " << nMismatch << endl;
+
+    vSession->Finalise();
+
+    return 0;
+}
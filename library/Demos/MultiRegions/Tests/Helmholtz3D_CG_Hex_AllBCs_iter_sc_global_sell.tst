@@ -0,0 +1,26 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Helmholtz 3D CG, hexes, mixed BCs, iterative SC, SELL storage of the global Schur complement on two threads</description>
+    <executable>Helmholtz3D</executable>
+    <parameters>-I GlobalSysSoln=IterativeStaticCond -I GlobalMatrixStorageType=SmvSELL -P SparseNumThreads=2 Helmholtz3D_Hex_AllBCs_P6.xml Helmholtz3D_Hex_AllBCs_globalop.xml</parameters>
+    <files>
+        <file description="Session File">Helmholtz3D_Hex_AllBCs_P6.xml</file>
+        <file description="Session File">Helmholtz3D_Hex_AllBCs_globalop.xml</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value tolerance="1e-8">0.000416575</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value tolerance="1e-8">0.000871589</value>
+        </metric>
+        <metric type="regex" id="3">
+            <regex>^Global matrix storage type: (\w+)</regex>
+            <matches>
+                <match>
+                    <field id="0">SmvSELL</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
@@ -0,0 +1,19 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Threaded batched point location on a mesh of all 3D element types</description>
+    <executable>PointLocation</executable>
+    <parameters>-P PointLocatorNumThreads=3 CubeAllElements.xml</parameters>
+    <files>
+        <file description="Session File">CubeAllElements.xml</file>
+    </files>
+    <metrics>
+        <metric type="regex" id="1">
+            <regex>^Mismatches: (\d+)</regex>
+            <matches>
+                <match>
+                    <field id="0">0</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
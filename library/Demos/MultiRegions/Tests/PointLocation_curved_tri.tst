@@ -0,0 +1,19 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Batched point location on a curved triangular mesh</description>
+    <executable>PointLocation</executable>
+    <parameters>Helmholtz2D_CG_P7_Modes_curved_tri.xml</parameters>
+    <files>
+        <file description="Session File">Helmholtz2D_CG_P7_Modes_curved_tri.xml</file>
+    </files>
+    <metrics>
+        <metric type="regex" id="1">
+            <regex>^Mismatches: (\d+)</regex>
+            <matches>
+                <match>
+                    <field id="0">0</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
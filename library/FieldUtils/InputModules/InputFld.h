@@ -75,6 +75,11 @@ public:
         return eCreateFieldData;
     }
 
+    virtual bool IsElementLocal()
+    {
+        return true;
+    }
+
 private:
 };
 }
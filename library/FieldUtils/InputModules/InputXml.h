@@ -75,6 +75,11 @@ public:
         return eCreateGraph;
     }
 
+    virtual bool IsElementLocal()
+    {
+        return true;
+    }
+
 private:
 };
 }
@@ -33,6 +33,8 @@
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+
 #include <boost/geometry.hpp>
 #include <FieldUtils/Interpolator.h>
 
@@ -83,7 +85,6 @@ void Interpolator::Interpolate(
     int lastProg = 0;
 
     Array<OneD, NekDouble> Lcoords(nInDim, 0.0);
-    Array<OneD, NekDouble> Scoords(nOutDim, 0.0);
     Array<OneD, Array<OneD, NekDouble> > coords(nOutDim);
     for (int i = 0; i < nOutDim; ++i)
     {
@@ -102,24 +103,21 @@ void Interpolator::Interpolate(
         m_expOutField[0]->GetCoords(coords[0], coords[1], coords[2]);
     }
 
+    // Obtain Elements and LocalCoordinates to interpolate
+    LocatePoints(coords, true);
+
     for (int i = 0; i < nOutPts; ++i)
     {
-        for (int j = 0; j < nOutDim; ++j)
-        {
-            Scoords[j] = coords[j][i];
-        }
-
-        // Obtain Element and LocalCoordinate to interpolate
-        int elmtid = m_expInField[0]->GetExpIndex(Scoords, Lcoords,
-                                                  NekConstants::kGeomFactorsTol,
-                                                  true);
+        int elmtid = m_locElmtIds[i];
 
         // we use kGeomFactorsTol as tolerance, while StdPhysEvaluate has
         // kNekZeroTol hardcoded, so we need to limit Lcoords to not produce
         // a ton of warnings
         for(int j = 0; j < nInDim; ++j)
         {
-            Lcoords[j] = std::max(Lcoords[j], -1.0);
+            NekDouble x = j < m_locCoords[i].num_elements() ?
+                          m_locCoords[i][j] : 0.0;
+            Lcoords[j] = std::max(x, -1.0);
             Lcoords[j] = std::min(Lcoords[j], 1.0);
         }
 
@@ -194,25 +192,32 @@ void Interpolator::Interpolate(
     int nOutPts  = m_ptsOutField->GetNpoints();
     int lastProg = 0;
 
-    for (int i = 0; i < nOutPts; ++i)
+    Array<OneD, Array<OneD, NekDouble> > coords(m_ptsOutField->GetDim());
+    for (int j = 0; j < m_ptsOutField->GetDim(); ++j)
     {
-        Array<OneD, NekDouble> Lcoords(nInDim, 0.0);
-        Array<OneD, NekDouble> coords(m_ptsOutField->GetDim(), 0.0);
-        for (int j = 0; j < m_ptsOutField->GetDim(); ++j)
+        coords[j] = Array<OneD, NekDouble>(nOutPts);
+        for (int i = 0; i < nOutPts; ++i)
         {
-            coords[j] = m_ptsOutField->GetPointVal(j, i);
+            coords[j][i] = m_ptsOutField->GetPointVal(j, i);
         }
+    }
 
-        // Obtain Element and LocalCoordinate to interpolate
-        int elmtid = m_expInField[0]->GetExpIndex(coords, Lcoords,
-                                                  NekConstants::kGeomFactorsTol);
+    // Obtain Elements and LocalCoordinates to interpolate
+    LocatePoints(coords, false);
+
+    Array<OneD, NekDouble> Lcoords(nInDim, 0.0);
+    for (int i = 0; i < nOutPts; ++i)
+    {
+        int elmtid = m_locElmtIds[i];
 
         // we use kGeomFactorsTol as tolerance, while StdPhysEvaluate has
         // kNekZeroTol hardcoded, so we need to limit Lcoords to not produce
         // a ton of warnings
         for(int j = 0; j < nInDim; ++j)
         {
-            Lcoords[j] = std::max(Lcoords[j], -1.0);
+            NekDouble x = j < m_locCoords[i].num_elements() ?
+                          m_locCoords[i][j] : 0.0;
+            Lcoords[j] = std::max(x, -1.0);
             Lcoords[j] = std::min(Lcoords[j], 1.0);
         }
 
@@ -327,6 +332,50 @@ void Interpolator::Interpolate(
     LibUtilities::Interpolator::Interpolate(ptsInField, ptsOutField);
 }
 
+/**
+ * @brief Locate points in the first input expansion
+ *
+ * @param coords            coordinates of the points, as [dim][point]
+ * @param returnNearestElmt use the nearest element for points outside the mesh
+ *
+ * The element and local coordinates of each point are stored in m_locElmtIds
+ * and m_locCoords. They are kept for later calls, and only recomputed if the
+ * input expansion or the points change.
+ */
+void Interpolator::LocatePoints(
+    const Array<OneD, const Array<OneD, NekDouble> > &coords,
+    bool returnNearestElmt)
+{
+    bool cached = m_locExp == m_expInField[0] &&
+                  m_locNearest == returnNearestElmt &&
+                  m_locPts.num_elements() == coords.num_elements();
+
+    for (int j = 0; cached && j < coords.num_elements(); ++j)
+    {
+        cached = m_locPts[j].num_elements() == coords[j].num_elements() &&
+                 std::equal(coords[j].begin(), coords[j].end(),
+                            m_locPts[j].begin());
+    }
+
+    if (cached)
+    {
+        return;
+    }
+
+    m_expInField[0]->GetExpIndices(coords, m_locElmtIds, m_locCoords,
+                                   NekConstants::kGeomFactorsTol,
+                                   returnNearestElmt);
+
+    m_locExp     = m_expInField[0];
+    m_locNearest = returnNearestElmt;
+    m_locPts     = Array<OneD, Array<OneD, NekDouble> >(coords.num_elements());
+    for (int j = 0; j < coords.num_elements(); ++j)
+    {
+        m_locPts[j] = Array<OneD, NekDouble>(coords[j].num_elements());
+        Vmath::Vcopy(coords[j].num_elements(), coords[j], 1, m_locPts[j], 1);
+    }
+}
+
 
 }
 }
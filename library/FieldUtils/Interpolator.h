@@ -72,7 +72,8 @@ public:
                  short int                  coordId   = -1,
                  NekDouble                  filtWidth = 0.0,
                  int                        maxPts    = 1000)
-        : LibUtilities::Interpolator(method, coordId, filtWidth, maxPts)
+        : LibUtilities::Interpolator(method, coordId, filtWidth, maxPts),
+          m_locNearest(false)
     {
     }
 
@@ -103,6 +104,20 @@ protected:
     std::vector<MultiRegions::ExpListSharedPtr> m_expInField;
     /// output field
     std::vector<MultiRegions::ExpListSharedPtr> m_expOutField;
+    /// expansion in which the output points were last located
+    MultiRegions::ExpListSharedPtr m_locExp;
+    /// coordinates of the output points last located
+    Array<OneD, Array<OneD, NekDouble> > m_locPts;
+    /// whether the nearest element was used for points outside the mesh
+    bool m_locNearest;
+    /// element containing each output point
+    Array<OneD, int> m_locElmtIds;
+    /// local coordinates of each output point
+    Array<OneD, Array<OneD, NekDouble> > m_locCoords;
+
+    void LocatePoints(
+        const Array<OneD, const Array<OneD, NekDouble> > &coords,
+        bool returnNearestElmt);
 };
 
 typedef std::shared_ptr<Interpolator> InterpolatorSharedPtr;
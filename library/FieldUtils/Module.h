@@ -195,6 +195,13 @@ public:
 
     virtual ModulePriority GetModulePriority() = 0;
 
+    /// Whether the module only requires the data of each element, so that
+    /// the field can be processed one chunk of elements at a time.
+    virtual bool IsElementLocal()
+    {
+        return false;
+    }
+
     FIELD_UTILS_EXPORT void RegisterConfig(std::string key,
                                            std::string value = "");
     FIELD_UTILS_EXPORT void PrintConfig();
@@ -62,6 +62,11 @@ public:
         return "OutputFld";
     }
 
+    virtual bool IsElementLocal()
+    {
+        return true;
+    }
+
 protected:
     /// Write from pts to output file.
     virtual void OutputFromPts(po::variables_map &vm);
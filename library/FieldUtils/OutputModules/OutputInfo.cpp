@@ -40,6 +40,7 @@ using namespace std;
 #include <boost/format.hpp>
 
 #include <LibUtilities/BasicUtils/FieldIOXml.h>
+#include <LibUtilities/BasicUtils/ParseUtils.h>
 #include <SpatialDomains/MeshPartition.h>
 
 #include "OutputInfo.h"
@@ -118,6 +119,13 @@ void OutputInfo::Process(po::variables_map &vm)
             }
         }
 
+        if (m_f->m_verbose)
+        {
+            cout << "\t" << GetModuleName() << ": " << s
+                 << " holds elements "
+                 << ParseUtils::GenerateSeqString(PartElmtIDs) << endl;
+        }
+
         ElementIDs.push_back(PartElmtIDs);
         filenames.push_back(s);
     }
@@ -78,6 +78,11 @@ public:
         return "OutputTecplot";
     }
 
+    virtual bool IsElementLocal()
+    {
+        return true;
+    }
+
 protected:
     /// Write from pts to output file.
     virtual void OutputFromPts(po::variables_map &vm);
@@ -32,14 +32,17 @@
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <cstdint>
 #include <set>
 #include <string>
 #include <iomanip>
 using namespace std;
 
+#include <boost/algorithm/string.hpp>
 #include <boost/core/ignore_unused.hpp>
 #include <boost/format.hpp>
 
+#include <LibUtilities/BasicUtils/CompressData.h>
 #include <LibUtilities/BasicUtils/FileSystem.h>
 
 #include "OutputVtk.h"
@@ -52,9 +55,19 @@ namespace FieldUtils
 ModuleKey OutputVtk::m_className = GetModuleFactory().RegisterCreatorFunction(
     ModuleKey(eOutputModule, "vtu"), OutputVtk::create, "Writes a VTU file.");
 
-OutputVtk::OutputVtk(FieldSharedPtr f) : OutputFileBase(f)
+// Uncompressed size of the blocks compressed by zlib, as used by VTK.
+static const size_t VtkBlockSize = 32768;
+
+OutputVtk::OutputVtk(FieldSharedPtr f) : OutputFileBase(f),
+                                         m_dataFormat(eAscii),
+                                         m_compress(false)
 {
     m_requireEquiSpaced = true;
+    m_config["format"] = ConfigOption(
+        false, "ascii", "Format of the data arrays: ascii, binary "
+                        "(base64 encoded) or appended (raw binary)");
+    m_config["compress"] = ConfigOption(
+        true, "0", "Compress binary or appended data arrays with zlib");
 }
 
 OutputVtk::~OutputVtk()
@@ -68,9 +81,11 @@ void OutputVtk::OutputFromPts(po::variables_map &vm)
 
     // Extract the output filename and extension
     string filename = PrepareOutput(vm);
+    SetDataFormat();
 
     // Write solution.
-    ofstream outfile(filename.c_str());
+    ofstream outfile(filename.c_str(), m_dataFormat == eAppended ?
+                     ios::out | ios::binary : ios::out);
     WriteVtkHeader(outfile);
     int nfields = 0;
     int dim     = fPts->GetDim();
@@ -120,100 +135,107 @@ void OutputVtk::OutputFromPts(po::variables_map &vm)
             NEKERROR(ErrorUtil::efatal, "ptsType not supported yet.");
     }
 
-    vector<Array<OneD, int> > ptsConn;
-    fPts->GetConnectivity(ptsConn);
-
-    nfields = fPts->GetNFields();
-
-    int nPts      = fPts->GetNpoints();
-    int numBlocks = 0;
-    for (i = 0; i < ptsConn.size(); ++i)
+    if (m_dataFormat != eAscii)
     {
-        numBlocks += ptsConn[i].num_elements() / nvert;
+        WriteVtkPieceFromPts(outfile, nvert, vtktype);
     }
-
-    // write out pieces of data.
-    outfile << "    <Piece NumberOfPoints=\"" << nPts
-            << "\" NumberOfCells=\"" << numBlocks << "\">" << endl;
-    outfile << "      <Points>" << endl;
-    outfile << "        <DataArray type=\"Float64\" "
-            << "NumberOfComponents=\"" << 3 << "\" format=\"ascii\">"
-            << endl;
-    for (i = 0; i < nPts; ++i)
+    else
     {
-        for (j = 0; j < dim; ++j)
+        vector<Array<OneD, int> > ptsConn;
+        fPts->GetConnectivity(ptsConn);
+
+        nfields = fPts->GetNFields();
+
+        int nPts      = fPts->GetNpoints();
+        int numBlocks = 0;
+        for (i = 0; i < ptsConn.size(); ++i)
         {
-            outfile << "          " << setprecision(8) << scientific
-                    << fPts->GetPointVal(j, i) << " ";
+            numBlocks += ptsConn[i].num_elements() / nvert;
         }
-        for (j = dim; j < 3; ++j)
+
+        // write out pieces of data.
+        outfile << "    <Piece NumberOfPoints=\"" << nPts
+                << "\" NumberOfCells=\"" << numBlocks << "\">" << endl;
+        outfile << "      <Points>" << endl;
+        outfile << "        <DataArray type=\"Float64\" "
+                << "NumberOfComponents=\"" << 3 << "\" format=\"ascii\">"
+                << endl;
+        for (i = 0; i < nPts; ++i)
         {
-            // pack to 3D since paraview does not seem to handle 2D
-            outfile << "          0.000000";
+            for (j = 0; j < dim; ++j)
+            {
+                outfile << "          " << setprecision(8) << scientific
+                        << fPts->GetPointVal(j, i) << " ";
+            }
+            for (j = dim; j < 3; ++j)
+            {
+                // pack to 3D since paraview does not seem to handle 2D
+                outfile << "          0.000000";
+            }
+            outfile << endl;
         }
-        outfile << endl;
-    }
-    outfile << "        </DataArray>" << endl;
-    outfile << "      </Points>" << endl;
-    outfile << "      <Cells>" << endl;
-    outfile << "        <DataArray type=\"Int32\" "
-            << "Name=\"connectivity\" format=\"ascii\">" << endl;
+        outfile << "        </DataArray>" << endl;
+        outfile << "      </Points>" << endl;
+        outfile << "      <Cells>" << endl;
+        outfile << "        <DataArray type=\"Int32\" "
+                << "Name=\"connectivity\" format=\"ascii\">" << endl;
 
-    // dump connectivity data if it exists
-    outfile << "          ";
-    int cnt = 1;
-    for (i = 0; i < ptsConn.size(); ++i)
-    {
-        for (j = 0; j < ptsConn[i].num_elements(); ++j)
+        // dump connectivity data if it exists
+        outfile << "          ";
+        int cnt = 1;
+        for (i = 0; i < ptsConn.size(); ++i)
         {
-            outfile << ptsConn[i][j] << " ";
-            if ((!(cnt % nvert)) && cnt)
+            for (j = 0; j < ptsConn[i].num_elements(); ++j)
             {
-                outfile << std::endl;
-                outfile << "          ";
+                outfile << ptsConn[i][j] << " ";
+                if ((!(cnt % nvert)) && cnt)
+                {
+                    outfile << std::endl;
+                    outfile << "          ";
+                }
+                cnt++;
             }
-            cnt++;
         }
-    }
-    outfile << "        </DataArray>" << endl;
-    outfile << "        <DataArray type=\"Int32\" "
-            << "Name=\"offsets\" format=\"ascii\">" << endl;
-
-    outfile << "          ";
-    for (i = 0; i < numBlocks; ++i)
-    {
-        outfile << i * nvert + nvert << " ";
-    }
-    outfile << endl;
-    outfile << "        </DataArray>" << endl;
-    outfile << "        <DataArray type=\"UInt8\" "
-            << "Name=\"types\" format=\"ascii\">" << endl;
-    outfile << "          ";
-    for (i = 0; i < numBlocks; ++i)
-    {
-        outfile << vtktype << " ";
-    }
-    outfile << endl;
-    outfile << "        </DataArray>" << endl;
-    outfile << "      </Cells>" << endl;
-    outfile << "      <PointData>" << endl;
+        outfile << "        </DataArray>" << endl;
+        outfile << "        <DataArray type=\"Int32\" "
+                << "Name=\"offsets\" format=\"ascii\">" << endl;
 
-    // printing the fields
-    for (j = 0; j < nfields; ++j)
-    {
-        outfile << "        <DataArray type=\"Float64\" Name=\""
-                << m_f->m_variables[j] << "\">" << endl;
         outfile << "          ";
-        for (i = 0; i < fPts->GetNpoints(); ++i)
+        for (i = 0; i < numBlocks; ++i)
         {
-            outfile << fPts->GetPointVal(dim + j, i) << " ";
+            outfile << i * nvert + nvert << " ";
         }
         outfile << endl;
         outfile << "        </DataArray>" << endl;
-    }
+        outfile << "        <DataArray type=\"UInt8\" "
+                << "Name=\"types\" format=\"ascii\">" << endl;
+        outfile << "          ";
+        for (i = 0; i < numBlocks; ++i)
+        {
+            outfile << vtktype << " ";
+        }
+        outfile << endl;
+        outfile << "        </DataArray>" << endl;
+        outfile << "      </Cells>" << endl;
+        outfile << "      <PointData>" << endl;
 
-    outfile << "      </PointData>" << endl;
-    outfile << "    </Piece>" << endl;
+        // printing the fields
+        for (j = 0; j < nfields; ++j)
+        {
+            outfile << "        <DataArray type=\"Float64\" Name=\""
+                    << m_f->m_variables[j] << "\">" << endl;
+            outfile << "          ";
+            for (i = 0; i < fPts->GetNpoints(); ++i)
+            {
+                outfile << fPts->GetPointVal(dim + j, i) << " ";
+            }
+            outfile << endl;
+            outfile << "        </DataArray>" << endl;
+        }
+
+        outfile << "      </PointData>" << endl;
+        outfile << "    </Piece>" << endl;
+    }
 
     WriteVtkFooter(outfile);
     cout << "Written file: " << filename << endl;
@@ -232,36 +254,46 @@ void OutputVtk::OutputFromExp(po::variables_map &vm)
     int i,j;
     // Extract the output filename and extension
     string filename = PrepareOutput(vm);
+    SetDataFormat();
 
     // Write solution.
-    ofstream outfile(filename.c_str());
+    ofstream outfile(filename.c_str(), m_dataFormat == eAppended ?
+                     ios::out | ios::binary : ios::out);
     WriteVtkHeader(outfile);
     int nfields = m_f->m_variables.size();
 
     int nstrips;
     m_f->m_session->LoadParameter("Strip_Z", nstrips, 1);
 
-    // Homogeneous strip variant
-    for (int s = 0; s < nstrips; ++s)
+    if (m_dataFormat != eAscii)
+    {
+        // Write all elements as a single piece.
+        WriteVtkPieceFromExp(outfile, nstrips);
+    }
+    else
     {
-        // For each field write out field data for each expansion.
-        for (i = 0; i < m_f->m_exp[0]->GetNumElmts(); ++i)
+        // Homogeneous strip variant
+        for (int s = 0; s < nstrips; ++s)
         {
-            m_f->m_exp[0]->WriteVtkPieceHeader(outfile, i, s);
-
-            // For this expansion write out each field.
-            for (j = 0; j < nfields; ++j)
+            // For each field write out field data for each expansion.
+            for (i = 0; i < m_f->m_exp[0]->GetNumElmts(); ++i)
             {
-                m_f->m_exp[s * nfields + j]->WriteVtkPieceData(
-                    outfile, i, m_f->m_variables[j]);
+                m_f->m_exp[0]->WriteVtkPieceHeader(outfile, i, s);
+
+                // For this expansion write out each field.
+                for (j = 0; j < nfields; ++j)
+                {
+                    m_f->m_exp[s * nfields + j]->WriteVtkPieceData(
+                        outfile, i, m_f->m_variables[j]);
+                }
+                m_f->m_exp[0]->WriteVtkPieceFooter(outfile, i);
             }
-            m_f->m_exp[0]->WriteVtkPieceFooter(outfile, i);
         }
-    }
 
-    if (m_f->m_exp[0]->GetNumElmts() == 0)
-    {
-        WriteEmptyVtkPiece(outfile);
+        if (m_f->m_exp[0]->GetNumElmts() == 0)
+        {
+            WriteEmptyVtkPiece(outfile);
+        }
     }
 
     WriteVtkFooter(outfile);
@@ -326,17 +358,68 @@ fs::path OutputVtk::GetFullOutName(std::string &filename,
     return   fulloutname;
 }
 
+void OutputVtk::SetDataFormat()
+{
+    string format = boost::to_lower_copy(m_config["format"].as<string>());
+    if (format == "ascii")
+    {
+        m_dataFormat = eAscii;
+    }
+    else if (format == "binary")
+    {
+        m_dataFormat = eBinary;
+    }
+    else if (format == "appended")
+    {
+        m_dataFormat = eAppended;
+    }
+    else
+    {
+        ASSERTL0(false, "Unknown VTK data format '" + format +
+                 "': use ascii, binary or appended.");
+    }
+
+    m_compress = m_config["compress"].as<bool>() && m_dataFormat != eAscii;
+    m_appendedData.clear();
+}
+
 void OutputVtk::WriteVtkHeader(std::ostream &outfile)
 {
     outfile << "<?xml version=\"1.0\"?>" << endl;
-    outfile << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" "
-            << "byte_order=\"LittleEndian\">" << endl;
+    if (m_dataFormat == eAscii)
+    {
+        outfile << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" "
+                << "byte_order=\"LittleEndian\">" << endl;
+    }
+    else
+    {
+        // Binary data is written in the byte order of this machine, with
+        // 64-bit headers holding the size of each array.
+        outfile << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" "
+                << "byte_order=\""
+                << LibUtilities::EndianTypeMap[LibUtilities::Endianness()]
+                << "\" header_type=\"UInt64\"";
+        if (m_compress)
+        {
+            outfile << " compressor=\"vtkZLibDataCompressor\"";
+        }
+        outfile << ">" << endl;
+    }
     outfile << "  <UnstructuredGrid>" << endl;
 }
 
 void OutputVtk::WriteVtkFooter(std::ostream &outfile)
 {
     outfile << "  </UnstructuredGrid>" << endl;
+    if (m_dataFormat == eAppended)
+    {
+        outfile << "  <AppendedData encoding=\"raw\">" << endl;
+        outfile << "   _";
+        outfile.write(m_appendedData.data(), m_appendedData.size());
+        outfile << endl;
+        outfile << "  </AppendedData>" << endl;
+        m_appendedData.clear();
+    }
     outfile << "</VTKFile>" << endl;
 }
 
@@ -372,6 +455,290 @@ void OutputVtk::WriteEmptyVtkPiece(std::ofstream &outfile)
     outfile << "    </Piece>" << endl;
 }
 
+/**
+ * Write the elements of all strips of the expansion as a single piece in the
+ * binary or appended format.
+ */
+void OutputVtk::WriteVtkPieceFromExp(std::ostream &outfile, int nstrips)
+{
+    int nfields = m_f->m_variables.size();
+    int nelmts  = m_f->m_exp[0]->GetNumElmts();
+
+    vector<NekDouble>          points;
+    vector<int>                conn, offsets;
+    vector<unsigned char>      types;
+    vector<vector<NekDouble> > fields(nfields);
+
+    Array<OneD, Array<OneD, NekDouble> > coords;
+    Array<OneD, int>                     npts;
+    Array<OneD, NekDouble>               data;
+
+    for (int s = 0; s < nstrips; ++s)
+    {
+        for (int i = 0; i < nelmts; ++i)
+        {
+            m_f->m_exp[0]->GetVtkPieceGeometry(i, s, coords, npts);
+
+            int first = points.size() / 3;
+            int ntot  = coords[0].num_elements();
+            for (int k = 0; k < ntot; ++k)
+            {
+                points.push_back(coords[0][k]);
+                points.push_back(coords[1][k]);
+                points.push_back(coords[2][k]);
+            }
+
+            // The points form a tensor-product grid, of which the directions
+            // with more than one point span the cells.
+            int nstride = 0, stride[3], ncell[3], nstep = 1;
+            for (int d = 0; d < npts.num_elements(); ++d)
+            {
+                if (npts[d] > 1)
+                {
+                    ncell[nstride]    = npts[d] - 1;
+                    stride[nstride++] = nstep;
+                }
+                nstep *= npts[d];
+            }
+
+            if (nstride == 1)
+            {
+                for (int a = 0; a < ncell[0]; ++a)
+                {
+                    int v = first + a * stride[0];
+                    conn.push_back(v);
+                    conn.push_back(v + stride[0]);
+                    offsets.push_back(conn.size());
+                    types.push_back(3);
+                }
+            }
+            else if (nstride == 2)
+            {
+                for (int b = 0; b < ncell[1]; ++b)
+                {
+                    for (int a = 0; a < ncell[0]; ++a)
+                    {
+                        int v = first + a * stride[0] + b * stride[1];
+                        conn.push_back(v);
+                        conn.push_back(v + stride[0]);
+                        conn.push_back(v + stride[0] + stride[1]);
+                        conn.push_back(v + stride[1]);
+                        offsets.push_back(conn.size());
+                        types.push_back(9);
+                    }
+                }
+            }
+            else if (nstride == 3)
+            {
+                for (int c = 0; c < ncell[2]; ++c)
+                {
+                    for (int b = 0; b < ncell[1]; ++b)
+                    {
+                        for (int a = 0; a < ncell[0]; ++a)
+                        {
+                            int v = first + a * stride[0] + b * stride[1] +
+                                    c * stride[2];
+                            for (int f = 0; f < 2; ++f)
+                            {
+                                int w = v + f * stride[2];
+                                conn.push_back(w);
+                                conn.push_back(w + stride[0]);
+                                conn.push_back(w + stride[0] + stride[1]);
+                                conn.push_back(w + stride[1]);
+                            }
+                            offsets.push_back(conn.size());
+                            types.push_back(12);
+                        }
+                    }
+                }
+            }
+
+            for (int j = 0; j < nfields; ++j)
+            {
+                m_f->m_exp[s * nfields + j]->GetVtkPieceData(i, data);
+                fields[j].insert(fields[j].end(), data.begin(), data.end());
+            }
+        }
+    }
+
+    WriteVtkPiece(outfile, points, conn, offsets, types, fields);
+}
+
+/**
+ * Write the points of the pts field as a single piece in the binary or
+ * appended format.
+ */
+void OutputVtk::WriteVtkPieceFromPts(std::ostream &outfile, int nvert,
+                                     int vtktype)
+{
+    LibUtilities::PtsFieldSharedPtr fPts = m_f->m_fieldPts;
+
+    int dim     = fPts->GetDim();
+    int nPts    = fPts->GetNpoints();
+    int nfields = fPts->GetNFields();
+
+    // pack to 3D since paraview does not seem to handle 2D
+    vector<NekDouble> points(3 * nPts, 0.0);
+    for (int i = 0; i < nPts; ++i)
+    {
+        for (int j = 0; j < dim; ++j)
+        {
+            points[3 * i + j] = fPts->GetPointVal(j, i);
+        }
+    }
+
+    vector<Array<OneD, int> > ptsConn;
+    fPts->GetConnectivity(ptsConn);
+
+    vector<int> conn, offsets;
+    for (int i = 0; i < ptsConn.size(); ++i)
+    {
+        conn.insert(conn.end(), ptsConn[i].begin(), ptsConn[i].end());
+    }
+    for (int i = 0; i < conn.size() / nvert; ++i)
+    {
+        offsets.push_back(i * nvert + nvert);
+    }
+    vector<unsigned char> types(offsets.size(), vtktype);
+
+    vector<vector<NekDouble> > fields(nfields, vector<NekDouble>(nPts));
+    for (int j = 0; j < nfields; ++j)
+    {
+        for (int i = 0; i < nPts; ++i)
+        {
+            fields[j][i] = fPts->GetPointVal(dim + j, i);
+        }
+    }
+
+    WriteVtkPiece(outfile, points, conn, offsets, types, fields);
+}
+
+void OutputVtk::WriteVtkPiece(
+    std::ostream                              &outfile,
+    const std::vector<NekDouble>              &points,
+    const std::vector<int>                    &conn,
+    const std::vector<int>                    &offsets,
+    const std::vector<unsigned char>          &types,
+    const std::vector<std::vector<NekDouble> > &fields)
+{
+    outfile << "    <Piece NumberOfPoints=\"" << points.size() / 3
+            << "\" NumberOfCells=\"" << types.size() << "\">" << endl;
+    outfile << "      <Points>" << endl;
+    WriteDataArray(outfile, "Float64", "", 3, points);
+    outfile << "      </Points>" << endl;
+    outfile << "      <Cells>" << endl;
+    WriteDataArray(outfile, "Int32", "connectivity", 1, conn);
+    WriteDataArray(outfile, "Int32", "offsets", 1, offsets);
+    WriteDataArray(outfile, "UInt8", "types", 1, types);
+    outfile << "      </Cells>" << endl;
+    outfile << "      <PointData>" << endl;
+    for (int j = 0; j < fields.size(); ++j)
+    {
+        WriteDataArray(outfile, "Float64", m_f->m_variables[j], 1, fields[j]);
+    }
+    outfile << "      </PointData>" << endl;
+    outfile << "    </Piece>" << endl;
+}
+
+/**
+ * Write a data array in the binary format, or add it to the appended data
+ * and write a reference to its offset.
+ */
+template <typename T>
+void OutputVtk::WriteDataArray(std::ostream         &outfile,
+                               const std::string    &type,
+                               const std::string    &name,
+                               int                   ncomp,
+                               const std::vector<T> &data)
+{
+    string encoded = EncodeDataArray(
+        reinterpret_cast<const char *>(data.data()), data.size() * sizeof(T));
+
+    outfile << "        <DataArray type=\"" << type << "\"";
+    if (!name.empty())
+    {
+        outfile << " Name=\"" << name << "\"";
+    }
+    if (ncomp > 1)
+    {
+        outfile << " NumberOfComponents=\"" << ncomp << "\"";
+    }
+
+    if (m_dataFormat == eBinary)
+    {
+        outfile << " format=\"binary\">" << endl;
+        outfile << "          " << encoded << endl;
+        outfile << "        </DataArray>" << endl;
+    }
+    else
+    {
+        outfile << " format=\"appended\" offset=\"" << m_appendedData.size()
+                << "\"/>" << endl;
+        m_appendedData += encoded;
+    }
+}
+
+/**
+ * Encode @p nbytes bytes of @p data as a VTK binary data array: a header
+ * holding the size of the data, followed by the data itself. Compressed data
+ * is split in blocks of #VtkBlockSize bytes, and the header holds the
+ * number of blocks, the uncompressed sizes of a block and of the last
+ * partial block, and the compressed size of each block.
+ *
+ * In the binary format the header and the data are base64 encoded
+ * separately, as done by VTK.
+ */
+std::string OutputVtk::EncodeDataArray(const char *data, size_t nbytes)
+{
+    vector<uint64_t> header;
+    string payload;
+
+    if (m_compress)
+    {
+        uint64_t nblocks = (nbytes + VtkBlockSize - 1) / VtkBlockSize;
+        header.push_back(nblocks);
+        header.push_back(VtkBlockSize);
+        header.push_back(nbytes % VtkBlockSize);
+
+        for (size_t b = 0; b < nblocks; ++b)
+        {
+            size_t start = b * VtkBlockSize;
+            size_t end   = min(nbytes, start + VtkBlockSize);
+            vector<char> block(data + start, data + end);
+            string compressed;
+            LibUtilities::CompressData::ZlibEncode(block, compressed);
+            header.push_back(compressed.size());
+            payload += compressed;
+        }
+    }
+    else
+    {
+        header.push_back(nbytes);
+        payload.assign(data, data + nbytes);
+    }
+
+    string head(reinterpret_cast<const char *>(header.data()),
+                header.size() * sizeof(uint64_t));
+
+    if (m_dataFormat == eAppended)
+    {
+        return head + payload;
+    }
+
+    // Base64 encode the header and the data, replacing the characters
+    // which encode the zero bytes padding the input by '='.
+    string out;
+    for (string *bin : {&head, &payload})
+    {
+        size_t pad = (3 - bin->size() % 3) % 3;
+        string base64;
+        LibUtilities::CompressData::BinaryStrToBase64Str(*bin, base64);
+        base64.replace(base64.size() - pad, pad, pad, '=');
+        out += base64;
+    }
+    return out;
+}
+
 void OutputVtk::WritePVtu(po::variables_map &vm)
 {
     string filename  = m_config["outfile"].as<string>();
@@ -382,7 +749,7 @@ void OutputVtk::WritePVtu(po::variables_map &vm)
     ofstream outfile(filename.c_str());
 
     int nprocs  = m_f->m_comm->GetSize();
-    string path = LibUtilities::PortablePath(GetPath(filename,vm));
+    string path = LibUtilities::PortablePath(GetPath(filename,vm).filename());
 
     outfile << "<?xml version=\"1.0\"?>" << endl;
     outfile << "<VTKFile type=\"PUnstructuredGrid\" version=\"0.1\" "
@@ -62,6 +62,11 @@ public:
         return "OutputVtk";
     }
 
+    virtual bool IsElementLocal()
+    {
+        return true;
+    }
+
 protected:
     /// Write from pts to output file.
     virtual void OutputFromPts(po::variables_map &vm);
@@ -79,12 +84,49 @@ protected:
                                     po::variables_map &vm);
 
 private:
+    /// Encoding of the data arrays.
+    enum VtkDataFormat
+    {
+        eAscii,
+        eBinary,
+        eAppended
+    };
+
+    VtkDataFormat m_dataFormat;
+    /// Compress binary data arrays with zlib.
+    bool m_compress;
+    /// Raw data of the arrays written in the appended format.
+    std::string m_appendedData;
+
+    void SetDataFormat();
+
     void WriteVtkHeader(std::ostream &outfile);
 
     void WriteVtkFooter(std::ostream &outfile);
 
     void WriteEmptyVtkPiece(std::ofstream &outfile);
 
+    void WriteVtkPieceFromExp(std::ostream &outfile, int nstrips);
+
+    void WriteVtkPieceFromPts(std::ostream &outfile, int nvert, int vtktype);
+
+    void WriteVtkPiece(
+        std::ostream                              &outfile,
+        const std::vector<NekDouble>              &points,
+        const std::vector<int>                    &conn,
+        const std::vector<int>                    &offsets,
+        const std::vector<unsigned char>          &types,
+        const std::vector<std::vector<NekDouble> > &fields);
+
+    template <typename T>
+    void WriteDataArray(std::ostream         &outfile,
+                        const std::string    &type,
+                        const std::string    &name,
+                        int                   ncomp,
+                        const std::vector<T> &data);
+
+    std::string EncodeDataArray(const char *data, size_t nbytes);
+
     void WritePVtu(po::variables_map &vm);
 
     std::string PrepareOutput(po::variables_map &vm);
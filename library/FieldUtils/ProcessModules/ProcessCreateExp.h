@@ -77,6 +77,11 @@ public:
         return eCreateExp;
     }
 
+    virtual bool IsElementLocal()
+    {
+        return true;
+    }
+
 private:
 };
 }
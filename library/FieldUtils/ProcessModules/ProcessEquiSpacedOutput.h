@@ -76,6 +76,11 @@ public:
         return eConvertExpToPts;
     }
 
+    virtual bool IsElementLocal()
+    {
+        return true;
+    }
+
 protected:
     void SetHomogeneousConnectivity(void);
 
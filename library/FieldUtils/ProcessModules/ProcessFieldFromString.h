@@ -74,6 +74,11 @@ public:
     {
         return eModifyExp;
     }
+
+    virtual bool IsElementLocal()
+    {
+        return true;
+    }
 };
 }
 }
@@ -75,6 +75,11 @@ public:
     {
         return eModifyExp;
     }
+
+    virtual bool IsElementLocal()
+    {
+        return true;
+    }
 };
 }
 }
@@ -77,6 +77,11 @@ public:
         return eModifyFieldData;
     }
 
+    virtual bool IsElementLocal()
+    {
+        return true;
+    }
+
 private:
 };
 }
@@ -76,6 +76,11 @@ public:
         return eModifyExp;
     }
 
+    virtual bool IsElementLocal()
+    {
+        return true;
+    }
+
 protected:
     void GetVelocity( Array<OneD, Array<OneD, NekDouble> > &vel, int strip = 0);
 
@@ -42,6 +42,7 @@
 
 #include <chrono>
 #include <ctime>
+#include <exception>
 #include <ios>
 #include <iomanip>
 #include <fstream>
@@ -392,6 +393,56 @@ void FieldIO::AddInfoTag(TagWriterSharedPtr root,
     }
 }
 
+/**
+ * @brief Block until any write started by WriteAsync has completed.
+ *
+ * This is collective whenever a write is pending: the output is only
+ * published, through FieldIO::v_FinishWrite, once the write has finished on
+ * every process. Errors raised by the background write are reported here.
+ */
+void FieldIO::WaitForWrite()
+{
+    if (!m_pendingWrite.valid())
+    {
+        return;
+    }
+
+    std::exception_ptr error;
+    try
+    {
+        m_pendingWrite.get();
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    int failed = error ? 1 : 0;
+    m_comm->AllReduce(failed, ReduceMax);
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+    ASSERTL0(!failed, "Background write failed on another process.");
+
+    v_FinishWrite();
+}
+
+/**
+ * @brief Default implementation of WriteAsync, which writes the data
+ * immediately.
+ */
+void FieldIO::v_WriteAsync(const std::string                      &outFile,
+                           std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+                           std::vector<std::vector<NekDouble> >   &fielddata,
+                           const FieldMetaDataMap                 &fieldinfomap,
+                           const bool                              backup)
+{
+    WaitForWrite();
+    v_Write(outFile, fielddefs, fielddata, fieldinfomap, backup);
+}
+
 /**
  * @brief Set up the filesystem ready for output.
  *
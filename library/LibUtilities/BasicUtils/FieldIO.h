@@ -42,6 +42,8 @@
 #include <LibUtilities/Foundations/Points.h>
 #include <tinyxml.h>
 
+#include <future>
+
 #include <LibUtilities/BasicUtils/NekFactory.hpp>
 
 namespace Nektar
@@ -227,6 +229,10 @@ public:
 
     LIB_UTILITIES_EXPORT virtual ~FieldIO()
     {
+        if (m_pendingWrite.valid())
+        {
+            m_pendingWrite.wait();
+        }
     }
 
     LIB_UTILITIES_EXPORT inline void Write(
@@ -236,6 +242,15 @@ public:
         const FieldMetaDataMap &fieldinfomap = NullFieldMetaDataMap,
         const bool backup = false);
 
+    LIB_UTILITIES_EXPORT inline void WriteAsync(
+        const std::string &outFile,
+        std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+        std::vector<std::vector<NekDouble> > &fielddata,
+        const FieldMetaDataMap &fieldinfomap = NullFieldMetaDataMap,
+        const bool backup = false);
+
+    LIB_UTILITIES_EXPORT void WaitForWrite();
+
     LIB_UTILITIES_EXPORT inline void Import(
         const std::string &infilename,
         std::vector<FieldDefinitionsSharedPtr> &fielddefs,
@@ -266,6 +281,8 @@ protected:
     LibUtilities::CommSharedPtr m_comm;
     /// Boolean dictating whether we are on a shared filesystem.
     bool                        m_sharedFilesystem;
+    /// Background write started by WriteAsync, if any.
+    std::future<void>           m_pendingWrite;
 
     LIB_UTILITIES_EXPORT int CheckFieldDefinition(
         const FieldDefinitionsSharedPtr &fielddefs);
@@ -289,6 +306,24 @@ protected:
         const FieldMetaDataMap                 &fieldinfomap,
         const bool                              backup = false) = 0;
 
+    /// @copydoc FieldIO::WriteAsync
+    LIB_UTILITIES_EXPORT virtual void v_WriteAsync(
+        const std::string                      &outFile,
+        std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+        std::vector<std::vector<NekDouble> >   &fielddata,
+        const FieldMetaDataMap                 &fieldinfomap,
+        const bool                              backup = false);
+
+    /**
+     * @brief Publish the output of a completed background write.
+     *
+     * Called collectively by FieldIO::WaitForWrite once every process has
+     * finished its part of the write.
+     */
+    LIB_UTILITIES_EXPORT virtual void v_FinishWrite()
+    {
+    }
+
     /// @copydoc FieldIO::Import
     LIB_UTILITIES_EXPORT virtual void v_Import(
         const std::string &infilename,
@@ -323,6 +358,35 @@ inline void FieldIO::Write(const std::string                      &outFile,
     v_Write(outFile, fielddefs, fielddata, fieldinfomap, backup);
 }
 
+/**
+ * @brief Write out the field information to the file @p outFile, returning
+ * before the data has been written where the format supports this.
+ *
+ * Any parallel setup of the output is performed before returning, and the
+ * remainder of the write is completed in the background. Only one
+ * background write is in progress at any time: if the previous write has
+ * not finished, this call waits for it first. The contents of @p fielddata
+ * are taken over by the write and it is left empty. Formats which do not
+ * support background writes perform a regular Write.
+ *
+ * @param outFile       Output filename
+ * @param fielddefs     Field definitions that define the output
+ * @param fielddata     Binary field data that stores the output corresponding
+ *                      to @p fielddefs.
+ * @param fieldinfomap  Associated field metadata map.
+ *
+ * @see FieldIO::WaitForWrite
+ */
+inline void FieldIO::WriteAsync(
+    const std::string                      &outFile,
+    std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+    std::vector<std::vector<NekDouble> >   &fielddata,
+    const FieldMetaDataMap                 &fieldinfomap,
+    const bool                              backup)
+{
+    v_WriteAsync(outFile, fielddefs, fielddata, fieldinfomap, backup);
+}
+
 /**
  * @brief Read field information from the file @p infilename.
  *
@@ -116,6 +116,120 @@ void FieldIOXml::v_Write(const std::string &outFile,
     std::string filename = SetUpOutput(outFile, true, backup);
     SetUpFieldMetaData(outFile, fielddefs, fieldmetadatamap);
 
+    WriteDocument(filename, fielddefs, fielddata, fieldmetadatamap);
+
+    m_comm->Block();
+
+    // all data has been written
+    if (m_comm->TreatAsRankZero())
+    {
+        tm1 = m_comm->Wtime();
+        std::cout << " (" << tm1 - tm0 << "s, XML)" << std::endl;
+    }
+}
+
+/**
+ * @brief Write an XML file to @p outFile in the background.
+ *
+ * The output directory and the index are set up collectively before
+ * returning. The field data is then moved into a staging buffer, and the
+ * partition file is compressed and written by a separate thread, so that no
+ * communication takes place outside of the calling thread. Any previous
+ * background write is completed first.
+ *
+ * The index is written as `Info.xml.tmp` (in serial, the field file itself is
+ * written with a `.tmp` suffix) and is only renamed by FieldIOXml::
+ * v_FinishWrite, once FieldIO::WaitForWrite has established that every
+ * process has finished writing. An interrupted write therefore never leaves
+ * behind a file that appears complete.
+ *
+ * @param outFile           Output filename.
+ * @param fielddefs         Input field definitions.
+ * @param fielddata         Input field data; left empty on return.
+ * @param fieldmetadatamap  Field metadata.
+ */
+void FieldIOXml::v_WriteAsync(const std::string &outFile,
+                              std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+                              std::vector<std::vector<NekDouble> > &fielddata,
+                              const FieldMetaDataMap &fieldmetadatamap,
+                              const bool backup)
+{
+    WaitForWrite();
+
+    ASSERTL1(fielddefs.size() == fielddata.size(),
+             "Length of fielddefs and fielddata incompatible");
+
+    std::string filename = SetUpOutput(outFile, true, backup);
+    SetUpFieldMetaData(outFile, fielddefs, fieldmetadatamap, "Info.xml.tmp");
+
+    if (m_comm->GetSize() == 1)
+    {
+        m_pendingRename = std::make_pair(filename + ".tmp", filename);
+        filename        = m_pendingRename.first;
+    }
+    else if (m_comm->GetRank() == 0)
+    {
+        fs::path specPath(outFile);
+        m_pendingRename = std::make_pair(
+            LibUtilities::PortablePath(specPath / fs::path("Info.xml.tmp")),
+            LibUtilities::PortablePath(specPath / fs::path("Info.xml")));
+    }
+
+    if (m_comm->TreatAsRankZero())
+    {
+        std::cout << " (background, XML)" << std::endl;
+    }
+
+    // The definitions are not modified by the writer, so only the data
+    // needs to be staged.
+    auto defs = std::make_shared<std::vector<FieldDefinitionsSharedPtr> >(
+        fielddefs);
+    auto data = std::make_shared<std::vector<std::vector<NekDouble> > >();
+    data->swap(fielddata);
+    auto info = std::make_shared<FieldMetaDataMap>(fieldmetadatamap);
+
+    m_pendingWrite = std::async(std::launch::async,
+        [filename, defs, data, info]()
+        {
+            WriteDocument(filename, *defs, *data, *info);
+        });
+}
+
+/**
+ * @brief Move the output of a completed background write to its final name.
+ */
+void FieldIOXml::v_FinishWrite()
+{
+    if (m_pendingRename.first.empty())
+    {
+        return;
+    }
+
+    try
+    {
+        fs::rename(m_pendingRename.first, m_pendingRename.second);
+    }
+    catch (fs::filesystem_error &e)
+    {
+        ASSERTL0(false, "Filesystem error: " + std::string(e.what()));
+    }
+
+    m_pendingRename = std::make_pair(std::string(), std::string());
+}
+
+/**
+ * @brief Create the XML document for a single partition and save it to
+ * @p filename.
+ *
+ * This performs no communication, so that it may be called from a
+ * background thread.
+ */
+void FieldIOXml::WriteDocument(
+    const std::string &filename,
+    const std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+    std::vector<std::vector<NekDouble> > &fielddata,
+    const FieldMetaDataMap &fieldmetadatamap)
+{
     // Create the file (partition)
     TiXmlDocument doc;
     TiXmlDeclaration *decl = new TiXmlDeclaration("1.0", "utf-8", "");
@@ -354,15 +468,6 @@ void FieldIOXml::v_Write(const std::string &outFile,
         elemTag->LinkEndChild(new TiXmlText(base64string));
     }
     doc.SaveFile(filename);
-
-    m_comm->Block();
-
-    // all data has been written
-    if (m_comm->TreatAsRankZero())
-    {
-        tm1 = m_comm->Wtime();
-        std::cout << " (" << tm1 - tm0 << "s, XML)" << std::endl;
-    }
 }
 
 /**
@@ -693,11 +798,13 @@ DataSourceSharedPtr FieldIOXml::v_ImportFieldMetaData(
  * @param fielddefs         Field definitions, needed to grab element IDs.
  * @param fieldmetadatamap  Field metadata map that is also written to the
  *                          `Info.xml` file.
+ * @param infoName          Name of the index file within @p outname.
  */
 void FieldIOXml::SetUpFieldMetaData(
     const std::string &outname,
     const std::vector<FieldDefinitionsSharedPtr> &fielddefs,
-    const FieldMetaDataMap &fieldmetadatamap)
+    const FieldMetaDataMap &fieldmetadatamap,
+    const std::string &infoName)
 {
     ASSERTL0(!outname.empty(), "Empty path given to SetUpFieldMetaData()");
 
@@ -746,7 +853,7 @@ void FieldIOXml::SetUpFieldMetaData(
 
         // Write the Info.xml file
         std::string infofile =
-            LibUtilities::PortablePath(specPath / fs::path("Info.xml"));
+            LibUtilities::PortablePath(specPath / fs::path(infoName));
 
         WriteMultiFldFileIDs(infofile, filenames, ElementIDs, fieldmetadatamap);
     }
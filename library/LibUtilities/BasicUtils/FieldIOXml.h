@@ -239,7 +239,8 @@ public:
     LIB_UTILITIES_EXPORT void SetUpFieldMetaData(
         const std::string &outname,
         const std::vector<FieldDefinitionsSharedPtr> &fielddefs,
-        const FieldMetaDataMap &fieldmetadatamap);
+        const FieldMetaDataMap &fieldmetadatamap,
+        const std::string &infoName = "Info.xml");
 
     LIB_UTILITIES_EXPORT void ImportMultiFldFileIDs(
         const std::string &inFile,
@@ -262,6 +263,10 @@ public:
     }
 
 private:
+    /// Temporary file written by the pending background write, and the name
+    /// it is given once the write has completed on every process.
+    std::pair<std::string, std::string> m_pendingRename;
+
     LIB_UTILITIES_EXPORT virtual void v_Write(
         const std::string &outFile,
         std::vector<FieldDefinitionsSharedPtr> &fielddefs,
@@ -269,8 +274,23 @@ private:
         const FieldMetaDataMap &fieldinfomap = NullFieldMetaDataMap,
         const bool backup = false);
 
+    LIB_UTILITIES_EXPORT virtual void v_WriteAsync(
+        const std::string &outFile,
+        std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+        std::vector<std::vector<NekDouble> > &fielddata,
+        const FieldMetaDataMap &fieldinfomap = NullFieldMetaDataMap,
+        const bool backup = false);
+
+    LIB_UTILITIES_EXPORT virtual void v_FinishWrite();
+
     LIB_UTILITIES_EXPORT virtual DataSourceSharedPtr v_ImportFieldMetaData(
         const std::string &filename, FieldMetaDataMap &fieldmetadatamap);
+
+    LIB_UTILITIES_EXPORT static void WriteDocument(
+        const std::string &filename,
+        const std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+        std::vector<std::vector<NekDouble> > &fielddata,
+        const FieldMetaDataMap &fieldmetadatamap);
 };
 
 }
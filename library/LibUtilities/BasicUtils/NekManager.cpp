@@ -0,0 +1,292 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: NekManager.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Scientific Computing and Imaging Institute,
+// University of Utah (USA) and Department of Aeronautics, Imperial
+// College London (UK).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Registry of the pools of NekManager instances
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <iomanip>
+#include <map>
+#include <mutex>
+
+#include <LibUtilities/BasicUtils/NekManager.hpp>
+#include <LibUtilities/Communication/Comm.h>
+
+namespace Nektar
+{
+namespace LibUtilities
+{
+
+namespace
+{
+
+/// Pools of all NekManager instantiations and the memory budgets set for
+/// them, where the budget of the empty name applies to all pools.
+struct PoolRegistry
+{
+    std::mutex                                      mutex;
+    std::vector<std::weak_ptr<NekManagerPoolInfo> > pools;
+    std::map<std::string, size_t>                   budgets;
+};
+
+PoolRegistry &GetPoolRegistry()
+{
+    static PoolRegistry registry;
+    return registry;
+}
+
+/// Budget applying to pool @p name, or zero if none is set.
+size_t FindBudget(const PoolRegistry &reg, const std::string &name)
+{
+    auto it = reg.budgets.find(name);
+    if (it == reg.budgets.end())
+    {
+        it = reg.budgets.find("");
+    }
+    return it == reg.budgets.end() ? 0 : it->second;
+}
+
+}
+
+void NekManagerRegistry::Register(const NekManagerPoolInfoSharedPtr &pool)
+{
+    PoolRegistry &reg = GetPoolRegistry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    // Drop pools of managers which have since been destroyed.
+    reg.pools.erase(
+        std::remove_if(reg.pools.begin(), reg.pools.end(),
+                       [](const std::weak_ptr<NekManagerPoolInfo> &p)
+                       {
+                           return p.expired();
+                       }),
+        reg.pools.end());
+
+    pool->m_maxBytes = FindBudget(reg, pool->m_name);
+    reg.pools.push_back(pool);
+}
+
+/**
+ * While a pool is read-only its lookups do not lock, so that threads which
+ * only read matrices created during setup do not contend, and objects not
+ * yet stored are recreated on every lookup. This must not be called while
+ * other threads use any manager.
+ */
+void NekManagerRegistry::SetReadOnly(bool readOnly)
+{
+    for (auto &pool : GetPools())
+    {
+        pool->m_readOnly.store(readOnly, std::memory_order_release);
+    }
+}
+
+/**
+ * The budget is enforced when the next object is stored in a pool, by
+ * discarding its least recently used objects. Objects still referenced
+ * elsewhere remain alive until released, and are recreated if looked up
+ * again.
+ */
+void NekManagerRegistry::SetMemoryBudget(size_t bytes,
+                                         const std::string &whichPool)
+{
+    PoolRegistry &reg = GetPoolRegistry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    if (whichPool.empty())
+    {
+        reg.budgets.clear();
+    }
+    reg.budgets[whichPool] = bytes;
+
+    for (auto &p : reg.pools)
+    {
+        NekManagerPoolInfoSharedPtr pool = p.lock();
+        if (pool && (whichPool.empty() || pool->m_name == whichPool))
+        {
+            pool->m_maxBytes = bytes;
+        }
+    }
+}
+
+std::vector<NekManagerPoolInfoSharedPtr> NekManagerRegistry::GetPools()
+{
+    PoolRegistry &reg = GetPoolRegistry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    std::vector<NekManagerPoolInfoSharedPtr> pools;
+    for (auto &p : reg.pools)
+    {
+        NekManagerPoolInfoSharedPtr pool = p.lock();
+        if (pool)
+        {
+            pools.push_back(pool);
+        }
+    }
+    return pools;
+}
+
+/**
+ * Each process must call this routine; the table is printed by the root
+ * process only. Pools of the same name, such as the private pools of
+ * unnamed managers, are combined.
+ */
+void NekManagerRegistry::PrintStatistics(CommSharedPtr comm, std::ostream &o)
+{
+    // Combine the local pools by name.
+    const int nCounters = 6;
+    std::map<std::string, std::vector<NekDouble> > local;
+    for (auto &pool : GetPools())
+    {
+        std::vector<NekDouble> &c = local[
+            pool->m_name.empty() ? "(unnamed)" : pool->m_name];
+        c.resize(nCounters, 0.0);
+        c[0] += pool->m_entries.load();
+        c[1] += pool->m_hits.load();
+        c[2] += pool->m_misses.load();
+        c[3] += pool->m_evictions.load();
+        c[4] += pool->m_bytes.load();
+        c[5] += pool->m_readOnlyMisses.load();
+    }
+
+    // Gather the names of all processes to form the union of pools.
+    std::vector<char> sendBuf;
+    for (auto &x : local)
+    {
+        sendBuf.insert(sendBuf.end(), x.first.begin(), x.first.end());
+        sendBuf.push_back('\n');
+    }
+    sendBuf.push_back('\n');
+
+    std::vector<char> recvBuf = sendBuf;
+    int nProc = comm->GetSize();
+    if (nProc > 1)
+    {
+        std::vector<int> size(1, sendBuf.size()), sizes(nProc);
+        comm->AllGather(size, sizes);
+
+        Array<OneD, int> sizeMap(nProc), offsetMap(nProc, 0);
+        for (int i = 0; i < nProc; ++i)
+        {
+            sizeMap[i] = sizes[i];
+            if (i > 0)
+            {
+                offsetMap[i] = offsetMap[i-1] + sizeMap[i-1];
+            }
+        }
+
+        recvBuf.resize(offsetMap[nProc-1] + sizeMap[nProc-1]);
+        comm->AllGatherv(sendBuf, recvBuf, sizeMap, offsetMap);
+    }
+
+    std::map<std::string, int> index;
+    std::string name;
+    for (char c : recvBuf)
+    {
+        if (c != '\n')
+        {
+            name += c;
+            continue;
+        }
+        if (!name.empty())
+        {
+            index.insert(std::make_pair(name, 0));
+        }
+        name.clear();
+    }
+
+    int n = 0;
+    for (auto &x : index)
+    {
+        x.second = n++;
+    }
+
+    std::vector<NekDouble> sums(nCounters * n, 0.0), maxBytes(n, 0.0);
+    for (auto &x : local)
+    {
+        int j = index[x.first];
+        for (int k = 0; k < nCounters; ++k)
+        {
+            sums[nCounters * j + k] = x.second[k];
+        }
+        maxBytes[j] = x.second[4];
+    }
+
+    if (n > 0)
+    {
+        comm->AllReduce(sums,     ReduceSum);
+        comm->AllReduce(maxBytes, ReduceMax);
+    }
+
+    if (comm->GetRank() != 0)
+    {
+        return;
+    }
+
+    const int nameWidth = 36;
+    const NekDouble mb  = 1024.0 * 1024.0;
+    std::ios::fmtflags flags = o.flags();
+    NekDouble totalBytes = 0.0, readOnlyMisses = 0.0;
+
+    o << "-------------------------------------------" << std::endl;
+    o << "Manager pools (" << nProc << " processes)" << std::endl;
+    o << std::left  << std::setw(nameWidth) << "Pool"
+      << std::right << std::setw(10) << "Entries"
+      << std::setw(12) << "Hits"
+      << std::setw(10) << "Misses"
+      << std::setw(10) << "Evicted"
+      << std::setw(12) << "Max MB"
+      << std::setw(12) << "Total MB" << std::endl;
+
+    for (auto &x : index)
+    {
+        const NekDouble *c = &sums[nCounters * x.second];
+        o << std::left  << std::setw(nameWidth) << x.first
+          << std::right << std::setw(10) << static_cast<unsigned long>(c[0])
+          << std::setw(12) << static_cast<unsigned long>(c[1])
+          << std::setw(10) << static_cast<unsigned long>(c[2])
+          << std::setw(10) << static_cast<unsigned long>(c[3])
+          << std::fixed << std::setprecision(2)
+          << std::setw(12) << maxBytes[x.second] / mb
+          << std::setw(12) << c[4] / mb << std::endl;
+        o.flags(flags);
+        totalBytes     += c[4];
+        readOnlyMisses += c[5];
+    }
+
+    o << "Total memory held by managers: " << std::fixed
+      << std::setprecision(2) << totalBytes / mb << " MB" << std::endl;
+    o.flags(flags);
+    o << "Misses while read-only: "
+      << static_cast<unsigned long>(readOnlyMisses) << std::endl;
+    o << "-------------------------------------------" << std::endl;
+}
+
+}
+}
@@ -35,16 +35,22 @@
 #ifndef NEKTAR_LIB_UTILITIES_BASIC_UTILS_NEK_MANAGER_HPP
 #define NEKTAR_LIB_UTILITIES_BASIC_UTILS_NEK_MANAGER_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <map>
 #include <sstream>
 #include <memory>
 #include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
 
 #ifdef NEKTAR_USE_THREAD_SAFETY
 #include <boost/thread/shared_mutex.hpp>
 #include <boost/thread/locks.hpp>
 #endif
 
+#include <LibUtilities/LibUtilitiesDeclspec.h>
 #include <LibUtilities/BasicUtils/ErrorUtil.hpp>
 
 namespace Nektar
@@ -56,6 +62,9 @@ namespace Nektar
         typedef boost::shared_lock<boost::shared_mutex> ReadLock;
 #endif
 
+        class Comm;
+        typedef std::shared_ptr<Comm> CommSharedPtr;
+
         template <typename KeyType>
         struct defOpLessCreator
         {
@@ -65,96 +74,144 @@ namespace Nektar
             }
         };
 
+        /// Estimate of the memory in bytes held by an object stored in a
+        /// NekManager. Overloads for specific types are found by
+        /// argument-dependent lookup; other types count as their size.
+        template <typename T>
+        inline size_t ManagedObjectBytes(const T &)
+        {
+            return sizeof(T);
+        }
+
+        /**
+         * @brief Accounting and access state shared by all NekManager
+         * instances which use the same pool.
+         *
+         * Counters are updated with relaxed atomic operations and are
+         * therefore only approximate while lookups are in progress.
+         */
+        struct NekManagerPoolInfo
+        {
+            NekManagerPoolInfo(const std::string &name) :
+                m_name(name), m_readOnly(false), m_maxBytes(0), m_bytes(0),
+                m_entries(0), m_hits(0), m_misses(0), m_readOnlyMisses(0),
+                m_evictions(0)
+            {
+            }
+
+            /// Name of the pool, empty for unpooled managers.
+            const std::string   m_name;
+            /// If set, lookups do not lock and misses are not stored.
+            std::atomic<bool>   m_readOnly;
+            /// Memory budget in bytes, or zero for an unlimited pool.
+            std::atomic<size_t> m_maxBytes;
+            /// Estimated memory held by the stored objects.
+            std::atomic<size_t> m_bytes;
+            /// Number of stored objects.
+            std::atomic<size_t> m_entries;
+            /// Lookups served from the pool (not counted while read-only).
+            std::atomic<size_t> m_hits;
+            /// Lookups which had to create the object.
+            std::atomic<size_t> m_misses;
+            /// Misses while read-only, whose objects were not kept.
+            std::atomic<size_t> m_readOnlyMisses;
+            /// Objects discarded to stay within the memory budget.
+            std::atomic<size_t> m_evictions;
+        };
+        typedef std::shared_ptr<NekManagerPoolInfo> NekManagerPoolInfoSharedPtr;
+
+        /**
+         * @brief Process-wide registry of the pools of all NekManager
+         * instantiations, used to report their memory usage and to set their
+         * access mode and memory budget.
+         */
+        class NekManagerRegistry
+        {
+            public:
+                /// Add a pool to the registry and apply the memory budget
+                /// set for its name.
+                LIB_UTILITIES_EXPORT static void Register(
+                    const NekManagerPoolInfoSharedPtr &pool);
+
+                /// Switch all pools to or from the lock-free read-only mode.
+                LIB_UTILITIES_EXPORT static void SetReadOnly(bool readOnly);
+
+                /// Set the memory budget in bytes of the pool @p whichPool,
+                /// or the default of all pools if empty. Zero removes the
+                /// budget.
+                LIB_UTILITIES_EXPORT static void SetMemoryBudget(
+                    size_t bytes, const std::string &whichPool = "");
+
+                /// Return the pools which are currently alive.
+                LIB_UTILITIES_EXPORT static
+                    std::vector<NekManagerPoolInfoSharedPtr> GetPools();
+
+                /// Print the memory usage and hit rates of the pools summed
+                /// across all processes of @p comm (collective).
+                LIB_UTILITIES_EXPORT static void PrintStatistics(
+                    CommSharedPtr comm, std::ostream &o = std::cout);
+        };
+
         template <typename KeyType, typename ValueT, typename opLessCreator = defOpLessCreator<KeyType> >
         class NekManager
         {
             public:
                 typedef std::shared_ptr<ValueT> ValueType;
                 typedef std::function<ValueType (const KeyType& key)> CreateFuncType;
-                typedef std::map<KeyType, ValueType> ValueContainer;
-                typedef std::shared_ptr<ValueContainer> ValueContainerShPtr;
                 typedef std::map<KeyType, CreateFuncType, opLessCreator> CreateFuncContainer;
-                typedef std::map<std::string, std::shared_ptr<ValueContainer> > ValueContainerPool;
                 typedef std::shared_ptr<bool> BoolSharedPtr;
                 typedef std::map<std::string, BoolSharedPtr> FlagContainerPool;
 
-                NekManager(std::string whichPool="") :
-                    m_values(),
-                    m_globalCreateFunc(),
-                    m_keySpecificCreateFuncs()
-
+                /// Stored object with its estimated size and the time of
+                /// its last use, used for eviction.
+                struct ValueEntry
                 {
-                    if (!whichPool.empty())
+                    ValueEntry(const ValueType &value, size_t bytes,
+                               size_t lastUse) :
+                        m_value(value), m_bytes(bytes), m_lastUse(lastUse)
                     {
-                        auto iter = m_ValueContainerPool.find(whichPool);
-                        if (iter != m_ValueContainerPool.end())
-                        {
-                            m_values = iter->second;
-                            m_managementEnabled = m_managementEnabledContainerPool[whichPool];
-                        }
-                        else
-                        {
-                            m_values = ValueContainerShPtr(new ValueContainer);
-                            m_ValueContainerPool[whichPool] = m_values;
-                            if (m_managementEnabledContainerPool.find(whichPool) == m_managementEnabledContainerPool.end())
-                            {
-                                m_managementEnabledContainerPool[whichPool] = BoolSharedPtr(new bool(true));
-                            }
-                            m_managementEnabled = m_managementEnabledContainerPool[whichPool];
-                        }
                     }
-                    else
+
+                    ValueType           m_value;
+                    size_t              m_bytes;
+                    std::atomic<size_t> m_lastUse;
+                };
+
+                typedef std::map<KeyType, ValueEntry> ValueContainer;
+
+                /// Objects of a pool, shared by all managers using it.
+                struct ValuePool
+                {
+                    ValuePool(const std::string &name) :
+                        m_info(new NekManagerPoolInfo(name)), m_clock(0)
                     {
-                        m_values = ValueContainerShPtr(new ValueContainer);
-                        m_managementEnabled = BoolSharedPtr(new bool(true));
+                        NekManagerRegistry::Register(m_info);
                     }
+
+                    ValueContainer              m_values;
+                    NekManagerPoolInfoSharedPtr m_info;
+                    std::atomic<size_t>         m_clock;
+#ifdef NEKTAR_USE_THREAD_SAFETY
+                    boost::shared_mutex         m_mutex;
+#endif
                 };
+                typedef std::shared_ptr<ValuePool> ValuePoolSharedPtr;
+                typedef std::map<std::string, ValuePoolSharedPtr> ValueContainerPool;
 
+                NekManager(std::string whichPool="") :
+                    m_values(),
+                    m_globalCreateFunc(),
+                    m_keySpecificCreateFuncs()
+                {
+                    InitialisePool(whichPool);
+                }
 
                 explicit NekManager(CreateFuncType f, std::string whichPool="") :
                     m_values(),
                     m_globalCreateFunc(f),
                     m_keySpecificCreateFuncs()
                 {
-                    if (!whichPool.empty())
-                    {
-#ifdef NEKTAR_USE_THREAD_SAFETY
-                        ReadLock v_rlock(m_mutex); // reading static members
-#endif
-                        auto iter = m_ValueContainerPool.find(whichPool);
-                        if (iter != m_ValueContainerPool.end())
-                        {
-                            m_values = iter->second;
-                            m_managementEnabled = m_managementEnabledContainerPool[whichPool];
-                        }
-                        else
-                        {
-#ifdef NEKTAR_USE_THREAD_SAFETY
-                            v_rlock.unlock();
-                            // now writing static members.  Apparently
-                            // upgrade_lock has less desirable properties than
-                            // just dropping read lock, grabbing write lock.
-                            // write will block until all reads are done, but
-                            // reads cannot be acquired if write lock is
-                            // blocking.  In this context writes are supposed to
-                            // be rare.
-                            WriteLock v_wlock(m_mutex);
-#endif
-                            m_values = ValueContainerShPtr(new ValueContainer);
-                            m_ValueContainerPool[whichPool] = m_values;
-                            if (m_managementEnabledContainerPool.find(whichPool) == m_managementEnabledContainerPool.end())
-                            {
-                                m_managementEnabledContainerPool[whichPool] = BoolSharedPtr(new bool(true));
-                            }
-                            m_managementEnabled = m_managementEnabledContainerPool[whichPool];
-                        }
-
-                    }
-                    else
-                    {
-                        m_values = ValueContainerShPtr(new ValueContainer);
-                        m_managementEnabled = BoolSharedPtr(new bool(true));
-                    }
+                    InitialisePool(whichPool);
                 }
 
                 ~NekManager()
@@ -182,92 +239,140 @@ namespace Nektar
 
                 bool AlreadyCreated(const KeyType &key)
                 {
-                    bool value = false;
-                    auto found = m_values->find(key);
-                    if( found != m_values->end() )
+#ifdef NEKTAR_USE_THREAD_SAFETY
+                    ReadLock v_rlock(m_values->m_mutex, boost::defer_lock);
+                    if (!m_values->m_info->m_readOnly.load(
+                            std::memory_order_acquire))
                     {
-                        value = true;
+                        v_rlock.lock();
                     }
-
-                    return value;
+#endif
+                    return m_values->m_values.find(key) !=
+                        m_values->m_values.end();
                 }
 
+                /**
+                 * Return the object associated with @p key, creating it if
+                 * it is not yet stored. Lookups take a shared lock on the
+                 * pool, which is only upgraded to store a newly created
+                 * object; the object is created without holding a lock so
+                 * that creators may themselves use managers. While the pool
+                 * is read-only, lookups take no lock at all and objects
+                 * which are not yet stored are created but not kept.
+                 */
                 ValueType operator[](const KeyType &key)
                 {
-                    auto found = m_values->find(key);
+                    ValuePool &pool = *m_values;
+                    NekManagerPoolInfo &info = *pool.m_info;
 
-                    if( found != m_values->end() )
-                    {
-                        return (*found).second;
-                    }
-                    else
+                    if (info.m_readOnly.load(std::memory_order_acquire))
                     {
-                        // No object, create a new one.
-                        CreateFuncType f = m_globalCreateFunc;
-                        auto keyFound = m_keySpecificCreateFuncs.find(key);
-                        if( keyFound != m_keySpecificCreateFuncs.end() )
+                        auto found = pool.m_values.find(key);
+                        if (found != pool.m_values.end())
                         {
-                            f = (*keyFound).second;
+                            return found->second.m_value;
                         }
+                        info.m_misses.fetch_add(1, std::memory_order_relaxed);
+                        info.m_readOnlyMisses.fetch_add(
+                            1, std::memory_order_relaxed);
+                        return CreateObject(key);
+                    }
 
-                        if( f )
+                    {
+#ifdef NEKTAR_USE_THREAD_SAFETY
+                        ReadLock v_rlock(pool.m_mutex);
+#endif
+                        auto found = pool.m_values.find(key);
+                        if (found != pool.m_values.end())
                         {
-                            ValueType v = f(key);
-                            if (*m_managementEnabled)
+                            info.m_hits.fetch_add(
+                                1, std::memory_order_relaxed);
+                            // Recency is only needed to evict objects.
+                            if (info.m_maxBytes.load(
+                                    std::memory_order_relaxed) > 0)
                             {
-                                (*m_values)[key] = v;
+                                found->second.m_lastUse.store(
+                                    ++pool.m_clock, std::memory_order_relaxed);
                             }
-                            return v;
-                        }
-                        else
-                        {
-                            std::stringstream ss;
-                            ss << key;
-                            std::string message = "No create func found for key " + ss.str();
-                            NEKERROR(ErrorUtil::efatal, message.c_str());
-                            static ValueType result;
-                            return result;
+                            return found->second.m_value;
                         }
                     }
+
+                    info.m_misses.fetch_add(1, std::memory_order_relaxed);
+                    ValueType v = CreateObject(key);
+                    if (!*m_managementEnabled || !v)
+                    {
+                        return v;
+                    }
+
+#ifdef NEKTAR_USE_THREAD_SAFETY
+                    WriteLock v_wlock(pool.m_mutex);
+#endif
+                    // Another thread may have stored the object meanwhile,
+                    // in which case the stored object is returned.
+                    size_t bytes = ManagedObjectBytes(*v);
+                    auto inserted = pool.m_values.emplace(
+                        std::piecewise_construct, std::forward_as_tuple(key),
+                        std::forward_as_tuple(v, bytes, ++pool.m_clock));
+                    if (!inserted.second)
+                    {
+                        return inserted.first->second.m_value;
+                    }
+
+                    info.m_bytes   += bytes;
+                    info.m_entries += 1;
+                    EvictObjects(pool, inserted.first);
+                    return v;
+                }
+
+                /// Return the accounting and access state of the pool used by
+                /// this manager.
+                const NekManagerPoolInfoSharedPtr &GetPoolInfo() const
+                {
+                    return m_values->m_info;
                 }
 
                 void DeleteObject(const KeyType &key)
                 {
-                    auto found = m_values->find(key);
+#ifdef NEKTAR_USE_THREAD_SAFETY
+                    WriteLock v_wlock(m_values->m_mutex);
+#endif
+                    auto found = m_values->m_values.find(key);
 
-                    if( found != m_values->end() )
+                    if( found != m_values->m_values.end() )
                     {
-                        m_values->erase(found);
+                        m_values->m_info->m_bytes   -= found->second.m_bytes;
+                        m_values->m_info->m_entries -= 1;
+                        m_values->m_values.erase(found);
                     }
                 }
 
                 static void ClearManager(std::string whichPool = "")
                 {
-                    if (!whichPool.empty())
-                    {
 #ifdef NEKTAR_USE_THREAD_SAFETY
-                        WriteLock v_wlock(m_mutex);
+                    WriteLock v_wlock(m_mutex);
 #endif
+                    if (!whichPool.empty())
+                    {
                         auto x = m_ValueContainerPool.find(whichPool);
                         ASSERTL1(x != m_ValueContainerPool.end(),
                                 "Could not find pool " + whichPool);
-                        x->second->clear();
+                        ClearPool(*x->second);
                     }
                     else
                     {
-#ifdef NEKTAR_USE_THREAD_SAFETY
-                        WriteLock v_wlock(m_mutex);
-#endif
-
                         for (auto &x : m_ValueContainerPool)
                         {
-                            x.second->clear();
+                            ClearPool(*x.second);
                         }
                     }
                 }
 
                 static bool PoolCreated(std::string whichPool)
                 {
+#ifdef NEKTAR_USE_THREAD_SAFETY
+                    ReadLock v_rlock(m_mutex);
+#endif
                     bool value = false;
                     auto x = m_ValueContainerPool.find(whichPool);
                     if (x != m_ValueContainerPool.end())
@@ -320,7 +425,7 @@ namespace Nektar
                 NekManager<KeyType, ValueType, opLessCreator>& operator=(const NekManager<KeyType, ValueType, opLessCreator>& rhs);
                 NekManager(const NekManager<KeyType, ValueType, opLessCreator>& rhs);
 
-                ValueContainerShPtr m_values;
+                ValuePoolSharedPtr m_values;
                 BoolSharedPtr m_managementEnabled;
                 static ValueContainerPool m_ValueContainerPool;
                 static FlagContainerPool m_managementEnabledContainerPool;
@@ -329,6 +434,135 @@ namespace Nektar
 #ifdef NEKTAR_USE_THREAD_SAFETY
                 static boost::shared_mutex m_mutex;
 #endif
+
+                /// Attach this manager to the named pool, creating the pool
+                /// if necessary, or to a private pool if no name is given.
+                void InitialisePool(const std::string &whichPool)
+                {
+                    if (whichPool.empty())
+                    {
+                        m_values = ValuePoolSharedPtr(new ValuePool(whichPool));
+                        m_managementEnabled = BoolSharedPtr(new bool(true));
+                        return;
+                    }
+
+                    {
+#ifdef NEKTAR_USE_THREAD_SAFETY
+                        ReadLock v_rlock(m_mutex); // reading static members
+#endif
+                        auto iter = m_ValueContainerPool.find(whichPool);
+                        if (iter != m_ValueContainerPool.end())
+                        {
+                            m_values = iter->second;
+                            m_managementEnabled = m_managementEnabledContainerPool[whichPool];
+                            return;
+                        }
+                    }
+
+                    // Now writing static members. Apparently upgrade_lock
+                    // has less desirable properties than just dropping read
+                    // lock, grabbing write lock. Write will block until all
+                    // reads are done, but reads cannot be acquired if write
+                    // lock is blocking. In this context writes are supposed
+                    // to be rare.
+#ifdef NEKTAR_USE_THREAD_SAFETY
+                    WriteLock v_wlock(m_mutex);
+#endif
+                    ValuePoolSharedPtr &pool = m_ValueContainerPool[whichPool];
+                    if (!pool)
+                    {
+                        pool = ValuePoolSharedPtr(new ValuePool(whichPool));
+                    }
+                    m_values = pool;
+                    if (m_managementEnabledContainerPool.find(whichPool) == m_managementEnabledContainerPool.end())
+                    {
+                        m_managementEnabledContainerPool[whichPool] = BoolSharedPtr(new bool(true));
+                    }
+                    m_managementEnabled = m_managementEnabledContainerPool[whichPool];
+                }
+
+                /// Create the object for @p key with its create function.
+                ValueType CreateObject(const KeyType &key)
+                {
+                    CreateFuncType f = m_globalCreateFunc;
+                    auto keyFound = m_keySpecificCreateFuncs.find(key);
+                    if( keyFound != m_keySpecificCreateFuncs.end() )
+                    {
+                        f = (*keyFound).second;
+                    }
+
+                    if( f )
+                    {
+                        return f(key);
+                    }
+                    else
+                    {
+                        std::stringstream ss;
+                        ss << key;
+                        std::string message = "No create func found for key " + ss.str();
+                        NEKERROR(ErrorUtil::efatal, message.c_str());
+                        static ValueType result;
+                        return result;
+                    }
+                }
+
+                /// Discard the least recently used objects of @p pool, other
+                /// than @p keep, until it fits in its memory budget. The
+                /// pool must be locked for writing.
+                static void EvictObjects(
+                    ValuePool &pool, typename ValueContainer::iterator keep)
+                {
+                    NekManagerPoolInfo &info = *pool.m_info;
+                    size_t maxBytes = info.m_maxBytes.load();
+                    if (maxBytes == 0 || info.m_bytes.load() <= maxBytes)
+                    {
+                        return;
+                    }
+
+                    std::vector<std::pair<size_t,
+                        typename ValueContainer::iterator> > order;
+                    order.reserve(pool.m_values.size());
+                    for (auto it = pool.m_values.begin();
+                         it != pool.m_values.end(); ++it)
+                    {
+                        if (it != keep)
+                        {
+                            order.push_back(std::make_pair(
+                                it->second.m_lastUse.load(), it));
+                        }
+                    }
+                    std::sort(order.begin(), order.end(),
+                              [](const std::pair<size_t,
+                                     typename ValueContainer::iterator> &a,
+                                 const std::pair<size_t,
+                                     typename ValueContainer::iterator> &b)
+                              {
+                                  return a.first < b.first;
+                              });
+
+                    for (auto &x : order)
+                    {
+                        if (info.m_bytes.load() <= maxBytes)
+                        {
+                            break;
+                        }
+                        info.m_bytes     -= x.second->second.m_bytes;
+                        info.m_entries   -= 1;
+                        info.m_evictions += 1;
+                        pool.m_values.erase(x.second);
+                    }
+                }
+
+                /// Remove all objects of @p pool.
+                static void ClearPool(ValuePool &pool)
+                {
+#ifdef NEKTAR_USE_THREAD_SAFETY
+                    WriteLock v_wlock(pool.m_mutex);
+#endif
+                    pool.m_values.clear();
+                    pool.m_info->m_bytes   = 0;
+                    pool.m_info->m_entries = 0;
+                }
         };
         template <typename KeyType, typename ValueT, typename opLessCreator> typename NekManager<KeyType, ValueT, opLessCreator>::ValueContainerPool NekManager<KeyType, ValueT, opLessCreator>::m_ValueContainerPool;
         template <typename KeyType, typename ValueT, typename opLessCreator> typename NekManager<KeyType, ValueT, opLessCreator>::FlagContainerPool NekManager<KeyType, ValueT, opLessCreator>::m_managementEnabledContainerPool;
@@ -400,6 +400,10 @@ namespace Nektar
                 ("part-only-overlapping",    po::value<int>(),
                                  "only partition mesh into N overlapping partitions.")
                 ("part-info",    "Output partition information")
+                ("timing-regions", "print time spent in timing regions")
+                ("timing-json",  po::value<std::string>(),
+                                 "write timing regions to a JSON file")
+                ("manager-stats", "print memory held by matrix managers")
 #ifdef NEKTAR_USE_CWIPI
                 ("cwipi",        po::value<std::string>(),
                                  "set CWIPI name")
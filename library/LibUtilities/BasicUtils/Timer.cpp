@@ -32,13 +32,241 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <LibUtilities/BasicUtils/ErrorUtil.hpp>
 #include <LibUtilities/BasicUtils/Timer.h>
+#include <LibUtilities/Communication/Comm.h>
 
 namespace Nektar
 {
 namespace LibUtilities
 {
 
+namespace
+{
+
+/// Timing data accumulated locally for a single region.
+struct RegionData
+{
+    std::string   name;
+    int           parent;
+    NekDouble     elapsed;
+    unsigned long count;
+};
+
+/// Process-wide registry of timing regions.
+struct RegionRegistry
+{
+    std::mutex                              mutex;
+    std::vector<RegionData>                 regions;
+    std::map<std::pair<int, std::string>, int> index;
+};
+
+/// Timing data for a single region reduced across processes.
+struct RegionStats
+{
+    std::string name;
+    std::string path;
+    int         parent;
+    NekDouble   min;
+    NekDouble   avg;
+    NekDouble   max;
+    NekDouble   calls;
+    int         nProcs;
+};
+
+RegionRegistry &GetRegionRegistry()
+{
+    static RegionRegistry registry;
+    return registry;
+}
+
+/// Regions currently open on this thread, innermost last.
+thread_local std::vector<int> regionStack;
+
+/**
+ * Return the identifier of the region @p name below the innermost region
+ * open on this thread, creating it if required. The name may not contain
+ * '/', which separates the levels of region paths.
+ */
+int FindRegion(const std::string &name)
+{
+    ASSERTL0(name.find('/') == std::string::npos,
+             "Timer region name '" + name + "' may not contain '/'.");
+
+    int parent = regionStack.empty() ? -1 : regionStack.back();
+
+    RegionRegistry &reg = GetRegionRegistry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    auto it = reg.index.find(std::make_pair(parent, name));
+    if (it != reg.index.end())
+    {
+        return it->second;
+    }
+
+    int id = reg.regions.size();
+    reg.regions.push_back(RegionData{name, parent, 0.0, 0});
+    reg.index[std::make_pair(parent, name)] = id;
+    return id;
+}
+
+void AddToRegion(int id, NekDouble elapsed)
+{
+    RegionRegistry &reg = GetRegionRegistry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.regions[id].elapsed += elapsed;
+    reg.regions[id].count++;
+}
+
+/**
+ * Reduce the local region timings across all processes of @p comm. Regions
+ * are matched by their full path, so that a region need not be visited by
+ * every process. The minimum and average are taken over the processes which
+ * visited the region, and the number of calls is the maximum on any
+ * process.
+ */
+std::vector<RegionStats> ReduceRegions(CommSharedPtr comm)
+{
+    std::vector<RegionData> local;
+    {
+        RegionRegistry &reg = GetRegionRegistry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        local = reg.regions;
+    }
+
+    // Full paths of the local regions; parents always precede children.
+    std::vector<std::string> localPaths(local.size());
+    std::vector<char> sendBuf;
+    for (int i = 0; i < local.size(); ++i)
+    {
+        localPaths[i] = local[i].parent < 0 ? local[i].name :
+            localPaths[local[i].parent] + "/" + local[i].name;
+        sendBuf.insert(sendBuf.end(), localPaths[i].begin(),
+                       localPaths[i].end());
+        sendBuf.push_back('\n');
+    }
+    // Terminate the list, which also guarantees a non-empty buffer.
+    sendBuf.push_back('\n');
+
+    // Gather the paths of all processes to form the union of regions.
+    std::vector<char> recvBuf = sendBuf;
+    int nProc = comm->GetSize();
+    if (nProc > 1)
+    {
+        std::vector<int> size(1, sendBuf.size()), sizes(nProc);
+        comm->AllGather(size, sizes);
+
+        Array<OneD, int> sizeMap(nProc), offsetMap(nProc, 0);
+        for (int i = 0; i < nProc; ++i)
+        {
+            sizeMap[i] = sizes[i];
+            if (i > 0)
+            {
+                offsetMap[i] = offsetMap[i-1] + sizeMap[i-1];
+            }
+        }
+
+        recvBuf.resize(offsetMap[nProc-1] + sizeMap[nProc-1]);
+        comm->AllGatherv(sendBuf, recvBuf, sizeMap, offsetMap);
+    }
+
+    std::vector<RegionStats> stats;
+    std::map<std::string, int> pathIndex;
+    std::string path;
+    for (char c : recvBuf)
+    {
+        if (c != '\n')
+        {
+            path += c;
+            continue;
+        }
+
+        if (!path.empty() && pathIndex.find(path) == pathIndex.end())
+        {
+            RegionStats s;
+            size_t sep = path.rfind('/');
+            s.path   = path;
+            s.name   = sep == std::string::npos ? path : path.substr(sep + 1);
+            s.parent = sep == std::string::npos ? -1 :
+                pathIndex[path.substr(0, sep)];
+            pathIndex[path] = stats.size();
+            stats.push_back(s);
+        }
+        path.clear();
+    }
+
+    int n = stats.size();
+    std::vector<NekDouble> tMin(n, std::numeric_limits<NekDouble>::max());
+    std::vector<NekDouble> tMax(n, 0.0), calls(n, 0.0), sums(2 * n, 0.0);
+    for (int i = 0; i < local.size(); ++i)
+    {
+        int j    = pathIndex[localPaths[i]];
+        tMin[j]  = local[i].elapsed;
+        tMax[j]  = local[i].elapsed;
+        calls[j] = local[i].count;
+        sums[j]     = local[i].elapsed;
+        sums[n + j] = 1.0;
+    }
+
+    if (n > 0)
+    {
+        comm->AllReduce(tMin,  ReduceMin);
+        comm->AllReduce(tMax,  ReduceMax);
+        comm->AllReduce(calls, ReduceMax);
+        comm->AllReduce(sums,  ReduceSum);
+    }
+
+    for (int i = 0; i < n; ++i)
+    {
+        stats[i].min    = tMin[i];
+        stats[i].max    = tMax[i];
+        stats[i].calls  = calls[i];
+        stats[i].nProcs = static_cast<int>(sums[n + i] + 0.5);
+        stats[i].avg    = sums[i] / std::max(stats[i].nProcs, 1);
+    }
+
+    return stats;
+}
+
+/// Order regions depth-first, with children in order of first use.
+void SortRegions(const std::vector<RegionStats> &stats, int parent,
+                 int depth, std::vector<std::pair<int, int> > &order)
+{
+    for (int i = 0; i < stats.size(); ++i)
+    {
+        if (stats[i].parent == parent)
+        {
+            order.push_back(std::make_pair(i, depth));
+            SortRegions(stats, i, depth + 1, order);
+        }
+    }
+}
+
+std::string JsonEscape(const std::string &str)
+{
+    std::string out;
+    for (char c : str)
+    {
+        if (c == '"' || c == '\\')
+        {
+            out += '\\';
+        }
+        out += c;
+    }
+    return out;
+}
+
+}
+
 void Timer::Start()
 {
     m_start = Clock::now();
@@ -59,5 +287,127 @@ NekDouble Timer::TimePerTest(unsigned int n)
     return Elapsed().count() / static_cast<NekDouble>(n);
 }
 
+/**
+ * The region is nested below the innermost TimerRegion open on the calling
+ * thread, if any.
+ */
+void Timer::AccumulateRegion(const std::string &region)
+{
+    AddToRegion(FindRegion(region), Elapsed().count());
+}
+
+void Timer::PrintElapsedRegions(CommSharedPtr comm)
+{
+    PrintElapsedRegions(comm, std::cout);
+}
+
+/**
+ * Each process must call this routine. The table is printed on the root
+ * process only, with nested regions indented below their parent.
+ */
+void Timer::PrintElapsedRegions(CommSharedPtr comm, std::ostream &o)
+{
+    std::vector<RegionStats> stats = ReduceRegions(comm);
+
+    if (comm->GetRank() != 0 || stats.empty())
+    {
+        return;
+    }
+
+    std::vector<std::pair<int, int> > order;
+    SortRegions(stats, -1, 0, order);
+
+    const int nameWidth = 40;
+    std::ios::fmtflags flags = o.flags();
+
+    o << "-------------------------------------------" << std::endl;
+    o << "Timing regions (" << comm->GetSize() << " processes)" << std::endl;
+    o << std::left  << std::setw(nameWidth) << "Region"
+      << std::right << std::setw(10) << "Calls"
+      << std::setw(12) << "Min (s)"
+      << std::setw(12) << "Avg (s)"
+      << std::setw(12) << "Max (s)" << std::endl;
+
+    for (auto &entry : order)
+    {
+        const RegionStats &s = stats[entry.first];
+        std::string name = std::string(2 * entry.second, ' ') + s.name;
+
+        o << std::left  << std::setw(nameWidth) << name
+          << std::right << std::setw(10)
+          << static_cast<unsigned long>(s.calls)
+          << std::scientific << std::setprecision(4)
+          << std::setw(12) << s.min
+          << std::setw(12) << s.avg
+          << std::setw(12) << s.max << std::endl;
+        o.flags(flags);
+    }
+    o << "-------------------------------------------" << std::endl;
+}
+
+/**
+ * Each process must call this routine; the file is written by the root
+ * process only. Regions are written as a flat list, identified by their
+ * full path with nested region names separated by '/'.
+ */
+void Timer::WriteElapsedRegions(CommSharedPtr comm, const std::string &filename)
+{
+    std::vector<RegionStats> stats = ReduceRegions(comm);
+
+    if (comm->GetRank() != 0)
+    {
+        return;
+    }
+
+    std::ofstream out(filename);
+    ASSERTL0(out.good(), "Unable to open timing file " + filename);
+
+    std::vector<std::pair<int, int> > order;
+    SortRegions(stats, -1, 0, order);
+
+    out << std::setprecision(9);
+    out << "{" << std::endl;
+    out << "  \"processes\": " << comm->GetSize() << "," << std::endl;
+    out << "  \"regions\": [";
+    for (int i = 0; i < order.size(); ++i)
+    {
+        const RegionStats &s = stats[order[i].first];
+        out << (i > 0 ? "," : "") << std::endl;
+        out << "    { \"path\": \"" << JsonEscape(s.path) << "\", "
+            << "\"depth\": " << order[i].second << ", "
+            << "\"calls\": " << static_cast<unsigned long>(s.calls) << ", "
+            << "\"processes\": " << s.nProcs << ", "
+            << "\"min\": " << s.min << ", "
+            << "\"avg\": " << s.avg << ", "
+            << "\"max\": " << s.max << " }";
+    }
+    out << std::endl << "  ]" << std::endl << "}" << std::endl;
+}
+
+void Timer::ResetRegions()
+{
+    RegionRegistry &reg = GetRegionRegistry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (auto &region : reg.regions)
+    {
+        region.elapsed = 0.0;
+        region.count   = 0;
+    }
+}
+
+TimerRegion::TimerRegion(const std::string &name)
+    : m_id(FindRegion(name))
+{
+    regionStack.push_back(m_id);
+    m_timer.Start();
+}
+
+TimerRegion::~TimerRegion()
+{
+    m_timer.Stop();
+    regionStack.pop_back();
+    AddToRegion(m_id, m_timer.Elapsed().count());
+}
+
 }
 }
@@ -37,6 +37,9 @@
 #define NEKTAR_LIB_UTILITIES_BASIC_UTILS_TIMER_H
 
 #include <chrono>
+#include <iosfwd>
+#include <memory>
+#include <string>
 
 #include <LibUtilities/LibUtilitiesDeclspec.h>
 #include <LibUtilities/BasicConst/NektarUnivConsts.hpp>
@@ -46,6 +49,19 @@ namespace Nektar
 namespace LibUtilities
 {
 
+class Comm;
+typedef std::shared_ptr<Comm> CommSharedPtr;
+
+/**
+ * @brief Simple wall-clock timer, which also provides a process-wide
+ * registry of named timing regions.
+ *
+ * Elapsed times may be accumulated into a region with AccumulateRegion, or
+ * by using the scoped TimerRegion class. Regions opened while another
+ * TimerRegion is active on the same thread are nested below it. The
+ * accumulated times and call counts are reduced across processes by
+ * PrintElapsedRegions and WriteElapsedRegions.
+ */
 class Timer
 {
     public:
@@ -68,11 +84,53 @@ class Timer
         ///        a test with n iterations.
         LIB_UTILITIES_EXPORT NekDouble TimePerTest(unsigned int n);
 
+        /// Add the elapsed time of this timer to the named region.
+        LIB_UTILITIES_EXPORT void AccumulateRegion(const std::string &region);
+
+        /// Print the minimum, average and maximum time spent in each region
+        /// across all processes of @p comm to standard output (collective).
+        LIB_UTILITIES_EXPORT static void PrintElapsedRegions(
+            CommSharedPtr comm);
+
+        /// Print the region timings across all processes of @p comm to
+        /// @p o (collective).
+        LIB_UTILITIES_EXPORT static void PrintElapsedRegions(
+            CommSharedPtr comm, std::ostream &o);
+
+        /// Write the region timings across all processes of @p comm to a
+        /// JSON file (collective).
+        LIB_UTILITIES_EXPORT static void WriteElapsedRegions(
+            CommSharedPtr comm, const std::string &filename);
+
+        /// Discard all accumulated region timings.
+        LIB_UTILITIES_EXPORT static void ResetRegions();
+
     private:
         CounterType m_start;
         CounterType m_end;
 };
 
+/**
+ * @brief Times the enclosing scope and accumulates the result into a named
+ * region of the Timer registry.
+ *
+ * Regions created while this object is alive on the same thread are
+ * reported as children of this region.
+ */
+class TimerRegion
+{
+    public:
+        LIB_UTILITIES_EXPORT TimerRegion(const std::string &name);
+        LIB_UTILITIES_EXPORT ~TimerRegion();
+
+        TimerRegion(const TimerRegion& rhs)            = delete;
+        TimerRegion& operator=(const TimerRegion& rhs) = delete;
+
+    private:
+        Timer m_timer;
+        int   m_id;
+};
+
 }
 }
 
@@ -77,6 +77,23 @@ const char* const ReduceOperatorMap[] =
     "ReduceMin"
 };
 
+/// Class for a set of outstanding non-blocking communications. Derived
+/// communicators hold the handles of their own implementation.
+class CommRequest
+{
+public:
+    CommRequest()
+    {
+    }
+
+    virtual ~CommRequest()
+    {
+    }
+};
+
+/// Pointer to a CommRequest object.
+typedef std::shared_ptr<CommRequest> CommRequestSharedPtr;
+
 /// Base communications class
 class Comm : public std::enable_shared_from_this<Comm>
 {
@@ -103,8 +120,21 @@ public:
     void SendRecv(int pSendProc, T &pSendData, int pRecvProc, T &pRecvData);
     template <class T>
     void SendRecvReplace(int pSendProc, int pRecvProc, T &pData);
+    template <class T>
+    void Isend(int pProc, T &pData, int count,
+               const CommRequestSharedPtr &request, int loc);
+    template <class T>
+    void Irecv(int pProc, T &pData, int count,
+               const CommRequestSharedPtr &request, int loc);
 
     template <class T> void AllReduce(T &pData, enum ReduceOperator pOp);
+    template <class T>
+    void IAllReduce(T &pData, enum ReduceOperator pOp,
+                    const CommRequestSharedPtr &request, int loc = 0);
+
+    LIB_UTILITIES_EXPORT inline CommRequestSharedPtr CreateRequest(int num);
+    LIB_UTILITIES_EXPORT inline void WaitAll(
+        const CommRequestSharedPtr &request);
 
     template <class T> void AlltoAll(T &pSendData, T &pRecvData);
     template <class T1, class T2>
@@ -114,6 +144,14 @@ public:
                    T1 &pRecvData,
                    T2 &pRecvDataSizeMap,
                    T2 &pRecvDataOffsetMap);
+    template <class T1, class T2>
+    void IAlltoAllv(T1 &pSendData,
+                    T2 &pSendDataSizeMap,
+                    T2 &pSendDataOffsetMap,
+                    T1 &pRecvData,
+                    T2 &pRecvDataSizeMap,
+                    T2 &pRecvDataOffsetMap,
+                    const CommRequestSharedPtr &request, int loc = 0);
 
     template <class T> void AllGather(T &pSendData, T &pRecvData);
     template <class T>
@@ -163,8 +201,18 @@ protected:
                             CommDataType recvtype, int source) = 0;
     virtual void v_SendRecvReplace(void *buf, int count, CommDataType dt,
                                    int pSendProc, int pRecvProc) = 0;
+    virtual void v_Isend(void *buf, int count, CommDataType dt, int dest,
+                         const CommRequestSharedPtr &request, int loc) = 0;
+    virtual void v_Irecv(void *buf, int count, CommDataType dt, int source,
+                         const CommRequestSharedPtr &request, int loc) = 0;
     virtual void v_AllReduce(void *buf, int count, CommDataType dt,
                              enum ReduceOperator pOp) = 0;
+    virtual void v_IAllReduce(void *buf, int count, CommDataType dt,
+                              enum ReduceOperator pOp,
+                              const CommRequestSharedPtr &request,
+                              int loc) = 0;
+    virtual CommRequestSharedPtr v_CreateRequest(int num) = 0;
+    virtual void v_WaitAll(const CommRequestSharedPtr &request) = 0;
     virtual void v_AlltoAll(void *sendbuf, int sendcount, CommDataType sendtype,
                             void *recvbuf, int recvcount,
                             CommDataType recvtype) = 0;
@@ -172,6 +220,12 @@ protected:
                              CommDataType sendtype, void *recvbuf,
                              int recvcounts[], int rdispls[],
                              CommDataType recvtype) = 0;
+    virtual void v_IAlltoAllv(void *sendbuf, int sendcounts[], int sdispls[],
+                              CommDataType sendtype, void *recvbuf,
+                              int recvcounts[], int rdispls[],
+                              CommDataType recvtype,
+                              const CommRequestSharedPtr &request,
+                              int loc) = 0;
     virtual void v_AllGather(void *sendbuf, int sendcount, CommDataType sendtype,
                              void *recvbuf, int recvcount,
                              CommDataType recvtype) = 0;
@@ -289,6 +343,32 @@ void Comm::SendRecvReplace(int pSendProc, int pRecvProc, T &pData)
                       pRecvProc);
 }
 
+/**
+ * Start sending the first count entries of pData to process pProc without
+ * waiting for the send to complete. pData must not be modified until
+ * WaitAll has been called on the request.
+ */
+template <class T>
+void Comm::Isend(int pProc, T &pData, int count,
+                 const CommRequestSharedPtr &request, int loc)
+{
+    v_Isend(CommDataTypeTraits<T>::GetPointer(pData), count,
+            CommDataTypeTraits<T>::GetDataType(), pProc, request, loc);
+}
+
+/**
+ * Start receiving count entries of pData from process pProc without waiting
+ * for the data to arrive. pData only holds the received data once WaitAll
+ * has been called on the request.
+ */
+template <class T>
+void Comm::Irecv(int pProc, T &pData, int count,
+                 const CommRequestSharedPtr &request, int loc)
+{
+    v_Irecv(CommDataTypeTraits<T>::GetPointer(pData), count,
+            CommDataTypeTraits<T>::GetDataType(), pProc, request, loc);
+}
+
 /**
  *
  */
@@ -299,6 +379,39 @@ template <class T> void Comm::AllReduce(T &pData, enum ReduceOperator pOp)
                 CommDataTypeTraits<T>::GetDataType(), pOp);
 }
 
+/**
+ * Start a reduction of pData across all processes without waiting for it to
+ * complete. The result is only available in pData, which must not be
+ * modified, once WaitAll has been called on the request.
+ *
+ * @param request  Request created with CreateRequest.
+ * @param loc      Index of the communication within the request.
+ */
+template <class T>
+void Comm::IAllReduce(T &pData, enum ReduceOperator pOp,
+                      const CommRequestSharedPtr &request, int loc)
+{
+    v_IAllReduce(CommDataTypeTraits<T>::GetPointer(pData),
+                 CommDataTypeTraits<T>::GetCount(pData),
+                 CommDataTypeTraits<T>::GetDataType(), pOp, request, loc);
+}
+
+/**
+ * Create a request able to hold num non-blocking communications.
+ */
+inline CommRequestSharedPtr Comm::CreateRequest(int num)
+{
+    return v_CreateRequest(num);
+}
+
+/**
+ * Wait for all communications started on the request to complete.
+ */
+inline void Comm::WaitAll(const CommRequestSharedPtr &request)
+{
+    v_WaitAll(request);
+}
+
 template <class T> void Comm::AlltoAll(T &pSendData, T &pRecvData)
 {
     static_assert(
@@ -348,6 +461,41 @@ void Comm::AlltoAllv(T1 &pSendData,
         CommDataTypeTraits<T1>::GetDataType());
 }
 
+/**
+ * Starts a non-blocking AlltoAllv on the given request. Neither buffer, nor
+ * the size and offset maps, may be modified or released until WaitAll has
+ * been called on the request.
+ *
+ * @param request  Request created with CreateRequest.
+ * @param loc      Index of the communication within the request.
+ */
+template <class T1, class T2>
+void Comm::IAlltoAllv(T1 &pSendData,
+                      T2 &pSendDataSizeMap,
+                      T2 &pSendDataOffsetMap,
+                      T1 &pRecvData,
+                      T2 &pRecvDataSizeMap,
+                      T2 &pRecvDataOffsetMap,
+                      const CommRequestSharedPtr &request, int loc)
+{
+    static_assert(
+        CommDataTypeTraits<T1>::IsVector,
+        "IAlltoAllv only valid with Array or vector arguments.");
+    static_assert(
+        std::is_same<T2, std::vector<int>>::value ||
+        std::is_same<T2, Array<OneD, int>>::value,
+        "IAlltoAllv size and offset maps should be integer vectors.");
+    v_IAlltoAllv(
+        CommDataTypeTraits<T1>::GetPointer(pSendData),
+        (int *)CommDataTypeTraits<T2>::GetPointer(pSendDataSizeMap),
+        (int *)CommDataTypeTraits<T2>::GetPointer(pSendDataOffsetMap),
+        CommDataTypeTraits<T1>::GetDataType(),
+        CommDataTypeTraits<T1>::GetPointer(pRecvData),
+        (int *)CommDataTypeTraits<T2>::GetPointer(pRecvDataSizeMap),
+        (int *)CommDataTypeTraits<T2>::GetPointer(pRecvDataOffsetMap),
+        CommDataTypeTraits<T1>::GetDataType(), request, loc);
+}
+
 template <class T> void Comm::AllGather(T &pSendData, T &pRecvData)
 {
     BOOST_STATIC_ASSERT_MSG(
@@ -36,6 +36,8 @@
 #include "petscsys.h"
 #endif
 
+#include <boost/core/ignore_unused.hpp>
+
 #include <LibUtilities/BasicUtils/SharedArray.hpp>
 #include <LibUtilities/Communication/CommMpi.h>
 
@@ -46,6 +48,23 @@ namespace LibUtilities
 std::string CommMpi::className = GetCommFactory().RegisterCreatorFunction(
     "ParallelMPI", CommMpi::create, "Parallel communication using MPI.");
 
+/**
+ * Returns the MPI operation corresponding to a reduction operator.
+ */
+static MPI_Op GetMpiOp(enum ReduceOperator pOp)
+{
+    switch (pOp)
+    {
+        case ReduceMax:
+            return MPI_MAX;
+        case ReduceMin:
+            return MPI_MIN;
+        case ReduceSum:
+        default:
+            return MPI_SUM;
+    }
+}
+
 /**
  *
  */
@@ -230,6 +249,34 @@ void CommMpi::v_SendRecvReplace(void *buf, int count, CommDataType dt,
              "MPI error performing Send-Receive-Replace of data.");
 }
 
+/**
+ *
+ */
+void CommMpi::v_Isend(void *buf, int count, CommDataType dt, int dest,
+                      const CommRequestSharedPtr &request, int loc)
+{
+    CommRequestMpiSharedPtr req =
+        std::static_pointer_cast<CommRequestMpi>(request);
+    int retval = MPI_Isend(buf, count, dt, dest, 0, m_comm,
+                           req->GetRequest(loc));
+
+    ASSERTL0(retval == MPI_SUCCESS, "MPI error performing Isend.");
+}
+
+/**
+ *
+ */
+void CommMpi::v_Irecv(void *buf, int count, CommDataType dt, int source,
+                      const CommRequestSharedPtr &request, int loc)
+{
+    CommRequestMpiSharedPtr req =
+        std::static_pointer_cast<CommRequestMpi>(request);
+    int retval = MPI_Irecv(buf, count, dt, source, 0, m_comm,
+                           req->GetRequest(loc));
+
+    ASSERTL0(retval == MPI_SUCCESS, "MPI error performing Irecv.");
+}
+
 /**
  *
  */
@@ -241,25 +288,60 @@ void CommMpi::v_AllReduce(void *buf, int count, CommDataType dt,
         return;
     }
 
-    MPI_Op vOp;
-    switch (pOp)
+    int retval = MPI_Allreduce(MPI_IN_PLACE, buf, count, dt,
+                               GetMpiOp(pOp), m_comm);
+
+    ASSERTL0(retval == MPI_SUCCESS, "MPI error performing All-reduce.");
+}
+
+/**
+ * Starts an in-place reduction with MPI_Iallreduce. With an MPI library
+ * older than version 3 the reduction is performed immediately.
+ */
+void CommMpi::v_IAllReduce(void *buf, int count, CommDataType dt,
+                           enum ReduceOperator pOp,
+                           const CommRequestSharedPtr &request, int loc)
+{
+    if (GetSize() == 1)
     {
-        case ReduceMax:
-            vOp = MPI_MAX;
-            break;
-        case ReduceMin:
-            vOp = MPI_MIN;
-            break;
-        case ReduceSum:
-        default:
-            vOp = MPI_SUM;
-            break;
+        return;
     }
-    int retval = MPI_Allreduce(MPI_IN_PLACE, buf, count, dt, vOp, m_comm);
+
+#if MPI_VERSION >= 3
+    CommRequestMpiSharedPtr req =
+        std::static_pointer_cast<CommRequestMpi>(request);
+    int retval = MPI_Iallreduce(MPI_IN_PLACE, buf, count, dt, GetMpiOp(pOp),
+                                m_comm, req->GetRequest(loc));
+#else
+    boost::ignore_unused(request, loc);
+    int retval = MPI_Allreduce(MPI_IN_PLACE, buf, count, dt, GetMpiOp(pOp),
+                               m_comm);
+#endif
 
     ASSERTL0(retval == MPI_SUCCESS, "MPI error performing All-reduce.");
 }
 
+/**
+ *
+ */
+CommRequestSharedPtr CommMpi::v_CreateRequest(int num)
+{
+    return std::make_shared<CommRequestMpi>(num);
+}
+
+/**
+ *
+ */
+void CommMpi::v_WaitAll(const CommRequestSharedPtr &request)
+{
+    CommRequestMpiSharedPtr req =
+        std::static_pointer_cast<CommRequestMpi>(request);
+    int retval = MPI_Waitall(req->GetNumRequest(), req->GetRequest(0),
+                             MPI_STATUSES_IGNORE);
+
+    ASSERTL0(retval == MPI_SUCCESS, "MPI error waiting for requests.");
+}
+
 /**
  *
  */
@@ -286,6 +368,31 @@ void CommMpi::v_AlltoAllv(void *sendbuf, int sendcounts[], int sdispls[],
     ASSERTL0(retval == MPI_SUCCESS, "MPI error performing All-to-All-v.");
 }
 
+/**
+ * Starts an All-to-All-v with MPI_Ialltoallv. With an MPI library older
+ * than version 3 the exchange is performed immediately.
+ */
+void CommMpi::v_IAlltoAllv(void *sendbuf, int sendcounts[], int sdispls[],
+                           CommDataType sendtype, void *recvbuf,
+                           int recvcounts[], int rdispls[],
+                           CommDataType recvtype,
+                           const CommRequestSharedPtr &request, int loc)
+{
+#if MPI_VERSION >= 3
+    CommRequestMpiSharedPtr req =
+        std::static_pointer_cast<CommRequestMpi>(request);
+    int retval = MPI_Ialltoallv(sendbuf, sendcounts, sdispls, sendtype,
+                                recvbuf, recvcounts, rdispls, recvtype,
+                                m_comm, req->GetRequest(loc));
+#else
+    boost::ignore_unused(request, loc);
+    int retval = MPI_Alltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf,
+                               recvcounts, rdispls, recvtype, m_comm);
+#endif
+
+    ASSERTL0(retval == MPI_SUCCESS, "MPI error performing All-to-All-v.");
+}
+
 /**
  *
  */
@@ -36,6 +36,7 @@
 
 #include <mpi.h>
 #include <string>
+#include <vector>
 
 #include <LibUtilities/Communication/Comm.h>
 #include <LibUtilities/Memory/NekMemoryManager.hpp>
@@ -56,6 +57,34 @@ class CommMpi;
 /// Pointer to a Communicator object.
 typedef std::shared_ptr<CommMpi> CommMpiSharedPtr;
 
+/// Holds the MPI request handles of a set of non-blocking communications.
+class CommRequestMpi : public CommRequest
+{
+public:
+    CommRequestMpi(int num) : m_request(num, MPI_REQUEST_NULL)
+    {
+    }
+
+    virtual ~CommRequestMpi()
+    {
+    }
+
+    inline MPI_Request *GetRequest(int i)
+    {
+        return &m_request[i];
+    }
+
+    inline int GetNumRequest()
+    {
+        return m_request.size();
+    }
+
+private:
+    std::vector<MPI_Request> m_request;
+};
+
+typedef std::shared_ptr<CommRequestMpi> CommRequestMpiSharedPtr;
+
 /// A global linear system.
 class CommMpi : public Comm
 {
@@ -97,14 +126,28 @@ protected:
                             CommDataType recvtype, int source);
     virtual void v_SendRecvReplace(void *buf, int count, CommDataType dt,
                                    int pSendProc, int pRecvProc);
+    virtual void v_Isend(void *buf, int count, CommDataType dt, int dest,
+                         const CommRequestSharedPtr &request, int loc);
+    virtual void v_Irecv(void *buf, int count, CommDataType dt, int source,
+                         const CommRequestSharedPtr &request, int loc);
     virtual void v_AllReduce(void *buf, int count, CommDataType dt,
                              enum ReduceOperator pOp);
+    virtual void v_IAllReduce(void *buf, int count, CommDataType dt,
+                              enum ReduceOperator pOp,
+                              const CommRequestSharedPtr &request, int loc);
+    virtual CommRequestSharedPtr v_CreateRequest(int num);
+    virtual void v_WaitAll(const CommRequestSharedPtr &request);
     virtual void v_AlltoAll(void *sendbuf, int sendcount, CommDataType sendtype,
                             void *recvbuf, int recvcount, CommDataType recvtype);
     virtual void v_AlltoAllv(void *sendbuf, int sendcounts[], int sensdispls[],
                              CommDataType sendtype, void *recvbuf,
                              int recvcounts[], int rdispls[],
                              CommDataType recvtype);
+    virtual void v_IAlltoAllv(void *sendbuf, int sendcounts[], int sdispls[],
+                              CommDataType sendtype, void *recvbuf,
+                              int recvcounts[], int rdispls[],
+                              CommDataType recvtype,
+                              const CommRequestSharedPtr &request, int loc);
     virtual void v_AllGather(void *sendbuf, int sendcount, CommDataType sendtype,
                              void *recvbuf, int recvcount, CommDataType recvtype);
     virtual void v_AllGatherv(void *sendbuf, int sendcount, CommDataType sendtype,
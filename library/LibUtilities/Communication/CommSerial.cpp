@@ -145,6 +145,24 @@ void CommSerial::v_SendRecvReplace(void *buf, int count, CommDataType dt,
     boost::ignore_unused(buf, count, dt, pSendProc, pRecvProc);
 }
 
+/**
+ *
+ */
+void CommSerial::v_Isend(void *buf, int count, CommDataType dt, int dest,
+                         const CommRequestSharedPtr &request, int loc)
+{
+    boost::ignore_unused(buf, count, dt, dest, request, loc);
+}
+
+/**
+ *
+ */
+void CommSerial::v_Irecv(void *buf, int count, CommDataType dt, int source,
+                         const CommRequestSharedPtr &request, int loc)
+{
+    boost::ignore_unused(buf, count, dt, source, request, loc);
+}
+
 /**
  *
  */
@@ -154,6 +172,33 @@ void CommSerial::v_AllReduce(void *buf, int count, CommDataType dt,
     boost::ignore_unused(buf, count, dt, pOp);
 }
 
+/**
+ *
+ */
+void CommSerial::v_IAllReduce(void *buf, int count, CommDataType dt,
+                              enum ReduceOperator pOp,
+                              const CommRequestSharedPtr &request, int loc)
+{
+    boost::ignore_unused(buf, count, dt, pOp, request, loc);
+}
+
+/**
+ *
+ */
+CommRequestSharedPtr CommSerial::v_CreateRequest(int num)
+{
+    boost::ignore_unused(num);
+    return std::make_shared<CommRequest>();
+}
+
+/**
+ *
+ */
+void CommSerial::v_WaitAll(const CommRequestSharedPtr &request)
+{
+    boost::ignore_unused(request);
+}
+
 /**
  *
  */
@@ -176,6 +221,19 @@ void CommSerial::v_AlltoAllv(void *sendbuf, int sendcounts[], int senddispls[],
                          recvcounts, rdispls, recvtype);
 }
 
+/**
+ *
+ */
+void CommSerial::v_IAlltoAllv(void *sendbuf, int sendcounts[], int sdispls[],
+                              CommDataType sendtype, void *recvbuf,
+                              int recvcounts[], int rdispls[],
+                              CommDataType recvtype,
+                              const CommRequestSharedPtr &request, int loc)
+{
+    boost::ignore_unused(sendbuf, sendcounts, sdispls, sendtype, recvbuf,
+                         recvcounts, rdispls, recvtype, request, loc);
+}
+
 /**
  *
  */
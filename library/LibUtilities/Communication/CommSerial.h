@@ -85,9 +85,21 @@ protected:
                                                         CommDataType dt,
                                                         int pSendProc,
                                                         int pRecvProc);
+    LIB_UTILITIES_EXPORT virtual void v_Isend(
+        void *buf, int count, CommDataType dt, int dest,
+        const CommRequestSharedPtr &request, int loc);
+    LIB_UTILITIES_EXPORT virtual void v_Irecv(
+        void *buf, int count, CommDataType dt, int source,
+        const CommRequestSharedPtr &request, int loc);
     LIB_UTILITIES_EXPORT virtual void v_AllReduce(void *buf, int count,
                                                   CommDataType dt,
                                                   enum ReduceOperator pOp);
+    LIB_UTILITIES_EXPORT virtual void v_IAllReduce(
+        void *buf, int count, CommDataType dt, enum ReduceOperator pOp,
+        const CommRequestSharedPtr &request, int loc);
+    LIB_UTILITIES_EXPORT virtual CommRequestSharedPtr v_CreateRequest(int num);
+    LIB_UTILITIES_EXPORT virtual void v_WaitAll(
+        const CommRequestSharedPtr &request);
     LIB_UTILITIES_EXPORT virtual void v_AlltoAll(void *sendbuf, int sendcount,
                                                  CommDataType sendtype,
                                                  void *recvbuf, int recvcount,
@@ -96,6 +108,10 @@ protected:
         void *sendbuf, int sendcounts[], int sensdispls[],
         CommDataType sendtype, void *recvbuf, int recvcounts[], int rdispls[],
         CommDataType recvtype);
+    LIB_UTILITIES_EXPORT virtual void v_IAlltoAllv(
+        void *sendbuf, int sendcounts[], int sdispls[],
+        CommDataType sendtype, void *recvbuf, int recvcounts[], int rdispls[],
+        CommDataType recvtype, const CommRequestSharedPtr &request, int loc);
     LIB_UTILITIES_EXPORT virtual void v_AllGather(void *sendbuf, int sendcount,
                                                   CommDataType sendtype,
                                                   void *recvbuf, int recvcount,
@@ -32,6 +32,8 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+
 #include <boost/core/ignore_unused.hpp>
 
 #include <LibUtilities/Communication/Transposition.h>
@@ -261,6 +263,248 @@ void Transposition::Transpose(const Array<OneD, const NekDouble> &inarray,
     }
 }
 
+/**
+ * @brief Transpose several fields at once.
+ *
+ * For the homogeneous 1D transpositions eXYtoZ and eZtoXY all fields are
+ * exchanged in a single AlltoAllv, rather than one per field. Other
+ * directions transpose each field in turn.
+ */
+void Transposition::Transpose(
+    const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+    Array<OneD, Array<OneD, NekDouble> > &outarray,
+    bool UseNumMode, TranspositionDir dir)
+{
+    ASSERTL1(inarray.num_elements() == outarray.num_elements(),
+             "Inarray and outarray field counts differ");
+
+    if (m_num_processes[0] > 1 && (dir == eXYtoZ || dir == eZtoXY))
+    {
+        int npts = (dir == eXYtoZ ? inarray[0] : outarray[0]).num_elements()
+                   / m_num_points_per_proc[0];
+
+        TranspositionExchange exchange;
+        TransposeBegin(inarray, outarray, exchange, dir, 0,
+                       GetNumPencilsPerProc(npts), UseNumMode);
+        TransposeEnd(exchange);
+    }
+    else
+    {
+        for (int f = 0; f < inarray.num_elements(); ++f)
+        {
+            Transpose(inarray[f], outarray[f], UseNumMode, dir);
+        }
+    }
+}
+
+/**
+ * Number of pencils (points of a plane) each process holds in homogeneous
+ * ordering, given the number of points in a plane.
+ */
+int Transposition::GetNumPencilsPerProc(int numPointsPerPlane)
+{
+    return numPointsPerPlane / m_num_processes[0] +
+           (numPointsPerPlane % m_num_processes[0] > 0);
+}
+
+/**
+ * @brief Start a split-phase homogeneous 1D transposition of several fields.
+ *
+ * Only pencils [@a pencilStart, @a pencilStart + @a numPencils) of the block
+ * of pencils owned by each process are exchanged, so that a transposition
+ * may be split into chunks and each chunk processed as soon as it has
+ * arrived. The data of all fields is packed into a single non-blocking
+ * AlltoAllv. The fields must not be modified, and @a outarray not read,
+ * until TransposeEnd has been called on @a exchange.
+ *
+ * @param inarray     Fields to transpose.
+ * @param outarray    Storage for the transposed fields.
+ * @param exchange    State of the exchange, passed to TransposeEnd.
+ * @param dir         Either eXYtoZ or eZtoXY.
+ * @param pencilStart First pencil of the chunk on each process.
+ * @param numPencils  Number of pencils in the chunk.
+ * @param UseNumMode  Whether the homogeneous data is stored as modes.
+ */
+void Transposition::TransposeBegin(
+    const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+    Array<OneD, Array<OneD, NekDouble> > &outarray,
+    TranspositionExchange &exchange, TranspositionDir dir,
+    int pencilStart, int numPencils, bool UseNumMode)
+{
+    ASSERTL0(m_num_homogeneous_directions == 1 &&
+             (dir == eXYtoZ || dir == eZtoXY),
+             "Split-phase transposition only implemented for homogeneous "
+             "1D eXYtoZ and eZtoXY.");
+    ASSERTL1(inarray.num_elements() == outarray.num_elements(),
+             "Inarray and outarray field counts differ");
+
+    int nFields = inarray.num_elements();
+
+    exchange.m_dir         = dir;
+    exchange.m_useNumMode  = UseNumMode;
+    exchange.m_pencilStart = pencilStart;
+    exchange.m_numPencils  = numPencils;
+    exchange.m_in  = Array<OneD, Array<OneD, const NekDouble> >(nFields);
+    exchange.m_out = Array<OneD, Array<OneD, NekDouble> >(nFields);
+    for (int f = 0; f < nFields; ++f)
+    {
+        exchange.m_in [f] = inarray [f];
+        exchange.m_out[f] = outarray[f];
+    }
+
+    // In serial TransposeEnd copies directly between the fields.
+    if (m_num_processes[0] == 1)
+    {
+        return;
+    }
+
+    int nProc    = m_num_processes[0];
+    int nPlanes  = m_num_points_per_proc[0];
+    int npts     = (dir == eXYtoZ ? inarray[0] : outarray[0]).num_elements()
+                   / nPlanes;
+    int nPencils = GetNumPencilsPerProc(npts);
+    int packLen  = UseNumMode ? m_num_homogeneous_coeffs[0]
+                              : m_num_homogeneous_points[0];
+    int block    = nFields * nPlanes * numPencils;
+
+    if (exchange.m_sendBuf.num_elements() != nProc * block)
+    {
+        exchange.m_sendBuf = Array<OneD, NekDouble>(nProc * block);
+        exchange.m_recvBuf = Array<OneD, NekDouble>(nProc * block);
+    }
+    exchange.m_sizeMap   = Array<OneD, int>(nProc, block);
+    exchange.m_offsetMap = Array<OneD, int>(nProc, 0);
+
+    // Pack one block per process, ordered by field, plane and pencil. Points
+    // beyond the end of the plane or the packed length are padding.
+    NekDouble *send = exchange.m_sendBuf.get();
+    for (int p = 0; p < nProc; ++p)
+    {
+        exchange.m_offsetMap[p] = p * block;
+
+        for (int f = 0; f < nFields; ++f)
+        {
+            const NekDouble *in = inarray[f].get();
+
+            for (int l = 0; l < nPlanes; ++l)
+            {
+                if (dir == eXYtoZ)
+                {
+                    int start = p * nPencils + pencilStart;
+                    int len   = std::max(0, std::min(numPencils, npts - start));
+
+                    Vmath::Vcopy(len, in + l * npts + start, 1, send, 1);
+                    Vmath::Zero(numPencils - len, send + len, 1);
+                }
+                else
+                {
+                    int plane = p * nPlanes + l;
+
+                    if (plane < packLen)
+                    {
+                        Vmath::Vcopy(numPencils,
+                                     in + pencilStart * packLen + plane,
+                                     packLen, send, 1);
+                    }
+                    else
+                    {
+                        Vmath::Zero(numPencils, send, 1);
+                    }
+                }
+
+                send += numPencils;
+            }
+        }
+    }
+
+    exchange.m_request = m_hcomm->CreateRequest(1);
+    m_hcomm->IAlltoAllv(exchange.m_sendBuf, exchange.m_sizeMap,
+                        exchange.m_offsetMap, exchange.m_recvBuf,
+                        exchange.m_sizeMap, exchange.m_offsetMap,
+                        exchange.m_request);
+}
+
+/**
+ * @brief Complete a transposition started with TransposeBegin and unpack the
+ * received pencils into the output fields.
+ */
+void Transposition::TransposeEnd(TranspositionExchange &exchange)
+{
+    int nFields     = exchange.m_in.num_elements();
+    int nPlanes     = m_num_points_per_proc[0];
+    int pencilStart = exchange.m_pencilStart;
+    int numPencils  = exchange.m_numPencils;
+    int packLen     = exchange.m_useNumMode ? m_num_homogeneous_coeffs[0]
+                                            : m_num_homogeneous_points[0];
+    bool xyToZ      = exchange.m_dir == eXYtoZ;
+    int npts        = (xyToZ ? exchange.m_in[0] : exchange.m_out[0])
+                          .num_elements() / nPlanes;
+
+    if (m_num_processes[0] == 1)
+    {
+        int len = std::max(0, std::min(numPencils, npts - pencilStart));
+
+        for (int f = 0; f < nFields; ++f)
+        {
+            const NekDouble *in  = exchange.m_in [f].get();
+                  NekDouble *out = exchange.m_out[f].get();
+
+            for (int i = 0; i < packLen; ++i)
+            {
+                if (xyToZ)
+                {
+                    Vmath::Vcopy(len, in + i * npts + pencilStart, 1,
+                                 out + pencilStart * packLen + i, packLen);
+                }
+                else
+                {
+                    Vmath::Vcopy(len, in + pencilStart * packLen + i, packLen,
+                                 out + i * npts + pencilStart, 1);
+                }
+            }
+        }
+        return;
+    }
+
+    m_hcomm->WaitAll(exchange.m_request);
+
+    int nProc    = m_num_processes[0];
+    int nPencils = GetNumPencilsPerProc(npts);
+
+    const NekDouble *recv = exchange.m_recvBuf.get();
+    for (int p = 0; p < nProc; ++p)
+    {
+        for (int f = 0; f < nFields; ++f)
+        {
+            NekDouble *out = exchange.m_out[f].get();
+
+            for (int l = 0; l < nPlanes; ++l)
+            {
+                if (xyToZ)
+                {
+                    int plane = p * nPlanes + l;
+
+                    if (plane < packLen)
+                    {
+                        Vmath::Vcopy(numPencils, recv, 1,
+                                     out + pencilStart * packLen + plane,
+                                     packLen);
+                    }
+                }
+                else
+                {
+                    int start = p * nPencils + pencilStart;
+                    int len   = std::max(0, std::min(numPencils, npts - start));
+
+                    Vmath::Vcopy(len, recv, 1, out + l * npts + start, 1);
+                }
+
+                recv += numPencils;
+            }
+        }
+    }
+}
+
 /**
  * Homogeneous 1D transposition from SEM to Homogeneous ordering.
  */
@@ -65,6 +65,37 @@ enum TranspositionDir
     eNoTrans
 };
 
+/**
+ * @brief State of a split-phase transposition of several fields.
+ *
+ * Created by Transposition::TransposeBegin and completed by
+ * Transposition::TransposeEnd. The buffers and the input and output fields
+ * are held until the exchange has completed.
+ */
+struct TranspositionExchange
+{
+    /// Direction of the transposition.
+    TranspositionDir m_dir;
+    /// Whether the homogeneous data is packed as modes rather than points.
+    bool m_useNumMode;
+    /// First pencil, relative to the pencils of each process, exchanged.
+    int m_pencilStart;
+    /// Number of pencils per process exchanged.
+    int m_numPencils;
+    /// Fields being transposed.
+    Array<OneD, Array<OneD, const NekDouble> > m_in;
+    /// Fields receiving the transposed data.
+    Array<OneD, Array<OneD, NekDouble> > m_out;
+    /// Send and receive buffers, with one block per process.
+    Array<OneD, NekDouble> m_sendBuf;
+    Array<OneD, NekDouble> m_recvBuf;
+    /// MPI_Alltoallv size and offset maps of the buffers.
+    Array<OneD, int> m_sizeMap;
+    Array<OneD, int> m_offsetMap;
+    /// Request on which the exchange is running.
+    CommRequestSharedPtr m_request;
+};
+
 class Transposition
 {
 public:
@@ -98,6 +129,21 @@ public:
         Array<OneD, NekDouble> &outarray, bool UseNumMode = false,
         TranspositionDir dir = eNoTrans);
 
+    LIB_UTILITIES_EXPORT void Transpose(
+        const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+        Array<OneD, Array<OneD, NekDouble> > &outarray,
+        bool UseNumMode = false, TranspositionDir dir = eNoTrans);
+
+    LIB_UTILITIES_EXPORT int GetNumPencilsPerProc(int numPointsPerPlane);
+
+    LIB_UTILITIES_EXPORT void TransposeBegin(
+        const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+        Array<OneD, Array<OneD, NekDouble> > &outarray,
+        TranspositionExchange &exchange, TranspositionDir dir,
+        int pencilStart, int numPencils, bool UseNumMode = false);
+
+    LIB_UTILITIES_EXPORT void TransposeEnd(TranspositionExchange &exchange);
+
     LIB_UTILITIES_EXPORT void SetSpecVanVisc(Array<OneD, NekDouble> visc);
 
     LIB_UTILITIES_EXPORT NekDouble GetSpecVanVisc(const int k);
@@ -32,6 +32,8 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <boost/filesystem.hpp>
+
 #include <LibUtilities/FFT/NekFFTW.h>
 #include <LibUtilities/BasicUtils/VmathArray.hpp>
 #include <LibUtilities/BasicUtils/SharedArray.hpp>
@@ -44,6 +46,20 @@ namespace Nektar
             = GetNektarFFTFactory().RegisterCreatorFunction("NekFFTW",
                                                             NekFFTW::create);
 
+        /// Number of NekFFTW objects currently alive.
+        static int &NumInstances()
+        {
+            static int nInstances = 0;
+            return nInstances;
+        }
+
+        /// Whether plans have been measured since the wisdom was last saved.
+        static bool &WisdomPending()
+        {
+            static bool pending = false;
+            return pending;
+        }
+
         NekFFTW::NekFFTW(int N)
                 : NektarFFT(N)
         {
@@ -51,10 +67,18 @@ namespace Nektar
             phys = Array<OneD,NekDouble>(m_N);
             coef = Array<OneD,NekDouble>(m_N);
 
+            ImportWisdom();
+
             plan_forward  = fftw_plan_r2r_1d(m_N, &phys[0], &coef[0],
-                                             FFTW_R2HC, FFTW_ESTIMATE);
+                                             FFTW_R2HC, PlanFlags());
             plan_backward = fftw_plan_r2r_1d(m_N, &coef[0], &phys[0],
-                                             FFTW_HC2R, FFTW_ESTIMATE);
+                                             FFTW_HC2R, PlanFlags());
+
+            if (GetPlanRigour() != eFFTEstimate)
+            {
+                WisdomPending() = true;
+            }
+            ++NumInstances();
 
             m_FFTW_w = Array<OneD,NekDouble>(m_N);
             m_FFTW_w_inv = Array<OneD,NekDouble>(m_N);
@@ -75,7 +99,126 @@ namespace Nektar
         // Distructor
         NekFFTW::~NekFFTW()
         {
+            fftw_destroy_plan(plan_forward);
+            fftw_destroy_plan(plan_backward);
+
+            for (auto &it : m_batchPlans)
+            {
+                fftw_destroy_plan(it.second.plan_forward);
+                fftw_destroy_plan(it.second.plan_backward);
+            }
+
+            // Planning is over once the last transform is destroyed
+            if (--NumInstances() == 0)
+            {
+                ExportWisdom();
+            }
+        }
+
+        /**
+         * FFTW planner flags for the plan rigour set in NektarFFT.
+         */
+        unsigned int NekFFTW::PlanFlags()
+        {
+            switch (GetPlanRigour())
+            {
+                case eFFTMeasure:
+                    return FFTW_MEASURE;
+                case eFFTPatient:
+                    return FFTW_PATIENT;
+                case eFFTExhaustive:
+                    return FFTW_EXHAUSTIVE;
+                default:
+                    return FFTW_ESTIMATE;
+            }
+        }
+
+        /**
+         * Load the wisdom file, if one is set and it has not been loaded
+         * already, so that previously measured plans are reused.
+         */
+        void NekFFTW::ImportWisdom()
+        {
+            static std::string imported;
+
+            const std::string &file = GetWisdomFile();
+            if (file.empty() || file == imported)
+            {
+                return;
+            }
+
+            imported = file;
+            if (boost::filesystem::exists(file))
+            {
+                fftw_import_wisdom_from_filename(file.c_str());
+            }
+        }
+
+        /**
+         * Save the wisdom accumulated by measuring planners, if this process
+         * exports it. This is called when the last transform is destroyed,
+         * rather than after each plan, so that the file is written once per
+         * run. The wisdom is written to a unique temporary file which is
+         * then renamed, so that processes reading the file never see it
+         * partially written.
+         */
+        void NekFFTW::ExportWisdom()
+        {
+            const std::string &file = GetWisdomFile();
+            if (file.empty() || !WisdomPending() || !GetExportWisdom())
+            {
+                return;
+            }
 
+            WisdomPending() = false;
+
+            std::string tmp = file + "." +
+                boost::filesystem::unique_path().string();
+            if (fftw_export_wisdom_to_filename(tmp.c_str()))
+            {
+                boost::system::error_code ec;
+                boost::filesystem::rename(tmp, file, ec);
+                if (ec)
+                {
+                    boost::filesystem::remove(tmp, ec);
+                }
+            }
+        }
+
+        /**
+         * Get the plans transforming @a nTrans vectors with a single call to
+         * FFTW, creating them on first use.
+         */
+        NekFFTW::BatchPlan &NekFFTW::GetBatchPlan(const int nTrans)
+        {
+            auto it = m_batchPlans.find(nTrans);
+            if (it != m_batchPlans.end())
+            {
+                return it->second;
+            }
+
+            BatchPlan &plan = m_batchPlans[nTrans];
+            plan.phys = Array<OneD,NekDouble>(nTrans*m_N);
+            plan.coef = Array<OneD,NekDouble>(nTrans*m_N);
+
+            fftw_r2r_kind fwdKind = FFTW_R2HC;
+            fftw_r2r_kind bwdKind = FFTW_HC2R;
+
+            ImportWisdom();
+
+            plan.plan_forward  = fftw_plan_many_r2r(
+                1, &m_N, nTrans, &plan.phys[0], NULL, 1, m_N,
+                &plan.coef[0], NULL, 1, m_N, &fwdKind, PlanFlags());
+            plan.plan_backward = fftw_plan_many_r2r(
+                1, &m_N, nTrans, &plan.coef[0], NULL, 1, m_N,
+                &plan.phys[0], NULL, 1, m_N, &bwdKind, PlanFlags());
+
+            if (GetPlanRigour() != eFFTEstimate)
+            {
+                WisdomPending() = true;
+            }
+
+            return plan;
         }
 
         // Forward transformation
@@ -106,42 +249,91 @@ namespace Nektar
             Vmath::Vcopy(m_N, phys, 1, outarray, 1);
         }
 
+        // Batched forward transformation
+        void NekFFTW::v_FFTFwdTrans(
+                const int              nTrans,
+                Array<OneD,NekDouble> &inarray,
+                Array<OneD,NekDouble> &outarray)
+        {
+            BatchPlan &plan = GetBatchPlan(nTrans);
+
+            Vmath::Vcopy(nTrans*m_N, inarray, 1, plan.phys, 1);
+
+            fftw_execute(plan.plan_forward);
+
+            for (int i = 0; i < nTrans; ++i)
+            {
+                Reshuffle_FFTW2Nek(&plan.coef[i*m_N], &outarray[i*m_N]);
+            }
+        }
+
+        // Batched backward transformation
+        void NekFFTW::v_FFTBwdTrans(
+                const int              nTrans,
+                Array<OneD,NekDouble> &inarray,
+                Array<OneD,NekDouble> &outarray)
+        {
+            BatchPlan &plan = GetBatchPlan(nTrans);
+
+            for (int i = 0; i < nTrans; ++i)
+            {
+                Reshuffle_Nek2FFTW(&inarray[i*m_N], &plan.coef[i*m_N]);
+            }
+
+            fftw_execute(plan.plan_backward);
+
+            Vmath::Vcopy(nTrans*m_N, plan.phys, 1, outarray, 1);
+        }
+
         // Reshuffle FFTW2Nek
         void NekFFTW::Reshuffle_FFTW2Nek(Array<OneD,NekDouble> &coef)
+        {
+            Reshuffle_FFTW2Nek(&coef[0], &coef[0]);
+        }
+
+        // Reshuffle Nek2FFTW
+        void NekFFTW::Reshuffle_Nek2FFTW(Array<OneD,NekDouble> &coef)
+        {
+            Reshuffle_Nek2FFTW(&coef[0], &coef[0]);
+        }
+
+        // Reshuffle FFTW2Nek from in to out, which may coincide
+        void NekFFTW::Reshuffle_FFTW2Nek(const NekDouble *in, NekDouble *out)
         {
             int halfN = m_N/2;
 
-            m_wsp[1] = coef[halfN];
+            m_wsp[1] = in[halfN];
 
-            Vmath::Vcopy(halfN, coef, 1, m_wsp, 2);
+            Vmath::Vcopy(halfN, in, 1, &m_wsp[0], 2);
 
             for(int i = 0; i < (halfN - 1); i++)
             {
-                m_wsp[(m_N-1)-2*i] = coef[halfN+1+i];
+                m_wsp[(m_N-1)-2*i] = in[halfN+1+i];
             }
 
-            Vmath::Vmul(m_N, m_wsp, 1, m_FFTW_w, 1, coef, 1);
+            Vmath::Vmul(m_N, &m_wsp[0], 1, &m_FFTW_w[0], 1, out, 1);
 
             return;
         }
 
-        // Reshuffle Nek2FFTW
-        void NekFFTW::Reshuffle_Nek2FFTW(Array<OneD,NekDouble> &coef)
+        // Reshuffle Nek2FFTW from in to out, which may coincide
+        void NekFFTW::Reshuffle_Nek2FFTW(const NekDouble *in, NekDouble *out)
         {
             int halfN = m_N/2;
 
-            Vmath::Vmul(m_N, coef, 1, m_FFTW_w_inv, 1, coef, 1);
-
-            m_wsp[halfN] = coef[1];
+            m_wsp[halfN] = in[1] * m_FFTW_w_inv[1];
 
-            Vmath::Vcopy(halfN, coef, 2, m_wsp, 1);
+            for(int i = 0; i < halfN; i++)
+            {
+                m_wsp[i] = in[2*i] * m_FFTW_w_inv[2*i];
+            }
 
             for(int i = 0; i < (halfN-1); i++)
             {
-                m_wsp[halfN+1+i] = coef[(m_N-1)-2*i];
+                m_wsp[halfN+1+i] = in[(m_N-1)-2*i] * m_FFTW_w_inv[(m_N-1)-2*i];
             }
 
-            Vmath::Smul(m_N, 1.0/m_N, m_wsp, 1, coef, 1);
+            Vmath::Smul(m_N, 1.0/m_N, &m_wsp[0], 1, out, 1);
 
             return;
         }
@@ -45,6 +45,8 @@
 
 #include <fftw3.h>
 
+#include <map>
+
 namespace Nektar
 {
     template <typename Dim, typename DataType>
@@ -81,10 +83,20 @@ namespace Nektar
 			virtual void v_FFTFwdTrans(Array<OneD,NekDouble> &inarray, Array<OneD,NekDouble> &outarray);
 			
 			virtual void v_FFTBwdTrans(Array<OneD,NekDouble> &inarray, Array<OneD,NekDouble> &outarray);
-			
-			
+
+			virtual void v_FFTFwdTrans(const int nTrans, Array<OneD,NekDouble> &inarray, Array<OneD,NekDouble> &outarray);
+
+			virtual void v_FFTBwdTrans(const int nTrans, Array<OneD,NekDouble> &inarray, Array<OneD,NekDouble> &outarray);
 			
 		protected:
+			/// Plans and storage transforming several vectors at once.
+			struct BatchPlan
+			{
+				Array<OneD,NekDouble> phys;
+				Array<OneD,NekDouble> coef;
+				fftw_plan             plan_forward;
+				fftw_plan             plan_backward;
+			};
 			
 			Array<OneD,NekDouble> m_FFTW_w;  // weights to convert arrays form Nektar++ to FFTW format
 			Array<OneD,NekDouble> m_FFTW_w_inv; // weights to convert arrays from FFTW to Nektar++ format
@@ -96,6 +108,15 @@ namespace Nektar
 
 			fftw_plan plan_backward;         // plan to execute a backward FFT in FFTW
 			fftw_plan plan_forward;          // plan to execute a forward FFT in FFTW
+
+			std::map<int, BatchPlan> m_batchPlans; // plans for batched FFTs, by number of vectors
+
+			BatchPlan &GetBatchPlan(const int nTrans);
+
+			static unsigned int PlanFlags();
+			static void ImportWisdom();
+			static void ExportWisdom();
+
 			/**
 			 * Reshuffling routines to put the coefficients in Nektar++/FFTW format.
 			 * The routines take as an input the number of points N, the vector of coeffcients
@@ -105,6 +126,10 @@ namespace Nektar
 			void Reshuffle_FFTW2Nek(Array<OneD,NekDouble> &coef);
 			
 			void Reshuffle_Nek2FFTW(Array<OneD,NekDouble> &coef);
+
+			void Reshuffle_FFTW2Nek(const NekDouble *in, NekDouble *out);
+
+			void Reshuffle_Nek2FFTW(const NekDouble *in, NekDouble *out);
 			
 			
 
@@ -32,9 +32,12 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <boost/algorithm/string/predicate.hpp>
 #include <boost/core/ignore_unused.hpp>
 
 #include <LibUtilities/FFT/NektarFFT.h>
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
 
 namespace Nektar
 {
@@ -98,6 +101,129 @@ namespace Nektar
 		{
             boost::ignore_unused(coef, phys);
 		}
+
+		void NektarFFT::FFTFwdTrans(const int nTrans, Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef)
+		{
+			v_FFTFwdTrans(nTrans,phys,coef);
+		}
+
+		void NektarFFT::FFTBwdTrans(const int nTrans, Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys)
+		{
+			v_FFTBwdTrans(nTrans,coef,phys);
+		}
+
+		/**
+		 * By default each vector is transformed in turn.
+		 */
+		void NektarFFT::v_FFTFwdTrans(const int nTrans, Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef)
+		{
+			Array<OneD,NekDouble> tmpIn, tmpOut;
+			for (int i = 0; i < nTrans; ++i)
+			{
+				v_FFTFwdTrans(tmpIn = phys + i*m_N, tmpOut = coef + i*m_N);
+			}
+		}
+
+		void NektarFFT::v_FFTBwdTrans(const int nTrans, Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys)
+		{
+			Array<OneD,NekDouble> tmpIn, tmpOut;
+			for (int i = 0; i < nTrans; ++i)
+			{
+				v_FFTBwdTrans(tmpIn = coef + i*m_N, tmpOut = phys + i*m_N);
+			}
+		}
+
+		static FFTPlanRigour &PlanRigour()
+		{
+			static FFTPlanRigour rigour = eFFTEstimate;
+			return rigour;
+		}
+
+		static std::string &WisdomFile()
+		{
+			static std::string file;
+			return file;
+		}
+
+		static bool &ExportWisdom()
+		{
+			static bool exportWisdom = true;
+			return exportWisdom;
+		}
+
+		void NektarFFT::SetPlanRigour(FFTPlanRigour rigour)
+		{
+			PlanRigour() = rigour;
+		}
+
+		FFTPlanRigour NektarFFT::GetPlanRigour()
+		{
+			return PlanRigour();
+		}
+
+		void NektarFFT::SetWisdomFile(const std::string &file)
+		{
+			WisdomFile() = file;
+		}
+
+		const std::string &NektarFFT::GetWisdomFile()
+		{
+			return WisdomFile();
+		}
+
+		void NektarFFT::SetExportWisdom(bool exportWisdom)
+		{
+			ExportWisdom() = exportWisdom;
+		}
+
+		bool NektarFFT::GetExportWisdom()
+		{
+			return ExportWisdom();
+		}
+
+		/**
+		 * The FFTWPlanner solver information selects the planning effort
+		 * (Estimate, Measure, Patient or Exhaustive) and FFTWWisdom names a
+		 * file used to cache the plans between runs, so that the more
+		 * expensive planners are only paid for once. The file is read by
+		 * every process but only written by the root process.
+		 */
+		void NektarFFT::LoadPlanOptions(const SessionReaderSharedPtr &pSession)
+		{
+			if (pSession->DefinesSolverInfo("FFTWPlanner"))
+			{
+				const std::string planner =
+					pSession->GetSolverInfo("FFTWPlanner");
+
+				if (boost::iequals(planner, "Estimate"))
+				{
+					SetPlanRigour(eFFTEstimate);
+				}
+				else if (boost::iequals(planner, "Measure"))
+				{
+					SetPlanRigour(eFFTMeasure);
+				}
+				else if (boost::iequals(planner, "Patient"))
+				{
+					SetPlanRigour(eFFTPatient);
+				}
+				else if (boost::iequals(planner, "Exhaustive"))
+				{
+					SetPlanRigour(eFFTExhaustive);
+				}
+				else
+				{
+					ASSERTL0(false, "Unknown FFTWPlanner '" + planner + "'.");
+				}
+			}
+
+			if (pSession->DefinesSolverInfo("FFTWWisdom"))
+			{
+				SetWisdomFile(pSession->GetSolverInfo("FFTWWisdom"));
+			}
+
+			SetExportWisdom(pSession->GetComm()->GetRank() == 0);
+		}
 		
 	}//end namespace LibUtilities
 }//end of namespace Nektar
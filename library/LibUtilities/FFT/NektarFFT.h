@@ -39,6 +39,8 @@
 #include <LibUtilities/BasicUtils/NekFactory.hpp>
 #include <LibUtilities/LibUtilitiesDeclspec.h>
 
+#include <string>
+
 namespace Nektar
 {
     template <typename Dim, typename DataType>
@@ -46,6 +48,19 @@ namespace Nektar
     
 	namespace LibUtilities
 	{
+		class SessionReader;
+		typedef std::shared_ptr<SessionReader> SessionReaderSharedPtr;
+
+		/// Effort spent by FFT implementations in choosing a transform
+		/// algorithm, in increasing order of planning time.
+		enum FFTPlanRigour
+		{
+			eFFTEstimate,
+			eFFTMeasure,
+			eFFTPatient,
+			eFFTExhaustive
+		};
+
 		/**
 		 * The NektarFFT class is a virtual class to manage the use of the FFT to do Fwd/Bwd transformations
 		 * and convolutions. The function here defined will link to a proper implementation of the FFT algorithm.
@@ -101,6 +116,39 @@ namespace Nektar
 			 * outarray   = vector in physical space (length N)
 			 */
 			LIB_UTILITIES_EXPORT void FFTBwdTrans(Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys);
+
+			/**
+			 * Forward transformation of nTrans contiguous vectors, each of
+			 * length m_N, stored one after another in phys and coef.
+			 */
+			LIB_UTILITIES_EXPORT void FFTFwdTrans(const int nTrans, Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef);
+
+			/**
+			 * Backward transformation of nTrans contiguous vectors, each of
+			 * length m_N, stored one after another in coef and phys.
+			 */
+			LIB_UTILITIES_EXPORT void FFTBwdTrans(const int nTrans, Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys);
+
+			/// Set the planning effort of subsequently created transforms.
+			LIB_UTILITIES_EXPORT static void SetPlanRigour(FFTPlanRigour rigour);
+
+			LIB_UTILITIES_EXPORT static FFTPlanRigour GetPlanRigour();
+
+			/// Set the file from which planning data is loaded and to which
+			/// it is saved. An empty name disables the cache.
+			LIB_UTILITIES_EXPORT static void SetWisdomFile(const std::string &file);
+
+			LIB_UTILITIES_EXPORT static const std::string &GetWisdomFile();
+
+			/// Set whether this process saves the planning data to the
+			/// wisdom file, so that only one process writes it.
+			LIB_UTILITIES_EXPORT static void SetExportWisdom(bool exportWisdom);
+
+			LIB_UTILITIES_EXPORT static bool GetExportWisdom();
+
+			/// Read the planning options from the FFTWPlanner and
+			/// FFTWWisdom solver information of a session.
+			LIB_UTILITIES_EXPORT static void LoadPlanOptions(const SessionReaderSharedPtr &pSession);
 			
 		protected:
 			
@@ -108,6 +156,10 @@ namespace Nektar
 			virtual void v_FFTFwdTrans(Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef);
 						
 			virtual void v_FFTBwdTrans(Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys);
+
+			LIB_UTILITIES_EXPORT virtual void v_FFTFwdTrans(const int nTrans, Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef);
+
+			LIB_UTILITIES_EXPORT virtual void v_FFTBwdTrans(const int nTrans, Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys);
 			
 		private:
 			
@@ -93,6 +93,81 @@ static NekDouble ang(NekDouble x, NekDouble y)
     return (x != 0.0 || y != 0.0) ? atan2(y, x) : 0.0;
 }
 
+// =========================================================================
+//             Kernels of the fused evaluator
+// =========================================================================
+
+/// Operand of a fused kernel: either an array of values, or a single value
+/// if @p ptr is null.
+struct FusedOperand
+{
+    const NekDouble *ptr;
+    NekDouble value;
+};
+
+/// Apply the unary operation @p f to @p n values of @p a.
+template <typename F>
+inline void FusedUnary(const int n, const FusedOperand &a, NekDouble *out, F f)
+{
+    if (a.ptr)
+    {
+        const NekDouble *x = a.ptr;
+        for (int i = 0; i < n; ++i)
+        {
+            out[i] = f(x[i]);
+        }
+    }
+    else
+    {
+        const NekDouble v = f(a.value);
+        for (int i = 0; i < n; ++i)
+        {
+            out[i] = v;
+        }
+    }
+}
+
+/// Apply the binary operation @p f to @p n values of @p a and @p b. Loops
+/// are specialised on which operands are single values so that they can be
+/// vectorised.
+template <typename F>
+inline void FusedBinary(const int n, const FusedOperand &a,
+                        const FusedOperand &b, NekDouble *out, F f)
+{
+    if (a.ptr && b.ptr)
+    {
+        const NekDouble *x = a.ptr, *y = b.ptr;
+        for (int i = 0; i < n; ++i)
+        {
+            out[i] = f(x[i], y[i]);
+        }
+    }
+    else if (a.ptr)
+    {
+        const NekDouble *x = a.ptr, y = b.value;
+        for (int i = 0; i < n; ++i)
+        {
+            out[i] = f(x[i], y);
+        }
+    }
+    else if (b.ptr)
+    {
+        const NekDouble x = a.value, *y = b.ptr;
+        for (int i = 0; i < n; ++i)
+        {
+            out[i] = f(x, y[i]);
+        }
+    }
+    else
+    {
+        const NekDouble v = f(a.value, b.value);
+        for (int i = 0; i < n; ++i)
+        {
+            out[i] = v;
+        }
+    }
+}
+
 // =========================================================================
 //             AnalyticExpression definitions for Spirit Parser
 // =========================================================================
@@ -191,6 +266,7 @@ public:
     ExpressionEvaluator() : m_timer(), m_total_eval_time(0)
     {
         m_state_size = 1;
+        m_backend    = Interpreter::eFused;
 
         // Constant definitions.
         AddConstant("MEANINGLESS", 0.0);
@@ -387,6 +463,14 @@ public:
         return m_total_eval_time;
     }
 
+    /**
+     * @copydoc Interpreter::SetBackend
+     */
+    void SetBackend(Interpreter::Backend backend)
+    {
+        m_backend = backend;
+    }
+
     /**
      * @copydoc Interpreter::DefineFunction
      */
@@ -476,6 +560,7 @@ public:
         // parallel std::vectors that share their ids. This split helps to
         // achieve some performance improvement.
         m_executionStack.push_back(stack);
+        m_program.push_back(CompileProgram(stack, m_state_size));
         m_stackVariableMap.push_back(variableMap);
         m_state_sizes.push_back(m_state_size);
 
@@ -622,7 +707,8 @@ public:
                  "destination array must have enough capacity to store "
                  "expression values at each given point");
 
-        ExecutionStack &stack = m_executionStack[id];
+        ExecutionStack &stack  = m_executionStack[id];
+        const Program &program = m_program[id];
 
         /// If number of points tends to 10^6, one may end up with up to ~0.5Gb
         /// data allocated for m_state only.  Lets split the work into
@@ -649,16 +735,25 @@ public:
         while (work_left > 0)
         {
             const int this_chunk_size = (std::min)(work_left, 1024);
-            for (int i = 0; i < this_chunk_size; i++)
+            if (m_backend == Interpreter::eFused)
             {
-                for (int j = 0; j < nvals; ++j)
-                {
-                    m_variable[i + this_chunk_size * j] = points[j][offset + i];
-                }
+                // Variables are read directly from the input arrays.
+                RunProgram(program, this_chunk_size, offset, points);
             }
-            for (int i = 0; i < stack.size(); i++)
+            else
             {
-                (*stack[i]).run_many(this_chunk_size);
+                for (int i = 0; i < this_chunk_size; i++)
+                {
+                    for (int j = 0; j < nvals; ++j)
+                    {
+                        m_variable[i + this_chunk_size * j] =
+                            points[j][offset + i];
+                    }
+                }
+                for (int i = 0; i < stack.size(); i++)
+                {
+                    (*stack[i]).run_many(this_chunk_size);
+                }
             }
             for (int i = 0; i < this_chunk_size; i++)
             {
@@ -1226,6 +1321,79 @@ public:
     }; // class AnalyticExpression
 
 private:
+    // ======================================================
+    //  Fused program representation
+    // ======================================================
+
+    /// Operations of the fused program.
+    enum OpCode
+    {
+        OP_GENERIC,
+        OP_CONST,
+        OP_VAR,
+        OP_PRM,
+        OP_LOAD,
+        OP_ADD,
+        OP_SUB,
+        OP_MUL,
+        OP_DIV,
+        OP_POW,
+        OP_EQ,
+        OP_LEQ,
+        OP_LESS,
+        OP_GEQ,
+        OP_GREATER,
+        OP_NEG,
+        OP_FUNC1,
+        OP_FUNC2
+    };
+
+    /// Operation performed by an evaluation step, and for function steps the
+    /// EvaluationStepType of the function.
+    struct StepCode
+    {
+        StepCode(OpCode o = OP_GENERIC, int f = -1) : op(o), func(f)
+        {
+        }
+
+        OpCode op;
+        int func;
+    };
+
+    /// Source of an operand in the fused program.
+    struct Operand
+    {
+        enum Kind
+        {
+            eState,
+            eVar,
+            eConst,
+            ePrm
+        };
+
+        Operand(Kind k = eState, int i = -1) : kind(k), idx(i)
+        {
+        }
+
+        Kind kind;
+        int idx;
+    };
+
+    /// Instruction of the fused program. Generic instructions run the
+    /// original evaluation step on the state.
+    struct Instruction
+    {
+        OpCode op;
+        int store;
+        Operand arg1;
+        Operand arg2;
+        OneArgFunc func1;
+        TwoArgFunc func2;
+        EvaluationStep *step;
+    };
+
+    typedef std::vector<Instruction> Program;
+
     // ======================================================
     //  Pre-processed expressions
     // ======================================================
@@ -1238,6 +1406,11 @@ private:
     ExpressionMap m_parsedMapExprToExecStackId;
     std::vector<ExecutionStack> m_executionStack;
 
+    ///  Fused programs compiled from each ExecutionStack, used by the
+    ///  vectorised evaluation when the backend is Interpreter::eFused.
+    std::vector<Program> m_program;
+    Interpreter::Backend m_backend;
+
     ///  Keeping map of variables individually per each analytic expression
     ///  allows correctly handling expressions which depend on different
     ///  number of variables.
@@ -1309,8 +1482,11 @@ private:
     template <typename StepType>
     EvaluationStep *makeStep(ci dest, ci src_left = 0, ci src_right = 0)
     {
-        return (new StepType(m_generator, m_state, m_constant, m_parameter,
-                             m_variable, dest, src_left, src_right));
+        StepType *step = new StepType(m_generator, m_state, m_constant,
+                                      m_parameter, m_variable, dest, src_left,
+                                      src_right);
+        step->code = GetStepCode(step);
+        return step;
     }
 
     enum EvaluationStepType
@@ -1359,6 +1535,9 @@ private:
         ci argIdx1;
         ci argIdx2;
 
+        ///  operation used when compiling the fused program
+        StepCode code;
+
         EvaluationStep(rgt rn, ci i, ci l, ci r, vr s, cvr c, cvr p, cvr v)
             : rng(rn), state(s), consts(c), params(p), vars(v), storeIdx(i),
               argIdx1(l), argIdx2(r){};
@@ -2007,6 +2186,405 @@ private:
             state[storeIdx] = _normal();
         }
     };
+
+    // ======================================================
+    //  Fused evaluation
+    // ======================================================
+
+    ///  Overloads giving the operation of each type of evaluation step. Steps
+    ///  without an overload, such as EvalAWGN, are run as generic steps.
+    static StepCode GetStepCode(EvaluationStep *)
+    {
+        return StepCode(OP_GENERIC);
+    }
+    static StepCode GetStepCode(StoreConst *)
+    {
+        return StepCode(OP_CONST);
+    }
+    static StepCode GetStepCode(StoreVar *)
+    {
+        return StepCode(OP_VAR);
+    }
+    static StepCode GetStepCode(StorePrm *)
+    {
+        return StepCode(OP_PRM);
+    }
+    static StepCode GetStepCode(EvalSum *)
+    {
+        return StepCode(OP_ADD);
+    }
+    static StepCode GetStepCode(EvalSub *)
+    {
+        return StepCode(OP_SUB);
+    }
+    static StepCode GetStepCode(EvalMul *)
+    {
+        return StepCode(OP_MUL);
+    }
+    static StepCode GetStepCode(EvalDiv *)
+    {
+        return StepCode(OP_DIV);
+    }
+    static StepCode GetStepCode(EvalPow *)
+    {
+        return StepCode(OP_POW);
+    }
+    static StepCode GetStepCode(EvalNeg *)
+    {
+        return StepCode(OP_NEG);
+    }
+    static StepCode GetStepCode(EvalLogicalEqual *)
+    {
+        return StepCode(OP_EQ);
+    }
+    static StepCode GetStepCode(EvalLogicalLeq *)
+    {
+        return StepCode(OP_LEQ);
+    }
+    static StepCode GetStepCode(EvalLogicalLess *)
+    {
+        return StepCode(OP_LESS);
+    }
+    static StepCode GetStepCode(EvalLogicalGeq *)
+    {
+        return StepCode(OP_GEQ);
+    }
+    static StepCode GetStepCode(EvalLogicalGreater *)
+    {
+        return StepCode(OP_GREATER);
+    }
+    static StepCode GetStepCode(EvalAbs *)
+    {
+        return StepCode(OP_FUNC1, E_ABS);
+    }
+    static StepCode GetStepCode(EvalSign *)
+    {
+        return StepCode(OP_FUNC1, E_SIGN);
+    }
+    static StepCode GetStepCode(EvalAsin *)
+    {
+        return StepCode(OP_FUNC1, E_ASIN);
+    }
+    static StepCode GetStepCode(EvalAcos *)
+    {
+        return StepCode(OP_FUNC1, E_ACOS);
+    }
+    static StepCode GetStepCode(EvalAtan *)
+    {
+        return StepCode(OP_FUNC1, E_ATAN);
+    }
+    static StepCode GetStepCode(EvalCeil *)
+    {
+        return StepCode(OP_FUNC1, E_CEIL);
+    }
+    static StepCode GetStepCode(EvalCos *)
+    {
+        return StepCode(OP_FUNC1, E_COS);
+    }
+    static StepCode GetStepCode(EvalCosh *)
+    {
+        return StepCode(OP_FUNC1, E_COSH);
+    }
+    static StepCode GetStepCode(EvalExp *)
+    {
+        return StepCode(OP_FUNC1, E_EXP);
+    }
+    static StepCode GetStepCode(EvalFabs *)
+    {
+        return StepCode(OP_FUNC1, E_FABS);
+    }
+    static StepCode GetStepCode(EvalFloor *)
+    {
+        return StepCode(OP_FUNC1, E_FLOOR);
+    }
+    static StepCode GetStepCode(EvalLog *)
+    {
+        return StepCode(OP_FUNC1, E_LOG);
+    }
+    static StepCode GetStepCode(EvalLog10 *)
+    {
+        return StepCode(OP_FUNC1, E_LOG10);
+    }
+    static StepCode GetStepCode(EvalSin *)
+    {
+        return StepCode(OP_FUNC1, E_SIN);
+    }
+    static StepCode GetStepCode(EvalSinh *)
+    {
+        return StepCode(OP_FUNC1, E_SINH);
+    }
+    static StepCode GetStepCode(EvalSqrt *)
+    {
+        return StepCode(OP_FUNC1, E_SQRT);
+    }
+    static StepCode GetStepCode(EvalTan *)
+    {
+        return StepCode(OP_FUNC1, E_TAN);
+    }
+    static StepCode GetStepCode(EvalTanh *)
+    {
+        return StepCode(OP_FUNC1, E_TANH);
+    }
+    static StepCode GetStepCode(EvalAtan2 *)
+    {
+        return StepCode(OP_FUNC2, E_ATAN2);
+    }
+    static StepCode GetStepCode(EvalAng *)
+    {
+        return StepCode(OP_FUNC2, E_ANG);
+    }
+    static StepCode GetStepCode(EvalRad *)
+    {
+        return StepCode(OP_FUNC2, E_RAD);
+    }
+    static StepCode GetStepCode(EvalBessel *)
+    {
+        return StepCode(OP_FUNC2, E_BESSEL);
+    }
+
+    /**
+     * @brief Compile an execution stack into a fused program.
+     *
+     * Loads of variables, constants and parameters into the state are not
+     * performed, but recorded as pending for their state slot, and fused into
+     * the instruction which next reads that slot. Variables are then read
+     * directly from the input arrays and constants or parameters are passed
+     * as single values. Pending loads are only written to the state before
+     * generic steps, which may read any slot, and for the final result.
+     *
+     * @param stack      Execution stack of the expression.
+     * @param stateSize  Number of state slots used by the stack.
+     */
+    Program CompileProgram(const ExecutionStack &stack, const int stateSize)
+    {
+        Program program;
+        std::vector<Operand> pending(stateSize);
+
+        for (auto &step : stack)
+        {
+            const StepCode &code = step->code;
+            switch (code.op)
+            {
+                case OP_CONST:
+                    pending[step->storeIdx] =
+                        Operand(Operand::eConst, step->argIdx1);
+                    break;
+                case OP_VAR:
+                    pending[step->storeIdx] =
+                        Operand(Operand::eVar, step->argIdx1);
+                    break;
+                case OP_PRM:
+                    pending[step->storeIdx] =
+                        Operand(Operand::ePrm, step->argIdx1);
+                    break;
+                case OP_GENERIC:
+                {
+                    for (int i = 0; i < stateSize; ++i)
+                    {
+                        StorePending(program, pending, i);
+                    }
+
+                    Instruction ins = MakeInstruction(OP_GENERIC,
+                                                      step->storeIdx);
+                    ins.step = step;
+                    program.push_back(ins);
+                    break;
+                }
+                default:
+                {
+                    Instruction ins = MakeInstruction(code.op, step->storeIdx);
+                    ins.arg1 = TakeOperand(pending, step->argIdx1);
+
+                    // Unary steps leave argIdx2 unset, so it must not be read.
+                    if (code.op != OP_NEG && code.op != OP_FUNC1)
+                    {
+                        ins.arg2 = TakeOperand(pending, step->argIdx2);
+                    }
+
+                    if (code.op == OP_FUNC1)
+                    {
+                        ins.func1 = m_function[code.func];
+                    }
+                    else if (code.op == OP_FUNC2)
+                    {
+                        ins.func2 = m_function2[code.func];
+                    }
+
+                    pending[step->storeIdx] = Operand();
+                    program.push_back(ins);
+                    break;
+                }
+            }
+        }
+
+        // The result is read from the first state slot.
+        StorePending(program, pending, 0);
+
+        return program;
+    }
+
+    Instruction MakeInstruction(OpCode op, const int store)
+    {
+        Instruction ins;
+        ins.op    = op;
+        ins.store = store;
+        ins.func1 = nullptr;
+        ins.func2 = nullptr;
+        ins.step  = nullptr;
+        return ins;
+    }
+
+    /// Return the operand held in state slot @p idx, including a pending load.
+    Operand TakeOperand(std::vector<Operand> &pending, const int idx)
+    {
+        Operand ret = pending[idx];
+        pending[idx] = Operand();
+        return ret.kind == Operand::eState ? Operand(Operand::eState, idx)
+                                           : ret;
+    }
+
+    /// Write a pending load of state slot @p idx to the state.
+    void StorePending(Program &program, std::vector<Operand> &pending,
+                      const int idx)
+    {
+        if (pending[idx].kind != Operand::eState)
+        {
+            Instruction ins = MakeInstruction(OP_LOAD, idx);
+            ins.arg1     = pending[idx];
+            pending[idx] = Operand();
+            program.push_back(ins);
+        }
+    }
+
+    FusedOperand GetOperand(
+        const Operand &arg, const int n, const int offset,
+        const std::vector<Array<OneD, const NekDouble>> &points)
+    {
+        FusedOperand ret = {nullptr, 0.0};
+        switch (arg.kind)
+        {
+            case Operand::eState:
+                ret.ptr = &m_state[arg.idx * n];
+                break;
+            case Operand::eVar:
+                // Variables not passed to Evaluate are zero, as they are
+                // for the stack backend.
+                if (arg.idx < points.size())
+                {
+                    ret.ptr = points[arg.idx].get() + offset;
+                }
+                break;
+            case Operand::eConst:
+                ret.value = m_constant[arg.idx];
+                break;
+            case Operand::ePrm:
+                ret.value = m_parameter[arg.idx];
+                break;
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Run a fused program on a chunk of @p n points starting at
+     * @p offset in the input arrays @p points. The result is left in the
+     * first state slot, as for the execution stack.
+     */
+    void RunProgram(const Program &program, const int n, const int offset,
+                    const std::vector<Array<OneD, const NekDouble>> &points)
+    {
+        for (auto &ins : program)
+        {
+            if (ins.op == OP_GENERIC)
+            {
+                ins.step->run_many(n);
+                continue;
+            }
+
+            NekDouble *out     = &m_state[ins.store * n];
+            FusedOperand a     = GetOperand(ins.arg1, n, offset, points);
+            FusedOperand b     = {nullptr, 0.0};
+            if (ins.op != OP_LOAD && ins.op != OP_NEG && ins.op != OP_FUNC1)
+            {
+                b = GetOperand(ins.arg2, n, offset, points);
+            }
+
+            switch (ins.op)
+            {
+                case OP_LOAD:
+                    FusedUnary(n, a, out, [](NekDouble x) { return x; });
+                    break;
+                case OP_NEG:
+                    FusedUnary(n, a, out, [](NekDouble x) { return -x; });
+                    break;
+                case OP_FUNC1:
+                {
+                    OneArgFunc f = ins.func1;
+                    FusedUnary(n, a, out, [f](NekDouble x) { return f(x); });
+                    break;
+                }
+                case OP_ADD:
+                    FusedBinary(n, a, b, out, [](NekDouble x, NekDouble y) {
+                        return x + y;
+                    });
+                    break;
+                case OP_SUB:
+                    FusedBinary(n, a, b, out, [](NekDouble x, NekDouble y) {
+                        return x - y;
+                    });
+                    break;
+                case OP_MUL:
+                    FusedBinary(n, a, b, out, [](NekDouble x, NekDouble y) {
+                        return x * y;
+                    });
+                    break;
+                case OP_DIV:
+                    FusedBinary(n, a, b, out, [](NekDouble x, NekDouble y) {
+                        return x / y;
+                    });
+                    break;
+                case OP_POW:
+                    FusedBinary(n, a, b, out, [](NekDouble x, NekDouble y) {
+                        return std::pow(x, y);
+                    });
+                    break;
+                case OP_EQ:
+                    FusedBinary(n, a, b, out, [](NekDouble x, NekDouble y) {
+                        return NekDouble(x == y);
+                    });
+                    break;
+                case OP_LEQ:
+                    FusedBinary(n, a, b, out, [](NekDouble x, NekDouble y) {
+                        return NekDouble(x <= y);
+                    });
+                    break;
+                case OP_LESS:
+                    FusedBinary(n, a, b, out, [](NekDouble x, NekDouble y) {
+                        return NekDouble(x < y);
+                    });
+                    break;
+                case OP_GEQ:
+                    FusedBinary(n, a, b, out, [](NekDouble x, NekDouble y) {
+                        return NekDouble(x >= y);
+                    });
+                    break;
+                case OP_GREATER:
+                    FusedBinary(n, a, b, out, [](NekDouble x, NekDouble y) {
+                        return NekDouble(x > y);
+                    });
+                    break;
+                case OP_FUNC2:
+                {
+                    TwoArgFunc f = ins.func2;
+                    FusedBinary(n, a, b, out, [f](NekDouble x, NekDouble y) {
+                        return f(x, y);
+                    });
+                    break;
+                }
+                default:
+                    ASSERTL0(false, "Unknown operation in fused program.");
+            }
+        }
+    }
 };
 
 Interpreter::Interpreter()
@@ -2069,6 +2647,11 @@ NekDouble Interpreter::GetTime() const
     return m_impl->GetTime();
 }
 
+void Interpreter::SetBackend(Backend backend)
+{
+    m_impl->SetBackend(backend);
+}
+
 int Interpreter::DefineFunction(const std::string &vlist,
                                 const std::string &function)
 {
@@ -77,6 +77,23 @@ namespace LibUtilities
 class Interpreter
 {
 public:
+    /**
+     * @brief Backend used by the vectorised #Evaluate functions.
+     *
+     * - eStack evaluates the execution stack, with one virtual call per
+     *   evaluation step.
+     * - eFused evaluates a compiled program in which loads of variables,
+     *   constants and parameters are fused into the arithmetic operations
+     *   that use them, giving tight loops which the compiler can vectorise.
+     *
+     * Both give identical results.
+     */
+    enum Backend
+    {
+        eStack,
+        eFused
+    };
+
     /**
      * @brief Default constructor.
      */
@@ -198,6 +215,12 @@ public:
      */
     LIB_UTILITIES_EXPORT NekDouble GetTime() const;
 
+    /**
+     * @brief Sets the backend used by the vectorised #Evaluate functions. The
+     * default is #eFused.
+     */
+    LIB_UTILITIES_EXPORT void SetBackend(Backend backend);
+
     // ======================================================
     //  Parsing and evaluation methods
     // ======================================================
@@ -104,6 +104,45 @@ namespace Nektar
         os <<  "]" << std::endl;
         return os;
     }
+
+    /// Memory held by a matrix, used to account for the matrices stored in
+    /// a NekManager. Storage shared with other matrices is included.
+    template<typename DataType>
+    size_t ManagedObjectBytes(const NekMatrix<DataType, StandardMatrixTag>& rhs)
+    {
+        return sizeof(rhs) + rhs.GetStorageSize() * sizeof(DataType);
+    }
+
+    template<typename DataType, typename InnerMatrixType>
+    size_t ManagedObjectBytes(
+        const NekMatrix<NekMatrix<DataType, InnerMatrixType>, ScaledMatrixTag>& rhs)
+    {
+        return sizeof(rhs) + ManagedObjectBytes(*rhs.GetOwnedMatrix());
+    }
+
+    template<typename DataType, typename InnerMatrixType>
+    size_t ManagedObjectBytes(
+        const NekMatrix<NekMatrix<DataType, InnerMatrixType>, BlockMatrixTag>& rhs)
+    {
+        size_t bytes = sizeof(rhs) + rhs.GetStorageSize() *
+            sizeof(std::shared_ptr<NekMatrix<DataType, InnerMatrixType> >);
+        bool diagonal = rhs.GetStorageType() == eDIAGONAL;
+
+        for (unsigned int i = 0; i < rhs.GetNumberOfBlockRows(); ++i)
+        {
+            for (unsigned int j = diagonal ? i : 0;
+                 j < (diagonal ? i + 1 : rhs.GetNumberOfBlockColumns()); ++j)
+            {
+                const NekMatrix<DataType, InnerMatrixType> *block =
+                    rhs.GetBlockPtr(i, j);
+                if (block)
+                {
+                    bytes += ManagedObjectBytes(*block);
+                }
+            }
+        }
+        return bytes;
+    }
 }
 
 #endif //NEKTAR_LIB_UTILITIES_NEK_MATRIX_HPP
@@ -68,6 +68,7 @@ namespace Nektar
 
 
     template<typename DataType> class StorageSmvBsr;
+    template<typename DataType> class StorageSmvSell;
 
     template<typename SparseStorageType> class NekSparseMatrix;
     template<typename SparseStorageType> class NekSparseDiagBlkMatrix;
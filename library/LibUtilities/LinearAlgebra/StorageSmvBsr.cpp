@@ -40,12 +40,46 @@
 #include <cmath>
 
 #include <LibUtilities/BasicConst/NektarUnivConsts.hpp>
+#include <LibUtilities/BasicUtils/Thread.h>
 #include <LibUtilities/LinearAlgebra/Blas.hpp>
 #include <LibUtilities/LinearAlgebra/StorageSmvBsr.hpp>
 #include <LibUtilities/LinearAlgebra/NistSparseDescriptors.hpp>
 
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
 namespace Nektar
 {
+    /// Minimum number of stored values per thread for which a threaded
+    /// multiply is worthwhile.
+    static const IndexType kSmvMinValuesPerThread = 16384;
+
+    /// Multiplies one partition of block rows on a worker thread.
+    template<typename DataType>
+    class SmvBsrMultiplyJob : public Thread::ThreadJob
+    {
+        public:
+            SmvBsrMultiplyJob(StorageSmvBsr<DataType> *storage,
+                              IndexType rowStart, IndexType rowEnd,
+                              const DataType *in, DataType *out)
+                : m_storage(storage), m_rowStart(rowStart),
+                  m_rowEnd(rowEnd), m_in(in), m_out(out)
+            {
+            }
+
+            virtual void Run()
+            {
+                m_storage->MultiplyRange(m_rowStart, m_rowEnd, m_in, m_out);
+            }
+
+        private:
+            StorageSmvBsr<DataType> *m_storage;
+            IndexType                m_rowStart;
+            IndexType                m_rowEnd;
+            const DataType          *m_in;
+            DataType                *m_out;
+    };
 
     template<typename DataType>
     StorageSmvBsr<DataType>::const_iterator::const_iterator(
@@ -225,7 +259,8 @@ namespace Nektar
         m_nnz     (0),
         m_val     (m_bnnz * blkDim*blkDim),
         m_indx    (m_bnnz+1),
-        m_pntr    (blkRows+1)
+        m_pntr    (blkRows+1),
+        m_partRows(1, blkRows)
     {
         if (matType != Nektar::eFULL)
         {
@@ -251,7 +286,8 @@ namespace Nektar
         m_nnz(src.m_nnz),
         m_val(src.m_val),
         m_indx(src.m_indx),
-        m_pntr(src.m_pntr)
+        m_pntr(src.m_pntr),
+        m_partRows(src.m_partRows)
     {
     }
 
@@ -305,6 +341,7 @@ namespace Nektar
         return sizeof(DataType) *m_val.capacity()   +
                sizeof(IndexType)*m_indx.capacity() +
                sizeof(IndexType)*m_pntr.capacity()  +
+               sizeof(IndexType)*m_partRows.capacity() +
                sizeof(IndexType)*5   + //< blkRows + blkCols + blkDim + nnz + bnnz
                sizeof(MatrixStorage);
     }
@@ -359,23 +396,7 @@ namespace Nektar
             const DataVectorType &in,
                   DataVectorType &out)
     {
-        const double* b = &in[0];
-              double* c = &out[0];
-        const double* val = &m_val[0];
-        const int* bindx  = (int*)&m_indx[0];
-        const int* bpntrb = (int*)&m_pntr[0];
-        const int* bpntre = (int*)&m_pntr[0]+1;
-        const int  mb = m_blkRows;
-
-        switch(m_blkDim)
-        {
-        case 1:  Multiply_1x1(mb,val,bindx,bpntrb,bpntre,b,c); return;
-        case 2:  Multiply_2x2(mb,val,bindx,bpntrb,bpntre,b,c); return;
-        default:
-            {
-                Multiply_generic(mb,val,bindx,bpntrb,bpntre,b,c); return;
-            }
-        }
+        Multiply(&in[0], &out[0]);
     }
 
 
@@ -384,23 +405,30 @@ namespace Nektar
             const DataType*  in,
                   DataType*  out)
     {
-        const double* b = &in[0];
-              double* c = &out[0];
-        const double* val = &m_val[0];
-        const int* bindx  = (int*)&m_indx[0];
-        const int* bpntrb = (int*)&m_pntr[0];
-        const int* bpntre = (int*)&m_pntr[0]+1;
-        const int  mb = m_blkRows;
+        const int nParts = m_partRows.size() - 1;
 
-        switch(m_blkDim)
+        Thread::ThreadManagerSharedPtr tm;
+        if (nParts > 1)
         {
-        case 1:  Multiply_1x1(mb,val,bindx,bpntrb,bpntre,b,c); return;
-        case 2:  Multiply_2x2(mb,val,bindx,bpntrb,bpntre,b,c); return;
-        default:
-            {
-                Multiply_generic(mb,val,bindx,bpntrb,bpntre,b,c); return;
-            }
+            tm = Thread::GetThreadMaster().GetInstance(
+                Thread::ThreadMaster::SessionJob);
+        }
+
+        if (nParts < 2 || !tm->IsInitialised() || tm->InThread())
+        {
+            MultiplyRange(0, m_blkRows, in, out);
+            return;
+        }
+
+        std::vector<Thread::ThreadJob*> jobs(nParts);
+        for (int p = 0; p < nParts; ++p)
+        {
+            jobs[p] = new SmvBsrMultiplyJob<DataType>(
+                this, m_partRows[p], m_partRows[p+1], in, out);
         }
+
+        tm->QueueJobs(jobs);
+        tm->Wait();
     }
 
 
@@ -410,19 +438,33 @@ namespace Nektar
     void StorageSmvBsr<DataType>::MultiplyLight(
             const DataVectorType &in,
                   DataVectorType &out)
+    {
+        Multiply(&in[0], &out[0]);
+    }
+
+    /// Multiply the block rows [rowStart, rowEnd), writing the corresponding
+    /// entries of @p out only.
+    template<typename DataType>
+    void StorageSmvBsr<DataType>::MultiplyRange(
+            const IndexType rowStart,
+            const IndexType rowEnd,
+            const DataType* in,
+                  DataType* out)
     {
         const double* b = &in[0];
-              double* c = &out[0];
-        const double* val = &m_val[0];
+              double* c = &out[0] + rowStart*m_blkDim;
+        const double* val = &m_val[0] + m_pntr[rowStart]*m_blkDim*m_blkDim;
         const int* bindx  = (int*)&m_indx[0];
-        const int* bpntrb = (int*)&m_pntr[0];
-        const int* bpntre = (int*)&m_pntr[0]+1;
-        const int  mb = m_blkRows;
+        const int* bpntrb = (int*)&m_pntr[0] + rowStart;
+        const int* bpntre = (int*)&m_pntr[0] + rowStart + 1;
+        const int  mb = rowEnd - rowStart;
 
         switch(m_blkDim)
         {
         case 1:  Multiply_1x1(mb,val,bindx,bpntrb,bpntre,b,c); return;
         case 2:  Multiply_2x2(mb,val,bindx,bpntrb,bpntre,b,c); return;
+        case 3:  Multiply_3x3(mb,val,bindx,bpntrb,bpntre,b,c); return;
+        case 4:  Multiply_4x4(mb,val,bindx,bpntrb,bpntre,b,c); return;
         default:
             {
                 Multiply_generic(mb,val,bindx,bpntrb,bpntre,b,c); return;
@@ -430,6 +472,33 @@ namespace Nektar
         }
     }
 
+    /// Partition the block rows into at most @p nThreads ranges holding
+    /// similar numbers of nonzero blocks. Fewer partitions are used for small
+    /// matrices, for which the threading overhead would dominate.
+    template<typename DataType>
+    void StorageSmvBsr<DataType>::SetNumThreads(const unsigned int nThreads)
+    {
+        const IndexType nValues = m_bnnz*m_blkDim*m_blkDim;
+        const IndexType nParts  = std::max(1u, std::min(
+            std::min((IndexType)nThreads, m_blkRows),
+            nValues / kSmvMinValuesPerThread));
+
+        m_partRows.resize(nParts+1);
+        m_partRows[0]      = 0;
+        m_partRows[nParts] = m_blkRows;
+
+        // Each partition starts at the first block row reaching its share
+        // of the nonzero blocks.
+        for (IndexType p = 1; p < nParts; ++p)
+        {
+            IndexType target = (IndexType)((size_t)m_bnnz * p / nParts);
+            const IndexType *row = std::lower_bound(
+                &m_pntr[0], &m_pntr[0] + m_blkRows + 1, target);
+            m_partRows[p] = std::max(m_partRows[p-1],
+                std::min((IndexType)(row - &m_pntr[0]), m_blkRows));
+        }
+    }
+
     /// Zero-based CSR multiply.
     /// Essentially this is slightly modified copy-paste from
     /// NIST Sparse Blas 0.9b routine CSR_VecMult_CAB_double()
@@ -478,17 +547,34 @@ namespace Nektar
         {
             int jb = bpntrb[i];
             int je = bpntre[i];
-            pc[0] = 0;
-            pc[1] = 0;
+#if defined(__SSE2__)
+            // Blocks are column-major: accumulate columns scaled by b.
+            __m128d t = _mm_setzero_pd();
+            for (int j=jb;j!=je;j++)
+            {
+                const double *pb = &b[bindx[j]*lb];
+
+                t = _mm_add_pd(t, _mm_mul_pd(_mm_loadu_pd(pval),
+                                             _mm_set1_pd(pb[0])));
+                t = _mm_add_pd(t, _mm_mul_pd(_mm_loadu_pd(pval+2),
+                                             _mm_set1_pd(pb[1])));
+                pval += 4;
+            }
+            _mm_storeu_pd(pc, t);
+#else
+            double t0 = 0, t1 = 0;
             for (int j=jb;j!=je;j++)
             {
                 int bs=bindx[j]*lb;
                 const double *pb = &b[bs];
 
-                pc[0] += pb[0] * pval[0] + pb[1] * pval[2];
-                pc[1] += pb[0] * pval[1] + pb[1] * pval[3];
+                t0 += pb[0] * pval[0] + pb[1] * pval[2];
+                t1 += pb[0] * pval[1] + pb[1] * pval[3];
                 pval += 4;
             }
+            pc[0] = t0;
+            pc[1] = t1;
+#endif
             pc += 2;
         }
     }
@@ -513,19 +599,20 @@ namespace Nektar
         {
             int jb = bpntrb[i];
             int je = bpntre[i];
-            pc[0] = 0;
-            pc[1] = 0;
-            pc[2] = 0;
+            double t0 = 0, t1 = 0, t2 = 0;
             for (int j=jb;j!=je;j++)
             {
                 int bs=bindx[j]*lb;
                 const double *pb = &b[bs];
 
-                pc[0] += pb[0] * pval[0] + pb[1] * pval[3] + pb[2] * pval[6];
-                pc[1] += pb[0] * pval[1] + pb[1] * pval[4] + pb[2] * pval[7];
-                pc[2] += pb[0] * pval[2] + pb[1] * pval[5] + pb[2] * pval[8];
+                t0 += pb[0] * pval[0] + pb[1] * pval[3] + pb[2] * pval[6];
+                t1 += pb[0] * pval[1] + pb[1] * pval[4] + pb[2] * pval[7];
+                t2 += pb[0] * pval[2] + pb[1] * pval[5] + pb[2] * pval[8];
                 pval += 9;
             }
+            pc[0] = t0;
+            pc[1] = t1;
+            pc[2] = t2;
             pc += 3;
         }
     }
@@ -550,21 +637,45 @@ namespace Nektar
         {
             int jb = bpntrb[i];
             int je = bpntre[i];
-            pc[0] = 0;
-            pc[1] = 0;
-            pc[2] = 0;
-            pc[3] = 0;
+#if defined(__AVX__)
+            // Blocks are column-major: accumulate columns scaled by b.
+            __m256d t = _mm256_setzero_pd();
+            for (int j=jb;j!=je;j++)
+            {
+                const double *pb = &b[bindx[j]*lb];
+
+                __m256d t01 = _mm256_add_pd(
+                    _mm256_mul_pd(_mm256_loadu_pd(pval),
+                                  _mm256_set1_pd(pb[0])),
+                    _mm256_mul_pd(_mm256_loadu_pd(pval+4),
+                                  _mm256_set1_pd(pb[1])));
+                __m256d t23 = _mm256_add_pd(
+                    _mm256_mul_pd(_mm256_loadu_pd(pval+8),
+                                  _mm256_set1_pd(pb[2])),
+                    _mm256_mul_pd(_mm256_loadu_pd(pval+12),
+                                  _mm256_set1_pd(pb[3])));
+                t = _mm256_add_pd(t, _mm256_add_pd(t01, t23));
+                pval += 16;
+            }
+            _mm256_storeu_pd(pc, t);
+#else
+            double t0 = 0, t1 = 0, t2 = 0, t3 = 0;
             for (int j=jb;j!=je;j++)
             {
                 int bs=bindx[j]*lb;
                 const double *pb = &b[bs];
 
-                pc[0] += pb[0] * pval[0] + pb[1] * pval[4] + pb[2] * pval[ 8] + pb[3] * pval[12];
-                pc[1] += pb[0] * pval[1] + pb[1] * pval[5] + pb[2] * pval[ 9] + pb[3] * pval[13];
-                pc[2] += pb[0] * pval[2] + pb[1] * pval[6] + pb[2] * pval[10] + pb[3] * pval[14];
-                pc[3] += pb[0] * pval[3] + pb[1] * pval[7] + pb[2] * pval[11] + pb[3] * pval[15];
+                t0 += pb[0] * pval[0] + pb[1] * pval[4] + pb[2] * pval[ 8] + pb[3] * pval[12];
+                t1 += pb[0] * pval[1] + pb[1] * pval[5] + pb[2] * pval[ 9] + pb[3] * pval[13];
+                t2 += pb[0] * pval[2] + pb[1] * pval[6] + pb[2] * pval[10] + pb[3] * pval[14];
+                t3 += pb[0] * pval[3] + pb[1] * pval[7] + pb[2] * pval[11] + pb[3] * pval[15];
                 pval += 16;
             }
+            pc[0] = t0;
+            pc[1] = t1;
+            pc[2] = t2;
+            pc[3] = t3;
+#endif
             pc += 4;
         }
     }
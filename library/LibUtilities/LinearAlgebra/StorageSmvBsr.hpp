@@ -49,8 +49,13 @@ namespace Nektar
     /*
      *  Zero-based BSR (Block Sparse Row) storage class with its sparse
      *  multiply kernels built upon its own dense unrolled multiply kernels
-     *  up to 4x4 matrices. When matrix is larger than or 4x4, the
-     *  multiply kernel calls dense dgemv from BLAS.
+     *  up to 4x4 matrices. When matrix is larger than 4x4, the
+     *  multiply kernel calls dense dgemv from BLAS. The 2x2 and 4x4
+     *  kernels use SSE2 and AVX instructions where these are enabled at
+     *  compile time.
+     *
+     *  The multiply may be split by block rows across the worker threads
+     *  of the session thread manager, see SetNumThreads().
      *
      *  The BSR sparse format assumes sparse matrix is a CSR collection of
      *  dense square blocks of same size. In contrast with Nist BSR class
@@ -155,6 +160,15 @@ namespace Nektar
         LIB_UTILITIES_EXPORT void MultiplyLight(const DataVectorType &in,
                                  DataVectorType &out);
 
+        // Multiply the block rows [rowStart, rowEnd) only
+        LIB_UTILITIES_EXPORT void MultiplyRange(const IndexType rowStart,
+                            const IndexType rowEnd,
+                            const DataType* in,
+                                  DataType* out);
+
+        // Split subsequent multiplies across up to nThreads threads
+        LIB_UTILITIES_EXPORT void SetNumThreads(const unsigned int nThreads);
+
 
     protected:
 
@@ -202,6 +216,9 @@ namespace Nektar
         IndexVectorType  m_indx; // column indices of non-zero entries
         IndexVectorType  m_pntr; // m_pntr(i) contains index in m_val of first non-zero element in row i
 
+        // first block row of each thread partition, followed by m_blkRows
+        std::vector<IndexType> m_partRows;
+
     private:
 
     };
@@ -0,0 +1,386 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: StorageSmvSell.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: 0-based sparse SELL-C-sigma storage class with own multiply
+//              kernels.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <numeric>
+
+#include <LibUtilities/BasicUtils/ErrorUtil.hpp>
+#include <LibUtilities/BasicUtils/Thread.h>
+#include <LibUtilities/LinearAlgebra/StorageSmvSell.hpp>
+
+namespace Nektar
+{
+    /// Minimum number of stored values per thread for which a threaded
+    /// multiply is worthwhile.
+    static const IndexType kSellMinValuesPerThread = 16384;
+
+    /// Multiplies one partition of chunks on a worker thread.
+    template<typename DataType>
+    class SmvSellMultiplyJob : public Thread::ThreadJob
+    {
+        public:
+            SmvSellMultiplyJob(StorageSmvSell<DataType> *storage,
+                               IndexType chunkStart, IndexType chunkEnd,
+                               const DataType *in, DataType *out)
+                : m_storage(storage), m_chunkStart(chunkStart),
+                  m_chunkEnd(chunkEnd), m_in(in), m_out(out)
+            {
+            }
+
+            virtual void Run()
+            {
+                m_storage->MultiplyRange(m_chunkStart, m_chunkEnd, m_in,
+                                         m_out);
+            }
+
+        private:
+            StorageSmvSell<DataType> *m_storage;
+            IndexType                 m_chunkStart;
+            IndexType                 m_chunkEnd;
+            const DataType           *m_in;
+            DataType                 *m_out;
+    };
+
+
+    template<typename DataType>
+    StorageSmvSell<DataType>::StorageSmvSell(
+                    const IndexType  rows,
+                    const IndexType  columns,
+                    const COOMatType&   cooMat,
+                    const IndexType  chunkSize,
+                    const IndexType  sortWindow):
+        m_rows      (rows),
+        m_columns   (columns),
+        m_chunkSize (chunkSize),
+        m_nChunks   ((rows + chunkSize - 1) / chunkSize),
+        m_nnz       (cooMat.size()),
+        m_pntr      (m_nChunks + 1),
+        m_perm      (m_nChunks * chunkSize, rows),
+        m_partChunks(1, m_nChunks)
+    {
+        ASSERTL0(chunkSize > 0, "SELL chunk size must be positive.");
+        ASSERTL0(sortWindow > 0, "SELL sorting window must be positive.");
+
+        // Convert to CSR; the COO entries are ordered by row.
+        std::vector<IndexType> rowPntr(rows + 1, 0);
+        for (auto &entry : cooMat)
+        {
+            rowPntr[entry.first.first + 1]++;
+        }
+        std::partial_sum(rowPntr.begin(), rowPntr.end(), rowPntr.begin());
+
+        // Sort the rows by decreasing length within each window.
+        std::vector<IndexType> order(rows);
+        std::iota(order.begin(), order.end(), 0);
+        for (IndexType w = 0; w < rows; w += sortWindow)
+        {
+            std::stable_sort(
+                order.begin() + w,
+                order.begin() + std::min(w + sortWindow, rows),
+                [&rowPntr](IndexType a, IndexType b)
+                {
+                    return rowPntr[a+1] - rowPntr[a] >
+                           rowPntr[b+1] - rowPntr[b];
+                });
+        }
+        std::copy(order.begin(), order.end(), &m_perm[0]);
+
+        // Chunks are padded to the length of their longest row.
+        m_pntr[0] = 0;
+        for (IndexType c = 0; c < m_nChunks; ++c)
+        {
+            IndexType width = 0;
+            for (IndexType r = 0; r < chunkSize; ++r)
+            {
+                IndexType row = m_perm[c*chunkSize + r];
+                if (row < rows)
+                {
+                    width = std::max(width, rowPntr[row+1] - rowPntr[row]);
+                }
+            }
+            m_pntr[c+1] = m_pntr[c] + width*chunkSize;
+        }
+
+        // Padding entries are zero and refer to the first column.
+        m_val  = DataVectorType (m_pntr[m_nChunks], 0.0);
+        m_indx = IndexVectorType(m_pntr[m_nChunks], (IndexType)0);
+
+        std::vector<IndexType> pos(rowPntr.begin(), rowPntr.end() - 1);
+        std::vector<IndexType> sortedPos(rows);
+        for (IndexType i = 0; i < rows; ++i)
+        {
+            sortedPos[m_perm[i]] = i;
+        }
+
+        for (auto &entry : cooMat)
+        {
+            IndexType row = entry.first.first;
+            IndexType i   = sortedPos[row];
+            IndexType c   = i / chunkSize;
+            IndexType k   = pos[row]++ - rowPntr[row];
+            IndexType loc = m_pntr[c] + k*chunkSize + i % chunkSize;
+
+            m_val [loc] = entry.second;
+            m_indx[loc] = entry.first.second;
+        }
+    }
+
+    template<typename DataType>
+    StorageSmvSell<DataType>::~StorageSmvSell()
+    {
+    }
+
+    template<typename DataType>
+    IndexType StorageSmvSell<DataType>::GetRows() const
+    {
+        return m_rows;
+    }
+
+    template<typename DataType>
+    IndexType StorageSmvSell<DataType>::GetColumns() const
+    {
+        return m_columns;
+    }
+
+    template<typename DataType>
+    IndexType StorageSmvSell<DataType>::GetNumNonZeroEntries() const
+    {
+        return m_nnz;
+    }
+
+    template<typename DataType>
+    IndexType StorageSmvSell<DataType>::GetNumStoredDoubles() const
+    {
+        return m_pntr[m_nChunks];
+    }
+
+    template<typename DataType>
+    IndexType StorageSmvSell<DataType>::GetChunkSize() const
+    {
+        return m_chunkSize;
+    }
+
+    template<typename DataType>
+    DataType StorageSmvSell<DataType>::GetFillInRatio() const
+    {
+        return (DataType)m_pntr[m_nChunks]/(DataType)m_nnz;
+    }
+
+    template<typename DataType>
+    size_t StorageSmvSell<DataType>::GetMemoryUsage() const
+    {
+        return sizeof(DataType) *m_val.capacity()   +
+               sizeof(IndexType)*m_indx.capacity() +
+               sizeof(IndexType)*m_pntr.capacity() +
+               sizeof(IndexType)*m_perm.capacity() +
+               sizeof(IndexType)*m_partChunks.capacity() +
+               sizeof(IndexType)*5;  //< rows + columns + chunkSize + nChunks + nnz
+    }
+
+
+    // C = A*B where A is matrix and B is vector.
+    // No scaling. Previous content of C is discarded.
+    template<typename DataType>
+    void StorageSmvSell<DataType>::Multiply(
+            const DataVectorType &in,
+                  DataVectorType &out)
+    {
+        Multiply(&in[0], &out[0]);
+    }
+
+    template<typename DataType>
+    void StorageSmvSell<DataType>::Multiply(
+            const DataType*  in,
+                  DataType*  out)
+    {
+        const int nParts = m_partChunks.size() - 1;
+
+        Thread::ThreadManagerSharedPtr tm;
+        if (nParts > 1)
+        {
+            tm = Thread::GetThreadMaster().GetInstance(
+                Thread::ThreadMaster::SessionJob);
+        }
+
+        if (nParts < 2 || !tm->IsInitialised() || tm->InThread())
+        {
+            MultiplyRange(0, m_nChunks, in, out);
+            return;
+        }
+
+        std::vector<Thread::ThreadJob*> jobs(nParts);
+        for (int p = 0; p < nParts; ++p)
+        {
+            jobs[p] = new SmvSellMultiplyJob<DataType>(
+                this, m_partChunks[p], m_partChunks[p+1], in, out);
+        }
+
+        tm->QueueJobs(jobs);
+        tm->Wait();
+    }
+
+    /// Multiply the rows held in chunks [chunkStart, chunkEnd), writing the
+    /// corresponding entries of @p out only.
+    template<typename DataType>
+    void StorageSmvSell<DataType>::MultiplyRange(
+            const IndexType chunkStart,
+            const IndexType chunkEnd,
+            const DataType* in,
+                  DataType* out)
+    {
+        switch(m_chunkSize)
+        {
+        case 4:  Multiply_chunks<4>(chunkStart,chunkEnd,in,out); return;
+        case 8:  Multiply_chunks<8>(chunkStart,chunkEnd,in,out); return;
+        default:
+            {
+                Multiply_generic(chunkStart,chunkEnd,in,out); return;
+            }
+        }
+    }
+
+    /// Partition the chunks into at most @p nThreads ranges holding
+    /// similar numbers of stored values. Fewer partitions are used for small
+    /// matrices, for which the threading overhead would dominate.
+    template<typename DataType>
+    void StorageSmvSell<DataType>::SetNumThreads(const unsigned int nThreads)
+    {
+        const IndexType nValues = m_pntr[m_nChunks];
+        const IndexType nParts  = std::max(1u, std::min(
+            std::min((IndexType)nThreads, m_nChunks),
+            nValues / kSellMinValuesPerThread));
+
+        m_partChunks.resize(nParts+1);
+        m_partChunks[0]      = 0;
+        m_partChunks[nParts] = m_nChunks;
+
+        for (IndexType p = 1; p < nParts; ++p)
+        {
+            IndexType target = (IndexType)((size_t)nValues * p / nParts);
+            const IndexType *chunk = std::lower_bound(
+                &m_pntr[0], &m_pntr[0] + m_nChunks + 1, target);
+            m_partChunks[p] = std::max(m_partChunks[p-1],
+                std::min((IndexType)(chunk - &m_pntr[0]), m_nChunks));
+        }
+    }
+
+    /// SELL multiply for a chunk size known at compile time, so that the
+    /// loop over the rows of a chunk is unrolled and vectorised.
+    template<typename DataType>
+    template<int C>
+    void StorageSmvSell<DataType>::Multiply_chunks(
+            const IndexType chunkStart,
+            const IndexType chunkEnd,
+            const DataType* in,
+                  DataType* out)
+    {
+        for (IndexType c = chunkStart; c < chunkEnd; ++c)
+        {
+            const DataType  *pval  = &m_val[0]  + m_pntr[c];
+            const IndexType *pindx = &m_indx[0] + m_pntr[c];
+            const IndexType  width = (m_pntr[c+1] - m_pntr[c]) / C;
+
+            DataType t[C];
+            for (int r = 0; r < C; ++r)
+            {
+                t[r] = 0;
+            }
+
+            for (IndexType k = 0; k < width; ++k)
+            {
+                for (int r = 0; r < C; ++r)
+                {
+                    t[r] += pval[r] * in[pindx[r]];
+                }
+                pval  += C;
+                pindx += C;
+            }
+
+            const IndexType *pperm = &m_perm[0] + c*C;
+            for (int r = 0; r < C; ++r)
+            {
+                if (pperm[r] < m_rows)
+                {
+                    out[pperm[r]] = t[r];
+                }
+            }
+        }
+    }
+
+    /// SELL multiply for any chunk size
+    template<typename DataType>
+    void StorageSmvSell<DataType>::Multiply_generic(
+            const IndexType chunkStart,
+            const IndexType chunkEnd,
+            const DataType* in,
+                  DataType* out)
+    {
+        const IndexType C = m_chunkSize;
+        std::vector<DataType> t(C);
+
+        for (IndexType c = chunkStart; c < chunkEnd; ++c)
+        {
+            const DataType  *pval  = &m_val[0]  + m_pntr[c];
+            const IndexType *pindx = &m_indx[0] + m_pntr[c];
+            const IndexType  width = (m_pntr[c+1] - m_pntr[c]) / C;
+
+            std::fill(t.begin(), t.end(), 0.0);
+            for (IndexType k = 0; k < width; ++k)
+            {
+                for (IndexType r = 0; r < C; ++r)
+                {
+                    t[r] += pval[r] * in[pindx[r]];
+                }
+                pval  += C;
+                pindx += C;
+            }
+
+            const IndexType *pperm = &m_perm[0] + c*C;
+            for (IndexType r = 0; r < C; ++r)
+            {
+                if (pperm[r] < m_rows)
+                {
+                    out[pperm[r]] = t[r];
+                }
+            }
+        }
+    }
+
+
+    // explicit instantiation
+    template class StorageSmvSell<NekDouble>;
+
+
+} // namespace
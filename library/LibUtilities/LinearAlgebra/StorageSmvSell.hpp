@@ -0,0 +1,130 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: StorageSmvSell.hpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: 0-based sparse SELL-C-sigma storage class with own multiply
+//              kernels.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_UTILITIES_LINEAR_ALGEBRA_STORAGE_SMV_SELL_HPP
+#define NEKTAR_LIB_UTILITIES_LINEAR_ALGEBRA_STORAGE_SMV_SELL_HPP
+
+#include <vector>
+
+#include <LibUtilities/LibUtilitiesDeclspec.h>
+#include <LibUtilities/LinearAlgebra/SparseMatrixFwd.hpp>
+
+namespace Nektar
+{
+    /*
+     *  Zero-based SELL-C-sigma (sliced ELLPACK) storage class.
+     *
+     *  The rows of the matrix are sorted by decreasing number of nonzeros
+     *  within windows of sigma rows, and the sorted rows are grouped in
+     *  chunks of C rows. Each chunk is stored column-major and padded to the
+     *  length of its longest row, so that the multiply kernel processes C
+     *  rows at once with contiguous loads, which the compiler can vectorise.
+     *  The sorting keeps the padding small for matrices with varying row
+     *  lengths, such as statically condensed systems.
+     *
+     *  The constructor takes the input matrix in elemental coordinate (COO)
+     *  format. The multiply may be split by chunks across the worker threads
+     *  of the session thread manager, see SetNumThreads().
+     */
+    template<typename T>
+    class StorageSmvSell
+    {
+    public:
+        typedef T                             DataType;
+        typedef Array<OneD, DataType>         DataVectorType;
+        typedef Array<OneD, const DataType>   ConstDataVectorType;
+        typedef Array<OneD, IndexType>        IndexVectorType;
+
+        // Constructs zero-based SELL-C-sigma matrix based on input COO storage
+        LIB_UTILITIES_EXPORT StorageSmvSell(const IndexType  rows,
+                             const IndexType  columns,
+                             const COOMatType&   cooMat,
+                             const IndexType  chunkSize  = 8,
+                             const IndexType  sortWindow = 256);
+
+        LIB_UTILITIES_EXPORT ~StorageSmvSell();
+
+        LIB_UTILITIES_EXPORT IndexType GetRows() const;
+        LIB_UTILITIES_EXPORT IndexType GetColumns() const;
+        LIB_UTILITIES_EXPORT IndexType GetNumNonZeroEntries() const;
+        LIB_UTILITIES_EXPORT IndexType GetNumStoredDoubles() const;
+        LIB_UTILITIES_EXPORT IndexType GetChunkSize() const;
+        LIB_UTILITIES_EXPORT DataType  GetFillInRatio() const;
+        LIB_UTILITIES_EXPORT size_t GetMemoryUsage() const;
+
+        LIB_UTILITIES_EXPORT void Multiply(const DataType* in,
+                            DataType* out);
+        LIB_UTILITIES_EXPORT void Multiply(const DataVectorType &in,
+                            DataVectorType &out);
+
+        // Multiply the rows held in chunks [chunkStart, chunkEnd) only
+        LIB_UTILITIES_EXPORT void MultiplyRange(const IndexType chunkStart,
+                            const IndexType chunkEnd,
+                            const DataType* in,
+                                  DataType* out);
+
+        // Split subsequent multiplies across up to nThreads threads
+        LIB_UTILITIES_EXPORT void SetNumThreads(const unsigned int nThreads);
+
+    protected:
+        template<int C>
+        void Multiply_chunks(const IndexType chunkStart,
+                    const IndexType chunkEnd,
+                    const DataType* in,
+                          DataType* out);
+
+        void Multiply_generic(const IndexType chunkStart,
+                    const IndexType chunkEnd,
+                    const DataType* in,
+                          DataType* out);
+
+        IndexType        m_rows;       // number of rows
+        IndexType        m_columns;    // number of columns
+        IndexType        m_chunkSize;  // number of rows in each chunk (C)
+        IndexType        m_nChunks;    // number of chunks
+        IndexType        m_nnz;        // number of nonzero entries
+
+        DataVectorType   m_val;   // values, column-major within each chunk
+        IndexVectorType  m_indx;  // column indices of the values
+        IndexVectorType  m_pntr;  // m_pntr(c) contains index in m_val of first entry of chunk c
+        IndexVectorType  m_perm;  // original row of each sorted row, or m_rows for padding
+
+        // first chunk of each thread partition, followed by m_nChunks
+        std::vector<IndexType> m_partChunks;
+    };
+
+} // namespace
+
+#endif //NEKTAR_LIB_UTILITIES_LINEAR_ALGEBRA_STORAGE_SMV_SELL_HPP
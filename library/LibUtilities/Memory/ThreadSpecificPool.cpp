@@ -31,8 +31,232 @@
 
 #include <LibUtilities/Memory/ThreadSpecificPool.hpp>
 
+#include <algorithm>
+#include <iomanip>
+#include <new>
+
+#include <boost/align/aligned_alloc.hpp>
+
 namespace Nektar
 {
+    namespace detail
+    {
+        namespace
+        {
+            /// Space reserved for the header at the start of each slab.
+            const size_t SlabHeaderSize = 64;
+
+            /// Number of pools created, used to index the thread caches.
+            std::atomic<size_t> s_numPools(0);
+
+            /// Caches of the calling thread, indexed by pool id.
+            thread_local std::vector<PoolCache*>* t_caches = nullptr;
+
+            /// Set once the caches of the calling thread have been orphaned.
+            thread_local bool t_exited = false;
+
+            /// Orphans the caches of a thread when it exits.
+            struct ThreadCacheGuard
+            {
+                bool active;
+
+                ~ThreadCacheGuard()
+                {
+                    std::vector<PoolCache*>* caches = t_caches;
+                    t_caches = nullptr;
+                    t_exited = true;
+
+                    for (auto &cache : *caches)
+                    {
+                        if (cache)
+                        {
+                            cache->pool->Orphan(cache);
+                        }
+                    }
+                    delete caches;
+                }
+            };
+
+            thread_local ThreadCacheGuard t_guard;
+        }
+
+        ThreadSpecificPool::ThreadSpecificPool(size_t ByteSize) :
+            m_blockSize(ByteSize),
+            m_id(s_numPools++)
+        {
+            // Blocks must hold the free list pointer, and are aligned to 16
+            // bytes if they are large enough to hold vectorised data.
+            size_t size  = std::max(ByteSize, sizeof(void*));
+            size_t align = sizeof(void*);
+            while (align < size && align < 16)
+            {
+                align *= 2;
+            }
+            m_stride = (size + align - 1) / align * align;
+
+            ASSERTL0(m_stride <= SlabSize - SlabHeaderSize,
+                     "Pool block size " + std::to_string(ByteSize) +
+                     " is too large for a slab.");
+        }
+
+        PoolCache* ThreadSpecificPool::PeekCache()
+        {
+            std::vector<PoolCache*>* caches = t_caches;
+            if (caches && m_id < caches->size())
+            {
+                return (*caches)[m_id];
+            }
+            return nullptr;
+        }
+
+        PoolCache* ThreadSpecificPool::CreateCache()
+        {
+            if (!t_caches)
+            {
+                t_caches = new std::vector<PoolCache*>();
+                if (!t_exited)
+                {
+                    // Construct the guard so the caches are orphaned on
+                    // exit. Allocations made during thread exit keep their
+                    // caches for the remaining lifetime of the process.
+                    t_guard.active = true;
+                }
+            }
+
+            PoolCache* cache;
+            {
+                boost::mutex::scoped_lock lock(m_mutex);
+                if (m_orphans.empty())
+                {
+                    cache = new PoolCache(this);
+                    m_caches.push_back(cache);
+                }
+                else
+                {
+                    cache = m_orphans.back();
+                    m_orphans.pop_back();
+                }
+            }
+
+            if (t_caches->size() <= m_id)
+            {
+                t_caches->resize(m_id + 1, nullptr);
+            }
+            (*t_caches)[m_id] = cache;
+            return cache;
+        }
+
+        void ThreadSpecificPool::Refill(PoolCache* cache)
+        {
+            // Use the blocks returned by other threads if there are any.
+            void* remote = cache->remoteFree.exchange(
+                nullptr, std::memory_order_acquire);
+            if (remote)
+            {
+                cache->freeList = remote;
+                return;
+            }
+
+            char* slab = static_cast<char*>(
+                boost::alignment::aligned_alloc(SlabSize, SlabSize));
+            if (!slab)
+            {
+                throw std::bad_alloc();
+            }
+            reinterpret_cast<PoolSlab*>(slab)->owner = cache;
+
+            // Thread the blocks in order of increasing address.
+            size_t nBlocks = (SlabSize - SlabHeaderSize) / m_stride;
+            void* list = nullptr;
+            for (size_t i = nBlocks; i-- > 0; )
+            {
+                void* block = slab + SlabHeaderSize + i * m_stride;
+                *static_cast<void**>(block) = list;
+                list = block;
+            }
+
+            cache->freeList = list;
+            Increment(cache->slabs);
+        }
+
+        void ThreadSpecificPool::Orphan(PoolCache* cache)
+        {
+            boost::mutex::scoped_lock lock(m_mutex);
+            m_orphans.push_back(cache);
+        }
+
+        PoolStatistics ThreadSpecificPool::GetStatistics()
+        {
+            PoolStatistics stats;
+            stats.blockSize = m_blockSize;
+            stats.allocs    = 0;
+            stats.inUse     = 0;
+            stats.reserved  = 0;
+
+            size_t frees = 0;
+            boost::mutex::scoped_lock lock(m_mutex);
+            for (auto &cache : m_caches)
+            {
+                stats.allocs   += cache->allocs.load(std::memory_order_relaxed);
+                frees          += cache->frees.load(std::memory_order_relaxed);
+                frees          += cache->remoteFrees.load(
+                                      std::memory_order_relaxed);
+                stats.reserved += cache->slabs.load(
+                                      std::memory_order_relaxed) * SlabSize;
+            }
+
+            // Counters read while other threads allocate may be slightly
+            // out of step with each other.
+            stats.inUse   = stats.allocs > frees ? stats.allocs - frees : 0;
+            stats.threads = m_caches.size();
+            return stats;
+        }
+    }
+
+    std::vector<detail::PoolStatistics> MemPool::GetStatistics()
+    {
+        std::vector<detail::PoolStatistics> stats;
+        stats.push_back(m_fourBytePool.GetStatistics());
+        for (auto &pool : m_pools)
+        {
+            stats.push_back(pool.second->GetStatistics());
+        }
+        return stats;
+    }
+
+    void MemPool::PrintStatistics(std::ostream& out)
+    {
+        std::vector<detail::PoolStatistics> stats = GetStatistics();
+
+        out << "Memory pool statistics:" << std::endl;
+        out << std::setw(12) << "Block size"
+            << std::setw(16) << "Allocations"
+            << std::setw(16) << "Blocks in use"
+            << std::setw(16) << "Reserved (kB)"
+            << std::setw(10) << "Threads" << std::endl;
+
+        size_t reserved = 0;
+        for (auto &s : stats)
+        {
+            out << std::setw(12) << s.blockSize
+                << std::setw(16) << s.allocs
+                << std::setw(16) << s.inUse
+                << std::setw(16) << s.reserved / 1024
+                << std::setw(10) << s.threads << std::endl;
+            reserved += s.reserved;
+        }
+
+        out << "Large allocations: "
+            << m_largeAllocs.load(std::memory_order_relaxed)
+            << ", in use: "
+            << m_largeBytes.load(std::memory_order_relaxed) / 1024
+            << " kB, peak: "
+            << m_largePeak.load(std::memory_order_relaxed) / 1024
+            << " kB" << std::endl;
+        out << "Total pool memory reserved: " << reserved / 1024 << " kB"
+            << std::endl;
+    }
+
     MemPool& GetMemoryPool()
     {
         static MemPool instance;
@@ -36,15 +36,16 @@
 #ifndef NEKTAR_LIB_UTILITES_THREAD_SPECIFIC_POOL_HPP
 #define NEKTAR_LIB_UTILITES_THREAD_SPECIFIC_POOL_HPP
 
-#include <boost/pool/pool.hpp>
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <map>
+#include <ostream>
+#include <vector>
 #include <LibUtilities/BasicUtils/ErrorUtil.hpp>
 #include <LibUtilities/LibUtilitiesDeclspec.h>
 
-#ifdef NEKTAR_USE_THREAD_SAFETY
 #include <boost/thread/mutex.hpp>
-#endif
 
 #include <cstring>
 
@@ -52,6 +53,62 @@ namespace Nektar
 {
     namespace detail
     {
+        class ThreadSpecificPool;
+
+        /// \internal
+        /// \brief The free lists of a single thread for one pool.
+        ///
+        /// The local free list is only used by the thread owning the cache.
+        /// Blocks freed by other threads are pushed onto the lock-free remote
+        /// list, which the owner takes as a whole once its local list is
+        /// empty. The statistics are only written by the owner, apart from
+        /// remoteFrees.
+        struct PoolCache
+        {
+            PoolCache(ThreadSpecificPool *p) :
+                pool(p),
+                freeList(nullptr),
+                remoteFree(nullptr),
+                allocs(0),
+                frees(0),
+                remoteFrees(0),
+                slabs(0)
+            {
+            }
+
+            ThreadSpecificPool* pool;
+            void* freeList;
+            std::atomic<void*> remoteFree;
+            std::atomic<size_t> allocs;
+            std::atomic<size_t> frees;
+            std::atomic<size_t> remoteFrees;
+            std::atomic<size_t> slabs;
+        };
+
+        /// \internal
+        /// \brief Header at the start of each slab of blocks.
+        struct PoolSlab
+        {
+            PoolCache* owner;
+        };
+
+        /// \internal
+        /// \brief Usage statistics of a pool.
+        struct PoolStatistics
+        {
+            /// Size of the blocks handed out by the pool.
+            size_t blockSize;
+            /// Number of allocations made from the pool.
+            size_t allocs;
+            /// Number of blocks currently allocated.
+            size_t inUse;
+            /// Bytes reserved from the system. Slabs are never returned, so
+            /// this is also the peak memory used by the pool.
+            size_t reserved;
+            /// Number of threads which have used the pool.
+            size_t threads;
+        };
+
         /// \internal
         /// \brief A memory pool which exists on a thread by thread basis.
         /// \param ByteSize The number of bytes in each chunk allocated by the pool.
@@ -60,6 +117,15 @@ namespace Nektar
         /// The pool allocates and deallocates raw memory - the user is responsible for
         /// calling appropriate constructors/destructors when allocating objects.
         ///
+        /// Each thread allocates from its own free list, so that no locks are
+        /// taken on allocation or deallocation. Blocks are carved from slabs
+        /// of #SlabSize bytes aligned to their size, so that the cache owning a
+        /// block is found from the slab header. A block freed by a thread
+        /// other than its owner is returned to the owner's cache with an
+        /// atomic push. When a thread exits its caches are kept, so that
+        /// blocks still in use elsewhere remain valid, and are adopted by the
+        /// next thread to use the pool.
+        ///
         /// Example:
         ///
         /// \code
@@ -78,31 +144,30 @@ namespace Nektar
         class ThreadSpecificPool
         {
             public:
-                ThreadSpecificPool(size_t ByteSize) :
-                    m_pool(),
-                    m_blockSize(ByteSize)
-                {
-                    // We can't do the new in the constructor list because the
-                    // thread specific pointer doesn't have a supporting
-                    // constructor.
-                    m_pool = new boost::pool<>(m_blockSize);
-                }
+                /// Size and alignment of the slabs blocks are carved from.
+                static const size_t SlabSize = 65536;
+
+                LIB_UTILITIES_EXPORT ThreadSpecificPool(size_t ByteSize);
 
                 ~ThreadSpecificPool()
                 {
-                    // The documentation isn't particularly clear if delete needs to be called manually
-                    // or if the thread specific pointer will call delete for me.  Looking through the 
-                    // boost code doesn't make it any clearer. 
+                    // Slabs are not released, since blocks may still be
+                    // returned by objects destroyed after the pool.
                 }
 
                 /// \brief Allocate a block of memory of size ByteSize.
                 /// \throw std::bad_alloc if memory is exhausted.
                 void* Allocate()
                 {
-#ifdef NEKTAR_USE_THREAD_SAFETY
-                    boost::mutex::scoped_lock l(m_mutex);
-#endif
-                    void* result = m_pool->malloc();
+                    PoolCache* cache = GetCache();
+                    if (!cache->freeList)
+                    {
+                        Refill(cache);
+                    }
+
+                    void* result = cache->freeList;
+                    cache->freeList = *static_cast<void**>(result);
+                    Increment(cache->allocs);
 
 #if defined(NEKTAR_DEBUG) || defined(NEKTAR_FULLDEBUG)
                     memset(result, 0, m_blockSize);
@@ -117,30 +182,65 @@ namespace Nektar
                 /// from this pool.  Doing this will result in undefined behavior.
                 void Deallocate(const void* p)
                 {
-#ifdef NEKTAR_USE_THREAD_SAFETY
-                    boost::mutex::scoped_lock l(m_mutex);
-#endif
-#if defined(NEKTAR_DEBUG) || defined(NEKTAR_FULLDEBUG)
-                    // The idea here is to fill the returned memory with some known
-                    // pattern, then detect that pattern on the allocate.  If the 
-                    // pattern is no longer there then some memory corruption has 
-                    // occurred.  However, I'm not sure how to distinguish between first
-                    // time allocations and repeat allocations.
-
-                    //memset(p, '+', m_pool->get_requested_size());
-#endif //defined(NEKTAR_DEBUG) || defined(NEKTAR_FULLDEBUG)
+                    void* block = const_cast<void*>(p);
+                    PoolCache* owner = reinterpret_cast<PoolSlab*>(
+                        reinterpret_cast<std::uintptr_t>(block) &
+                        ~static_cast<std::uintptr_t>(SlabSize - 1))->owner;
 
-                    m_pool->free(const_cast<void*>(p));
+                    if (owner == PeekCache())
+                    {
+                        *static_cast<void**>(block) = owner->freeList;
+                        owner->freeList = block;
+                        Increment(owner->frees);
+                    }
+                    else
+                    {
+                        void* head = owner->remoteFree.load(
+                            std::memory_order_relaxed);
+                        do
+                        {
+                            *static_cast<void**>(block) = head;
+                        }
+                        while (!owner->remoteFree.compare_exchange_weak(
+                                   head, block, std::memory_order_release,
+                                   std::memory_order_relaxed));
+                        owner->remoteFrees.fetch_add(
+                            1, std::memory_order_relaxed);
+                    }
                 }
 
+                /// \brief Return the usage statistics, summed over threads.
+                LIB_UTILITIES_EXPORT PoolStatistics GetStatistics();
+
+                /// \brief Keep the cache of an exiting thread for adoption
+                /// by another thread.
+                LIB_UTILITIES_EXPORT void Orphan(PoolCache* cache);
 
             private:
-                //boost::thread_specific_ptr<boost::pool<> > m_pool;
-                boost::pool<>* m_pool;
                 size_t m_blockSize;
-#ifdef NEKTAR_USE_THREAD_SAFETY
+                size_t m_stride;
+                size_t m_id;
+                std::vector<PoolCache*> m_caches;
+                std::vector<PoolCache*> m_orphans;
                 boost::mutex m_mutex;
-#endif
+
+                PoolCache* GetCache()
+                {
+                    PoolCache* cache = PeekCache();
+                    return cache ? cache : CreateCache();
+                }
+
+                /// Cache of the calling thread, or null if it has none.
+                LIB_UTILITIES_EXPORT PoolCache* PeekCache();
+                LIB_UTILITIES_EXPORT PoolCache* CreateCache();
+                LIB_UTILITIES_EXPORT void Refill(PoolCache* cache);
+
+                /// Increment a counter only written by a single thread.
+                static void Increment(std::atomic<size_t>& counter)
+                {
+                    counter.store(counter.load(std::memory_order_relaxed) + 1,
+                                  std::memory_order_relaxed);
+                }
         };
     }
 
@@ -153,7 +253,10 @@ namespace Nektar
             MemPool() :
                 m_fourBytePool(4),
                 m_pools(),
-                m_upperBound(1024)
+                m_upperBound(1024),
+                m_largeAllocs(0),
+                m_largeBytes(0),
+                m_largePeak(0)
             {
                 // The m_pools data member stores a collection of thread specific pools of varying size.  All memory requests
                 // up to and including the largest pool size will be allocated from a pool (note that this means you may receive
@@ -193,7 +296,9 @@ namespace Nektar
                 }
                 else if( bytes > m_upperBound )
                 {
-                    return ::operator new(bytes);
+                    void* result = ::operator new(bytes);
+                    AddLarge(bytes);
+                    return result;
                 }
                 else
                 {
@@ -218,6 +323,7 @@ namespace Nektar
                 else if( bytes > m_upperBound )
                 {
                     ::operator delete(p);
+                    m_largeBytes.fetch_sub(bytes, std::memory_order_relaxed);
                 }
                 else
                 {
@@ -228,11 +334,36 @@ namespace Nektar
                     (*iter).second->Deallocate(p);
                 }
             }
-            
+
+            /// \brief Return the statistics of each pool, in order of
+            /// increasing block size.
+            LIB_UTILITIES_EXPORT std::vector<detail::PoolStatistics> GetStatistics();
+
+            /// \brief Print the allocations made from each pool, and the
+            /// current and peak memory used by the pools and by allocations
+            /// too large for the pools.
+            LIB_UTILITIES_EXPORT void PrintStatistics(std::ostream& out);
+
         private:
             detail::ThreadSpecificPool m_fourBytePool;
             std::map<size_t, std::shared_ptr<detail::ThreadSpecificPool> > m_pools;
             size_t m_upperBound;
+            std::atomic<size_t> m_largeAllocs;
+            std::atomic<size_t> m_largeBytes;
+            std::atomic<size_t> m_largePeak;
+
+            void AddLarge(size_t bytes)
+            {
+                m_largeAllocs.fetch_add(1, std::memory_order_relaxed);
+                size_t current = m_largeBytes.fetch_add(
+                    bytes, std::memory_order_relaxed) + bytes;
+                size_t peak = m_largePeak.load(std::memory_order_relaxed);
+                while (current > peak &&
+                       !m_largePeak.compare_exchange_weak(
+                           peak, current, std::memory_order_relaxed))
+                {
+                }
+            }
     };
 
     LIB_UTILITIES_EXPORT MemPool& GetMemoryPool();
@@ -241,4 +372,3 @@ namespace Nektar
 
 
 #endif //NEKATAR_LIB_UTILITES_THREAD_SPECIFIC_POOL_HPP
-
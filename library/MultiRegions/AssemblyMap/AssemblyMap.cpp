@@ -173,6 +173,22 @@ namespace Nektar
                                         m_successiveRHS,0);
             }
 
+            if(pSession->DefinesGlobalSysSolnInfo(variable,
+                                                  "LinSysIterSolver"))
+            {
+                m_linSysIterSolver = pSession->GetGlobalSysSolnInfo(
+                    variable, "LinSysIterSolver");
+            }
+            else if(pSession->DefinesSolverInfo("LinSysIterSolver"))
+            {
+                m_linSysIterSolver = pSession->GetSolverInfo(
+                    "LinSysIterSolver");
+            }
+            else
+            {
+                m_linSysIterSolver = "ConjugateGradient";
+            }
+
         }
         
         /** 
@@ -190,6 +206,7 @@ namespace Nektar
             m_maxIterations(oldLevelMap->m_maxIterations),
             m_iterativeTolerance(oldLevelMap->m_iterativeTolerance),
             m_successiveRHS(oldLevelMap->m_successiveRHS),
+            m_linSysIterSolver(oldLevelMap->m_linSysIterSolver),
             m_gsh(oldLevelMap->m_gsh),
             m_bndGsh(oldLevelMap->m_bndGsh),
             m_lowestStaticCondLevel(oldLevelMap->m_lowestStaticCondLevel)
@@ -1264,6 +1281,11 @@ namespace Nektar
             return m_successiveRHS;
         }
 
+        std::string AssemblyMap::GetLinSysIterSolver() const
+        {
+            return m_linSysIterSolver;
+        }
+
         void AssemblyMap::GlobalToLocalBndWithoutSign(
                     const Array<OneD, const NekDouble>& global,
                     Array<OneD,NekDouble>& loc)
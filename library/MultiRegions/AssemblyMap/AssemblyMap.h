@@ -293,6 +293,7 @@ namespace Nektar
             MULTI_REGIONS_EXPORT NekDouble GetIterativeTolerance() const;
             MULTI_REGIONS_EXPORT int GetMaxIterations() const;
             MULTI_REGIONS_EXPORT int GetSuccessiveRHS() const;
+            MULTI_REGIONS_EXPORT std::string GetLinSysIterSolver() const;
 
             MULTI_REGIONS_EXPORT int GetLowestStaticCondLevel() const
             {
@@ -377,6 +378,9 @@ namespace Nektar
             /// sucessive RHS  for iterative solver
             int  m_successiveRHS;
 
+            /// Iterative method used to solve the linear system
+            std::string m_linSysIterSolver;
+
             Gs::gs_data * m_gsh;
             Gs::gs_data * m_bndGsh;
 
@@ -33,6 +33,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <LibUtilities/BasicUtils/HashUtils.hpp>
+#include <LibUtilities/BasicUtils/Timer.h>
 #include <MultiRegions/AssemblyMap/AssemblyMapDG.h>
 #include <MultiRegions/ExpList.h>
 #include <LocalRegions/SegExp.h>
@@ -60,6 +61,8 @@ namespace Nektar
     namespace MultiRegions
     {
         AssemblyMapDG::AssemblyMapDG():
+            m_traceGsh(0),
+            m_exchangeNumFields(0),
             m_numDirichletBndPhys(0)
         {
         }
@@ -77,7 +80,8 @@ namespace Nektar
             const Array<OneD, const SpatialDomains::BoundaryConditionShPtr> &bndCond,
             const PeriodicMap                                         &periodicTrace,
             const std::string variable):
-            AssemblyMap(pSession,variable)
+            AssemblyMap(pSession,variable),
+            m_exchangeNumFields(0)
         {
             boost::ignore_unused(graph);
 
@@ -853,6 +857,60 @@ namespace Nektar
             {
                 m_traceToUniversalMapUnique[i] = tmp2[i];
             }
+
+            SetUpTraceExchange();
+        }
+
+        /**
+         * Set up the pairwise exchange of trace points along partition
+         * boundaries used by UniversalTraceAssembleBegin. Each trace point
+         * lies on at most two elements, so it is shared with at most one
+         * other process, which is found from the minimum and maximum rank
+         * holding the point.
+         */
+        void AssemblyMapDG::SetUpTraceExchange()
+        {
+            if (!m_traceGsh)
+            {
+                return;
+            }
+
+            int nTracePhys = m_traceToUniversalMap.num_elements();
+            int rank       = m_comm->GetRank();
+
+            Array<OneD, NekDouble> minRank(nTracePhys, rank);
+            Array<OneD, NekDouble> maxRank(nTracePhys, rank);
+            Gs::Gather(minRank, Gs::gs_min, m_traceGsh);
+            Gs::Gather(maxRank, Gs::gs_max, m_traceGsh);
+
+            // Group the shared points by process, in universal ID order.
+            map<int, vector<pair<int, int> > > shared;
+            for (int i = 0; i < nTracePhys; ++i)
+            {
+                int proc = (int)minRank[i] == rank ? (int)maxRank[i]
+                                                   : (int)minRank[i];
+                if (proc != rank)
+                {
+                    shared[proc].push_back(
+                        make_pair(m_traceToUniversalMap[i], i));
+                }
+            }
+
+            m_exchangeOffsets.push_back(0);
+            for (auto &it : shared)
+            {
+                sort(it.second.begin(), it.second.end());
+
+                m_exchangeProcs.push_back(it.first);
+                for (auto &pt : it.second)
+                {
+                    m_exchangeIndices.push_back(pt.second);
+                }
+                m_exchangeOffsets.push_back(m_exchangeIndices.size());
+            }
+
+            m_exchangeRequest = m_comm->CreateRequest(
+                2 * m_exchangeProcs.size());
         }
 
         void AssemblyMapDG::RealignTraceElement(
@@ -938,9 +996,103 @@ namespace Nektar
         void AssemblyMapDG::UniversalTraceAssemble(
             Array<OneD, NekDouble> &pGlobal) const
         {
+            LibUtilities::TimerRegion region("TraceExchange");
             Gs::Gather(pGlobal, Gs::gs_add, m_traceGsh);
         }
 
+        /**
+         * Start the assembly of several trace arrays along partition
+         * boundaries, as performed by UniversalTraceAssemble. The values
+         * shared with each neighbouring process are sent for all arrays in
+         * a single message. The arrays must not be modified until
+         * UniversalTraceAssembleEnd has been called, but may be read in the
+         * meantime; only one assembly may be in progress at a time.
+         */
+        void AssemblyMapDG::UniversalTraceAssembleBegin(
+            const Array<OneD, Array<OneD, NekDouble> > &pGlobal)
+        {
+            ASSERTL1(m_exchangeNumFields == 0,
+                     "A trace assembly is already in progress.");
+
+            m_exchangeNumFields = pGlobal.num_elements();
+
+            int nFields = m_exchangeNumFields;
+            int nShared = m_exchangeIndices.size();
+
+            if (m_exchangeProcs.empty())
+            {
+                return;
+            }
+
+            if (m_exchangeSendBuf.num_elements() < nFields * nShared)
+            {
+                m_exchangeSendBuf = Array<OneD, NekDouble>(nFields * nShared);
+                m_exchangeRecvBuf = Array<OneD, NekDouble>(nFields * nShared);
+            }
+
+            Array<OneD, NekDouble> tmp;
+            for (int p = 0; p < m_exchangeProcs.size(); ++p)
+            {
+                int offset = nFields * m_exchangeOffsets[p];
+                int nPts   = m_exchangeOffsets[p+1] - m_exchangeOffsets[p];
+
+                for (int f = 0; f < nFields; ++f)
+                {
+                    Vmath::Gathr(nPts, &pGlobal[f][0],
+                                 &m_exchangeIndices[m_exchangeOffsets[p]],
+                                 &m_exchangeSendBuf[offset + f * nPts]);
+                }
+
+                m_comm->Irecv(m_exchangeProcs[p],
+                              tmp = m_exchangeRecvBuf + offset,
+                              nFields * nPts, m_exchangeRequest, 2 * p);
+                m_comm->Isend(m_exchangeProcs[p],
+                              tmp = m_exchangeSendBuf + offset,
+                              nFields * nPts, m_exchangeRequest, 2 * p + 1);
+            }
+        }
+
+        /**
+         * Complete the assembly started by UniversalTraceAssembleBegin by
+         * adding the values received from neighbouring processes.
+         */
+        void AssemblyMapDG::UniversalTraceAssembleEnd(
+            Array<OneD, Array<OneD, NekDouble> > &pGlobal)
+        {
+            ASSERTL1(m_exchangeNumFields == pGlobal.num_elements(),
+                     "Trace assembly was started with a different number "
+                     "of arrays.");
+
+            int nFields = m_exchangeNumFields;
+            m_exchangeNumFields = 0;
+
+            if (m_exchangeProcs.empty())
+            {
+                return;
+            }
+
+            LibUtilities::TimerRegion region("TraceExchange");
+
+            m_comm->WaitAll(m_exchangeRequest);
+
+            for (int p = 0; p < m_exchangeProcs.size(); ++p)
+            {
+                int offset = nFields * m_exchangeOffsets[p];
+                int nPts   = m_exchangeOffsets[p+1] - m_exchangeOffsets[p];
+                const int *idx = &m_exchangeIndices[m_exchangeOffsets[p]];
+
+                for (int f = 0; f < nFields; ++f)
+                {
+                    const NekDouble *recv =
+                        &m_exchangeRecvBuf[offset + f * nPts];
+                    for (int i = 0; i < nPts; ++i)
+                    {
+                        pGlobal[f][idx[i]] += recv[i];
+                    }
+                }
+            }
+        }
+
         int AssemblyMapDG::v_GetLocalToGlobalMap(const int i) const
         {
             return m_localToGlobalBndMap[i];
@@ -89,8 +89,30 @@ namespace Nektar
             MULTI_REGIONS_EXPORT void UniversalTraceAssemble(
                 Array<OneD, NekDouble> &pGlobal) const;
 
+            MULTI_REGIONS_EXPORT void UniversalTraceAssembleBegin(
+                const Array<OneD, Array<OneD, NekDouble> > &pGlobal);
+
+            MULTI_REGIONS_EXPORT void UniversalTraceAssembleEnd(
+                Array<OneD, Array<OneD, NekDouble> > &pGlobal);
+
         protected:
             Gs::gs_data * m_traceGsh;
+
+            /// Processes sharing trace points with this process.
+            std::vector<int> m_exchangeProcs;
+            /// Offset of the points shared with each process in
+            /// #m_exchangeIndices, with a final entry holding their total.
+            std::vector<int> m_exchangeOffsets;
+            /// Trace points shared with each process, ordered by universal
+            /// ID so that both processes agree on their order.
+            std::vector<int> m_exchangeIndices;
+            /// Buffers for the trace exchange.
+            Array<OneD, NekDouble> m_exchangeSendBuf;
+            Array<OneD, NekDouble> m_exchangeRecvBuf;
+            /// Requests of the trace exchange in progress.
+            LibUtilities::CommRequestSharedPtr m_exchangeRequest;
+            /// Number of fields in the trace exchange in progress.
+            int m_exchangeNumFields;
             
             /// Number of physical dirichlet boundary values in trace
             int m_numDirichletBndPhys;
@@ -106,6 +128,8 @@ namespace Nektar
 
             void SetUpUniversalDGMap(const ExpList &locExp);
 
+            void SetUpTraceExchange();
+
             void SetUpUniversalTraceMap(
                 const ExpList         &locExp,
                 const ExpListSharedPtr trace,
@@ -830,7 +830,7 @@ namespace Nektar
         void DisContField1D::v_GetFwdBwdTracePhys(Array<OneD, NekDouble> &Fwd,
                                                   Array<OneD, NekDouble> &Bwd)
         {
-            v_GetFwdBwdTracePhys(m_phys,Fwd,Bwd);
+            v_GetFwdBwdTracePhys(m_phys,Fwd,Bwd,true);
         }
         
         
@@ -863,7 +863,8 @@ namespace Nektar
         void DisContField1D::v_GetFwdBwdTracePhys(
             const Array<OneD, const NekDouble> &field,
             Array<OneD,       NekDouble> &Fwd,
-            Array<OneD,       NekDouble> &Bwd)
+            Array<OneD,       NekDouble> &Bwd,
+            bool DoExchange)
         {
             // Counter variables
             int  n, v;
@@ -951,8 +952,11 @@ namespace Nektar
             }
 
             // Do parallel exchange for forwards/backwards spaces.
-            m_traceMap->UniversalTraceAssemble(Fwd);
-            m_traceMap->UniversalTraceAssemble(Bwd);
+            if (DoExchange)
+            {
+                m_traceMap->UniversalTraceAssemble(Fwd);
+                m_traceMap->UniversalTraceAssemble(Bwd);
+            }
 
         }
         
@@ -1320,22 +1324,23 @@ namespace Nektar
             boost::ignore_unused(varName);
 
             int i;
-
-            Array<OneD, NekDouble> x0(1);
-            Array<OneD, NekDouble> x1(1);
-            Array<OneD, NekDouble> x2(1);
+            NekDouble x0, x1, x2;
 
             for (i = 0; i < m_bndCondExpansions.num_elements(); ++i)
             {
                 if (time == 0.0 || m_bndConditions[i]->IsTimeDependent())
                 {
-                    m_bndCondExpansions[i]->GetCoords(x0, x1, x2);
+                    const BndCondCache &coords =
+                        GetBndCondCoords(i, m_bndCondExpansions[i]);
+                    x0 = coords.m_x0[0];
+                    x1 = coords.m_x1[0];
+                    x2 = coords.m_x2[0];
                     
                     if (x2_in != NekConstants::kNekUnsetDouble && x3_in !=
                         NekConstants::kNekUnsetDouble)
                     {
-                        x1[0] = x2_in;
-                        x2[0] = x3_in;
+                        x1 = x2_in;
+                        x2 = x3_in;
                     }
                     
                     if (m_bndConditions[i]->GetBoundaryConditionType() ==
@@ -1344,7 +1349,7 @@ namespace Nektar
                         m_bndCondExpansions[i]->SetCoeff(0,
                             (std::static_pointer_cast<SpatialDomains
                              ::DirichletBoundaryCondition>(m_bndConditions[i])
-                             ->m_dirichletCondition).Evaluate(x0[0],x1[0],x2[0],time));
+                             ->m_dirichletCondition).Evaluate(x0,x1,x2,time));
                         m_bndCondExpansions[i]->SetPhys(0,m_bndCondExpansions[i]->GetCoeff(0));
                     }
                     else if (m_bndConditions[i]->GetBoundaryConditionType()
@@ -1353,7 +1358,7 @@ namespace Nektar
                         m_bndCondExpansions[i]->SetCoeff(0,
                             (std::static_pointer_cast<SpatialDomains
                              ::NeumannBoundaryCondition>(m_bndConditions[i])
-                             ->m_neumannCondition).Evaluate(x0[0],x1[0],x2[0],time));
+                             ->m_neumannCondition).Evaluate(x0,x1,x2,time));
                     }
                     else if (m_bndConditions[i]->GetBoundaryConditionType()
                             == SpatialDomains::eRobin)
@@ -1361,7 +1366,7 @@ namespace Nektar
                         m_bndCondExpansions[i]->SetCoeff(0,
                             (std::static_pointer_cast<SpatialDomains
                              ::RobinBoundaryCondition>(m_bndConditions[i])
-                             ->m_robinFunction).Evaluate(x0[0],x1[0],x2[0],time));
+                             ->m_robinFunction).Evaluate(x0,x1,x2,time));
                         
                     }
                     else if (m_bndConditions[i]->GetBoundaryConditionType()
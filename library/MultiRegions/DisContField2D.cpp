@@ -1311,7 +1311,7 @@ namespace Nektar
             Array<OneD, NekDouble> &Fwd,
             Array<OneD, NekDouble> &Bwd)
         {
-            v_GetFwdBwdTracePhys(m_phys, Fwd, Bwd);
+            v_GetFwdBwdTracePhys(m_phys, Fwd, Bwd, true);
         }
 
         /**
@@ -1342,7 +1342,8 @@ namespace Nektar
         void DisContField2D::v_GetFwdBwdTracePhys(
             const Array<OneD, const NekDouble> &field,
                   Array<OneD,       NekDouble> &Fwd,
-                  Array<OneD,       NekDouble> &Bwd)
+                  Array<OneD,       NekDouble> &Bwd,
+            bool DoExchange)
         {
             int cnt, n, e, npts, phys_offset;
 
@@ -1458,8 +1459,11 @@ namespace Nektar
             }
 
             // Do parallel exchange for forwards/backwards spaces.
-            m_traceMap->UniversalTraceAssemble(Fwd);
-            m_traceMap->UniversalTraceAssemble(Bwd);
+            if (DoExchange)
+            {
+                m_traceMap->UniversalTraceAssemble(Fwd);
+                m_traceMap->UniversalTraceAssemble(Bwd);
+            }
         }
         
 
@@ -2261,32 +2265,23 @@ namespace Nektar
             boost::ignore_unused(x3_in);
 
             int i;
-            int npoints;
             int nbnd = m_bndCondExpansions.num_elements();
 
             MultiRegions::ExpListSharedPtr locExpList;
 
+            // Find out with a single reduction which files have changed
+            CheckFileBCs(m_bndConditions, time);
+
             for (i = 0; i < nbnd; ++i)
             {
                 if (time == 0.0 || 
                     m_bndConditions[i]->IsTimeDependent())
                 {
                     locExpList = m_bndCondExpansions[i];
-                    npoints    = locExpList->GetNpoints();
-                    Array<OneD, NekDouble> x0(npoints, 0.0);
-                    Array<OneD, NekDouble> x1(npoints, 0.0);
-                    Array<OneD, NekDouble> x2(npoints, 0.0);
 
                     // Homogeneous input case for x2.
-                    if (x2_in == NekConstants::kNekUnsetDouble)
-                    {
-                        locExpList->GetCoords(x0, x1, x2);
-                    }
-                    else
-                    {
-                        locExpList->GetCoords(x0, x1, x2);
-                        Vmath::Fill(npoints, x2_in, x2, 1);
-                    }
+                    const BndCondCache &coords =
+                        GetBndCondCoords(i, locExpList, x2_in);
 
                     if (m_bndConditions[i]->GetBoundaryConditionType()
                         == SpatialDomains::eDirichlet)
@@ -2299,18 +2294,14 @@ namespace Nektar
                         
                         if (filebcs != "")
                         {
-                            ExtractFileBCs(filebcs, bcPtr->GetComm(), varName, locExpList);
+                            ExtractCachedFileBCs(i, filebcs, bcPtr->GetComm(),
+                                                 varName, locExpList);
                         }
                         else
                         {
-                            LibUtilities::Equation condition = 
-                                std::static_pointer_cast<
-                                    SpatialDomains::DirichletBoundaryCondition>
-                                        (m_bndConditions[i])->
-                                            m_dirichletCondition;
-                            
-                            condition.Evaluate(x0, x1, x2, time, 
-                                               locExpList->UpdatePhys());
+                            bcPtr->m_dirichletCondition.Evaluate(
+                                coords.m_x0, coords.m_x1, coords.m_x2, time,
+                                locExpList->UpdatePhys());
                         }
 
                         locExpList->FwdTrans_BndConstrained(
@@ -2326,17 +2317,14 @@ namespace Nektar
                         string filebcs  = bcPtr->m_filename;
                         if (filebcs != "")
                         {
-                            ExtractFileBCs(filebcs, bcPtr->GetComm(), varName, locExpList);
+                            ExtractCachedFileBCs(i, filebcs, bcPtr->GetComm(),
+                                                 varName, locExpList);
                         }
                         else
                         {
-                            LibUtilities::Equation condition =
-                                std::static_pointer_cast<
-                                    SpatialDomains::NeumannBoundaryCondition>
-                                        (m_bndConditions[i])->
-                                            m_neumannCondition;
-                            condition.Evaluate(x0, x1, x2, time, 
-                                               locExpList->UpdatePhys());
+                            bcPtr->m_neumannCondition.Evaluate(
+                                coords.m_x0, coords.m_x1, coords.m_x2, time,
+                                locExpList->UpdatePhys());
                         }
 
                         locExpList->IProductWRTBase(
@@ -2353,17 +2341,14 @@ namespace Nektar
                         
                         if (filebcs != "")
                         {
-                            ExtractFileBCs(filebcs, bcPtr->GetComm(), varName, locExpList);
+                            ExtractCachedFileBCs(i, filebcs, bcPtr->GetComm(),
+                                                 varName, locExpList);
                         }
                         else
                         {
-                            LibUtilities::Equation condition = 
-                                std::static_pointer_cast<
-                                    SpatialDomains::RobinBoundaryCondition>
-                                        (m_bndConditions[i])->
-                                            m_robinFunction;
-                            condition.Evaluate(x0, x1, x2, time,
-                                               locExpList->UpdatePhys());
+                            bcPtr->m_robinFunction.Evaluate(
+                                coords.m_x0, coords.m_x1, coords.m_x2, time,
+                                locExpList->UpdatePhys());
                         }
 
                         locExpList->IProductWRTBase(
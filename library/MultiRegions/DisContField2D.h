@@ -207,7 +207,8 @@ namespace Nektar
             virtual void v_GetFwdBwdTracePhys(
                 const Array<OneD, const NekDouble> &field,
                       Array<OneD,       NekDouble> &Fwd,
-                      Array<OneD,       NekDouble> &Bwd);
+                      Array<OneD,       NekDouble> &Bwd,
+                bool DoExchange);
             virtual void v_GetFwdBwdTracePhys(
                       Array<OneD,       NekDouble> &Fwd,
                       Array<OneD,       NekDouble> &Bwd);
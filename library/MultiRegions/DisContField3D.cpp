@@ -1922,13 +1922,14 @@ using namespace std;
         void DisContField3D::v_GetFwdBwdTracePhys(Array<OneD, NekDouble> &Fwd,
                                                   Array<OneD, NekDouble> &Bwd)
         {
-            v_GetFwdBwdTracePhys(m_phys, Fwd, Bwd);
+            v_GetFwdBwdTracePhys(m_phys, Fwd, Bwd, true);
         }
 
         void DisContField3D::v_GetFwdBwdTracePhys(
                                           const Array<OneD, const NekDouble> &field,
                   Array<OneD,       NekDouble> &Fwd,
-                  Array<OneD,       NekDouble> &Bwd)
+                  Array<OneD,       NekDouble> &Bwd,
+                  bool DoExchange)
         {
             int n, cnt, npts, e;
 
@@ -2009,8 +2010,11 @@ using namespace std;
             }
             
             // Do parallel exchange for forwards/backwards spaces.
-            m_traceMap->UniversalTraceAssemble(Fwd);
-            m_traceMap->UniversalTraceAssemble(Bwd);
+            if (DoExchange)
+            {
+                m_traceMap->UniversalTraceAssemble(Fwd);
+                m_traceMap->UniversalTraceAssemble(Bwd);
+            }
         }
 
          const vector<bool> &DisContField3D::v_GetLeftAdjacentFaces(void) const
@@ -2682,19 +2686,18 @@ using namespace std;
             int nbnd = m_bndCondExpansions.num_elements();
             MultiRegions::ExpListSharedPtr locExpList;
        
+            // Find out with a single reduction which files have changed
+            CheckFileBCs(m_bndConditions, time);
+
             for (i = 0; i < nbnd; ++i)
             {
                 if (time == 0.0 || m_bndConditions[i]->IsTimeDependent())
                 {
                     locExpList = m_bndCondExpansions[i];
                     npoints    = locExpList->GetNpoints();
-                    
-                    Array<OneD, NekDouble> x0(npoints, 0.0);
-                    Array<OneD, NekDouble> x1(npoints, 0.0);
-                    Array<OneD, NekDouble> x2(npoints, 0.0);
-                    Array<OneD, NekDouble> valuesFile(npoints, 1.0), valuesExp(npoints, 1.0);
-  
-                    locExpList->GetCoords(x0, x1, x2);
+
+                    const BndCondCache &coords =
+                        GetBndCondCoords(i, locExpList);
                     
                     if (m_bndConditions[i]->GetBoundaryConditionType()
                         == SpatialDomains::eDirichlet)
@@ -2707,21 +2710,35 @@ using namespace std;
 
                         if (filebcs != "")
                         {
-                            ExtractFileBCs(filebcs, bcPtr->GetComm(), varName, locExpList);
-                            valuesFile = locExpList->GetPhys();
+                            ExtractCachedFileBCs(i, filebcs, bcPtr->GetComm(),
+                                                 varName, locExpList);
+                        }
+                        else
+                        {
+                            Vmath::Fill(npoints, 1.0,
+                                        locExpList->UpdatePhys(), 1);
                         }
                         
+                        // The expression scales the values from the file.
                         if (exprbcs != "")
                         {
-                            LibUtilities::Equation  condition = std::static_pointer_cast<SpatialDomains::
-                                    DirichletBoundaryCondition >(
-                                    m_bndConditions[i])->m_dirichletCondition;
-                            
-                            condition.Evaluate(x0, x1, x2, time, valuesExp);
+                            Array<OneD, NekDouble> valuesExp =
+                                filebcs != "" ?
+                                Array<OneD, NekDouble>(npoints) :
+                                locExpList->UpdatePhys();
+
+                            bcPtr->m_dirichletCondition.Evaluate(
+                                coords.m_x0, coords.m_x1, coords.m_x2,
+                                time, valuesExp);
+
+                            if (filebcs != "")
+                            {
+                                Vmath::Vmul(npoints, valuesExp, 1,
+                                            locExpList->GetPhys(), 1,
+                                            locExpList->UpdatePhys(), 1);
+                            }
                         }
 
-                        Vmath::Vmul(npoints, valuesExp, 1, valuesFile, 1, locExpList->UpdatePhys(), 1);
-                        
                         locExpList->FwdTrans_BndConstrained(
                             locExpList->GetPhys(),
                             locExpList->UpdateCoeffs());
@@ -2736,18 +2753,14 @@ using namespace std;
 
                         if (filebcs != "")
                         {
-                            ExtractFileBCs(filebcs, bcPtr->GetComm(), varName, locExpList);
+                            ExtractCachedFileBCs(i, filebcs, bcPtr->GetComm(),
+                                                 varName, locExpList);
                         }
                         else
                         {
-                            
-                            LibUtilities::Equation condition = std::
-                                static_pointer_cast<SpatialDomains::
-                                                    NeumannBoundaryCondition>(
-                                    m_bndConditions[i])->m_neumannCondition;
-                        
-                            condition.Evaluate(x0, x1, x2, time, 
-                                               locExpList->UpdatePhys());
+                            bcPtr->m_neumannCondition.Evaluate(
+                                coords.m_x0, coords.m_x1, coords.m_x2, time,
+                                locExpList->UpdatePhys());
                             
                             locExpList->IProductWRTBase(locExpList->GetPhys(),
                                                         locExpList->UpdateCoeffs());
@@ -2763,18 +2776,14 @@ using namespace std;
 
                         if (filebcs != "")
                         {
-                            ExtractFileBCs(filebcs, bcPtr->GetComm(), varName, locExpList);
+                            ExtractCachedFileBCs(i, filebcs, bcPtr->GetComm(),
+                                                 varName, locExpList);
                         }
                         else
                         {
-                            LibUtilities::Equation condition = std::
-                                static_pointer_cast<SpatialDomains::
-                                                    RobinBoundaryCondition>(
-                                    m_bndConditions[i])->m_robinFunction;
-
-                            condition.Evaluate(x0, x1, x2, time, 
-                                               locExpList->UpdatePhys());
-
+                            bcPtr->m_robinFunction.Evaluate(
+                                coords.m_x0, coords.m_x1, coords.m_x2, time,
+                                locExpList->UpdatePhys());
                         }
 
                         locExpList->IProductWRTBase(locExpList->GetPhys(),
@@ -170,7 +170,8 @@ namespace Nektar
             virtual void v_GetFwdBwdTracePhys(
                 const Array<OneD,const NekDouble> &field,
                       Array<OneD,      NekDouble> &Fwd,
-                      Array<OneD,      NekDouble> &Bwd);
+                      Array<OneD,      NekDouble> &Bwd,
+                bool DoExchange);
             virtual const std::vector<bool> &v_GetLeftAdjacentFaces(void) const;
             virtual void v_ExtractTracePhys(
                       Array<OneD,       NekDouble> &outarray);
@@ -35,6 +35,8 @@
 #include <boost/core/ignore_unused.hpp>
 
 #include <MultiRegions/ExpList.h>
+#include <LibUtilities/BasicUtils/FileSystem.h>
+#include <LibUtilities/BasicUtils/Thread.h>
 #include <LibUtilities/Communication/Comm.h>
 #include <MultiRegions/GlobalLinSys.h>
 
@@ -63,6 +65,9 @@
 #include <Collections/CollectionOptimisation.h>
 #include <Collections/Operator.h>
 
+#include <algorithm>
+#include <cstdint>
+
 using namespace std;
 
 namespace Nektar
@@ -107,7 +112,8 @@ namespace Nektar
             m_coeff_offset(),
             m_phys_offset(),
             m_blockMat(MemoryManager<BlockMatrixMap>::AllocateSharedPtr()),
-            m_WaveSpace(false)
+            m_WaveSpace(false),
+            m_fileBCs(-1)
         {
             SetExpType(eNoType);
         }
@@ -133,7 +139,8 @@ namespace Nektar
             m_coeff_offset(),
             m_phys_offset(),
             m_blockMat(MemoryManager<BlockMatrixMap>::AllocateSharedPtr()),
-            m_WaveSpace(false)
+            m_WaveSpace(false),
+            m_fileBCs(-1)
         {
             SetExpType(eNoType);
         }
@@ -160,7 +167,8 @@ namespace Nektar
             m_coeff_offset(),
             m_phys_offset(),
             m_blockMat(MemoryManager<BlockMatrixMap>::AllocateSharedPtr()),
-            m_WaveSpace(false)
+            m_WaveSpace(false),
+            m_fileBCs(-1)
         {
             SetExpType(eNoType);
         }
@@ -186,7 +194,8 @@ namespace Nektar
             m_coeff_offset(),
             m_phys_offset(),
             m_blockMat(MemoryManager<BlockMatrixMap>::AllocateSharedPtr()),
-            m_WaveSpace(false)
+            m_WaveSpace(false),
+            m_fileBCs(-1)
         {
             SetExpType(eNoType);
 
@@ -225,7 +234,8 @@ namespace Nektar
             m_phys_offset(in.m_phys_offset),
             m_globalOptParam(in.m_globalOptParam),
             m_blockMat(in.m_blockMat),
-            m_WaveSpace(false)
+            m_WaveSpace(false),
+            m_fileBCs(-1)
         {
             SetExpType(eNoType);
 
@@ -1029,6 +1039,36 @@ namespace Nektar
             Array<OneD,NekDouble> tmp_outarray;
             int cnt = 0;
             int eid;
+
+            // Constant coefficient Helmholtz operators are evaluated through
+            // the collections, which provide matrix-free implementations.
+            // Other constant factors (e.g. SVV) are only supported by the
+            // elemental operators.
+            const StdRegions::ConstFactorMap &factors = gkey.GetConstFactors();
+            bool useColl = gkey.GetMatrixType() == StdRegions::eHelmholtz &&
+                           gkey.GetNVarCoeffs() == 0 &&
+                           m_collections.size() > 0 &&
+                           factors.size() == 1 &&
+                           factors.count(StdRegions::eFactorLambda) == 1;
+
+            for (int n = 0; n < doBlockMatOp.num_elements(); ++n)
+            {
+                useColl = useColl && !doBlockMatOp[n];
+            }
+
+            if (useColl)
+            {
+                for (int i = 0; i < m_collections.size(); ++i)
+                {
+                    m_collections[i].UpdateFactors(Collections::eHelmholtz,
+                                                   factors);
+                    m_collections[i].ApplyOperator(
+                        Collections::eHelmholtz,
+                        inarray + m_coll_coeff_offset[i],
+                        tmp_outarray = outarray + m_coll_coeff_offset[i]);
+                }
+                return;
+            }
             for(int n = 0; n < num_elmts.num_elements(); ++n)
             {
                 if(doBlockMatOp[n])
@@ -1491,12 +1531,21 @@ namespace Nektar
             // Check each element in turn to see if point lies within it.
             for (int i = 0; i < elmts.size(); ++i)
             {
-                if ((*m_exp)[m_elmtToExpId[elmts[i]]]->
+                // Skip elements of the mesh which are not part of this
+                // expansion list. The map is not modified here, so that
+                // points may be located concurrently by GetExpIndices.
+                auto it = m_elmtToExpId.find(elmts[i]);
+                if (it == m_elmtToExpId.end())
+                {
+                    continue;
+                }
+
+                if ((*m_exp)[it->second]->
                             GetGeom()->ContainsPoint(gloCoords,
                                                      locCoords,
                                                      tol, nearpt))
                 {
-                    return m_elmtToExpId[elmts[i]];
+                    return it->second;
                 }
                 else
                 {
@@ -1504,7 +1553,7 @@ namespace Nektar
                     // is nearest.
                     if(nearpt < nearpt_min)
                     {
-                        min_id     = m_elmtToExpId[elmts[i]];
+                        min_id     = it->second;
                         nearpt_min = nearpt;
                         Vmath::Vcopy(locCoords.num_elements(),locCoords,    1,
                                                               savLocCoords, 1);
@@ -1538,6 +1587,267 @@ namespace Nektar
             }
         }
 
+        /// Minimum number of points located by each job when
+        /// GetExpIndices is threaded.
+        static const int kMinPointsPerLocateJob = 256;
+
+        /**
+         * @brief Interleaves the lowest 21 bits of @p v with two zero bits
+         * between each, to form one component of a Morton key.
+         */
+        static inline uint64_t MortonSpread(uint64_t v)
+        {
+            v &= 0x1fffff;
+            v = (v | v << 32) & 0x1f00000000ffff;
+            v = (v | v << 16) & 0x1f0000ff0000ff;
+            v = (v | v << 8)  & 0x100f00f00f00f00f;
+            v = (v | v << 4)  & 0x10c30c30c30c30c3;
+            v = (v | v << 2)  & 0x1249249249249249;
+            return v;
+        }
+
+        /// Distance, in local coordinates, by which a point must lie inside
+        /// the previously found element to be located in it without a search.
+        static const NekDouble kLocateInteriorMargin = 1e-3;
+
+        /**
+         * @brief Locates the points @p order[start] to @p order[end-1].
+         *
+         * Consecutive points of a spatially sorted list usually lie in the
+         * same element, so the element found for the previous point is tested
+         * first. Points on or near its boundary may also lie in a neighbouring
+         * element, and GetExpIndex returns whichever of these comes first in
+         * the bounding box tree. The previous element is therefore only used
+         * when the point lies inside it by a margin much larger than @p tol,
+         * so that no other element can contain it. Otherwise the point is
+         * located by GetExpIndex.
+         */
+        static void LocatePointRange(
+            ExpList                                          &expList,
+            const std::vector<int>                           &order,
+            int                                               start,
+            int                                               end,
+            const Array<OneD, const Array<OneD, NekDouble> > &gloCoords,
+            NekDouble                                         tol,
+            bool                                              returnNearestElmt,
+            Array<OneD, int>                                 &elmtIds,
+            Array<OneD, Array<OneD, NekDouble> >             &locCoords)
+        {
+            int dim  = gloCoords.num_elements();
+            int prev = -1;
+            Array<OneD, NekDouble> coords(dim);
+            NekDouble margin = std::max(kLocateInteriorMargin, 1e3 * tol);
+
+            for (int n = start; n < end; ++n)
+            {
+                int i = order[n];
+                for (int j = 0; j < dim; ++j)
+                {
+                    coords[j] = gloCoords[j][i];
+                }
+
+                if (prev >= 0 && expList.GetExp(prev)->GetGeom()->
+                        ContainsPoint(coords, locCoords[i], -margin))
+                {
+                    elmtIds[i] = prev;
+                    continue;
+                }
+
+                elmtIds[i] = expList.GetExpIndex(coords, locCoords[i], tol,
+                                                 returnNearestElmt);
+                if (elmtIds[i] >= 0)
+                {
+                    prev = elmtIds[i];
+                }
+            }
+        }
+
+        /// Locates one range of spatially sorted points on a worker thread.
+        class LocatePointsJob : public Thread::ThreadJob
+        {
+            public:
+                LocatePointsJob(
+                    ExpList                                    &expList,
+                    const std::vector<int>                     &order,
+                    int start, int end,
+                    const Array<OneD, const Array<OneD, NekDouble> > &gloCoords,
+                    NekDouble tol, bool returnNearestElmt,
+                    Array<OneD, int>                           &elmtIds,
+                    Array<OneD, Array<OneD, NekDouble> >       &locCoords)
+                    : m_expList(expList), m_order(order), m_start(start),
+                      m_end(end), m_gloCoords(gloCoords), m_tol(tol),
+                      m_returnNearestElmt(returnNearestElmt),
+                      m_elmtIds(elmtIds), m_locCoords(locCoords)
+                {
+                }
+
+                virtual void Run()
+                {
+                    LocatePointRange(m_expList, m_order, m_start, m_end,
+                                     m_gloCoords, m_tol, m_returnNearestElmt,
+                                     m_elmtIds, m_locCoords);
+                }
+
+            private:
+                ExpList                                          &m_expList;
+                const std::vector<int>                           &m_order;
+                int                                               m_start;
+                int                                               m_end;
+                const Array<OneD, const Array<OneD, NekDouble> > &m_gloCoords;
+                NekDouble                                         m_tol;
+                bool                                  m_returnNearestElmt;
+                Array<OneD, int>                                 &m_elmtIds;
+                Array<OneD, Array<OneD, NekDouble> >             &m_locCoords;
+        };
+
+        /**
+         * Locates many points at once, giving the same element indices and
+         * local coordinates as calling GetExpIndex for each point in turn.
+         *
+         * @param gloCoords         Coordinates of the points, indexed as
+         *                          [dimension][point].
+         * @param elmtIds           On output, the index of the expansion
+         *                          containing each point, or -1 if the point
+         *                          was not found.
+         * @param locCoords         On output, the local coordinates of each
+         *                          point in its expansion.
+         * @param tol               Tolerance used to locate the points.
+         * @param returnNearestElmt Return the nearest element for points not
+         *                          lying in any element.
+         *
+         * The points are visited in the order of their Morton (Z-order) keys,
+         * so that consecutive points are close to each other and the element
+         * containing one point can be tested first for the next, unless the
+         * point is close to the boundary of that element. When the
+         * parameter \a PointLocatorNumThreads is larger than one, or the
+         * session thread manager has already been started, the sorted points
+         * are split into contiguous ranges which are located concurrently.
+         */
+        void ExpList::GetExpIndices(
+            const Array<OneD, const Array<OneD, NekDouble> > &gloCoords,
+            Array<OneD, int>                          &elmtIds,
+            Array<OneD, Array<OneD, NekDouble> >      &locCoords,
+            NekDouble tol,
+            bool returnNearestElmt)
+        {
+            int dim  = gloCoords.num_elements();
+            int npts = dim > 0 ? gloCoords[0].num_elements() : 0;
+
+            int nLocDim = GetNumElmts() > 0 ? GetShapeDimension() : 0;
+
+            elmtIds   = Array<OneD, int>(npts, -1);
+            locCoords = Array<OneD, Array<OneD, NekDouble> >(npts);
+            for (int i = 0; i < npts; ++i)
+            {
+                locCoords[i] = Array<OneD, NekDouble>(nLocDim, 0.0);
+            }
+
+            if (npts == 0 || nLocDim == 0)
+            {
+                return;
+            }
+
+            // Sort the points by their Morton key within the bounding box of
+            // all points.
+            Array<OneD, NekDouble> xmin(dim), scale(dim, 0.0);
+            for (int j = 0; j < dim; ++j)
+            {
+                xmin[j] = Vmath::Vmin(npts, gloCoords[j], 1);
+                NekDouble len = Vmath::Vmax(npts, gloCoords[j], 1) - xmin[j];
+                if (len > 0.0)
+                {
+                    scale[j] = 2097151.0 / len;
+                }
+            }
+
+            std::vector<uint64_t> keys(npts, 0);
+            for (int i = 0; i < npts; ++i)
+            {
+                for (int j = 0; j < dim && j < 3; ++j)
+                {
+                    uint64_t q = static_cast<uint64_t>(
+                        (gloCoords[j][i] - xmin[j]) * scale[j]);
+                    keys[i] |= MortonSpread(q) << j;
+                }
+            }
+
+            std::vector<int> order(npts);
+            for (int i = 0; i < npts; ++i)
+            {
+                order[i] = i;
+            }
+            std::sort(order.begin(), order.end(),
+                      [&keys](int a, int b) { return keys[a] < keys[b]; });
+
+            // Start the thread manager if requested.
+            if (m_session &&
+                m_session->DefinesParameter("PointLocatorNumThreads"))
+            {
+                int nThreads = 1;
+                m_session->LoadParameter("PointLocatorNumThreads", nThreads);
+                ASSERTL0(nThreads > 0,
+                         "PointLocatorNumThreads must be positive");
+
+                Thread::ThreadMaster &tms = Thread::GetThreadMaster();
+                if (nThreads > 1 &&
+                    !tms.GetInstance(Thread::ThreadMaster::SessionJob)
+                         ->IsInitialised())
+                {
+                    tms.SetThreadingType("ThreadManagerBoost");
+                    tms.CreateInstance(Thread::ThreadMaster::SessionJob,
+                                       nThreads);
+                }
+            }
+
+            Thread::ThreadManagerSharedPtr tm = Thread::GetThreadMaster()
+                .GetInstance(Thread::ThreadMaster::SessionJob);
+
+            int nJobs = 1;
+            if (tm->IsInitialised() && !tm->InThread())
+            {
+                nJobs = std::min(4 * (int)tm->GetNumWorkers(),
+                                 npts / kMinPointsPerLocateJob);
+            }
+
+            if (nJobs < 2)
+            {
+                LocatePointRange(*this, order, 0, npts, gloCoords, tol,
+                                 returnNearestElmt, elmtIds, locCoords);
+                return;
+            }
+
+            // Locate the first point on this thread, which builds the
+            // element map and the bounding box tree of the mesh. The
+            // geometric data which the elements fill on first use are not
+            // thread safe either, so fill them here.
+            LocatePointRange(*this, order, 0, 1, gloCoords, tol,
+                             returnNearestElmt, elmtIds, locCoords);
+
+            for (auto &exp : *m_exp)
+            {
+                SpatialDomains::GeometrySharedPtr geom = exp->GetGeom();
+                geom->FillGeom();
+                if (geom->GetShapeDim() > 1)
+                {
+                    geom->GetMetricInfo()->GetJac(
+                        geom->GetXmap()->GetPointsKeys());
+                }
+            }
+
+            std::vector<Thread::ThreadJob*> jobs(nJobs);
+            for (int p = 0, start = 1; p < nJobs; ++p)
+            {
+                int len = (npts - 1) / nJobs + (p < (npts - 1) % nJobs);
+                jobs[p] = new LocatePointsJob(
+                    *this, order, start, start + len, gloCoords, tol,
+                    returnNearestElmt, elmtIds, locCoords);
+                start += len;
+            }
+
+            tm->QueueJobs(jobs);
+            tm->Wait();
+        }
+
         /**
          * Given some coordinates, output the expansion field value at that
          * point
@@ -1600,6 +1910,10 @@ namespace Nektar
             {
                 (*m_exp)[i]->Reset();
             }
+
+            // Boundary coordinates and projected file data are no longer
+            // valid once the mesh has moved.
+            m_bndCondCache.clear();
         }
 
         /**
@@ -1882,22 +2196,65 @@ namespace Nektar
         void ExpList::v_WriteVtkPieceData(std::ostream &outfile, int expansion,
                                         std::string var)
         {
-            int i;
-            int nq = (*m_exp)[expansion]->GetTotPoints();
+            Array<OneD, NekDouble> data;
+            GetVtkPieceData(expansion, data);
 
             // printing the fields of that zone
             outfile << "        <DataArray type=\"Float64\" Name=\""
                     << var << "\">" << endl;
             outfile << "          ";
-            const Array<OneD, NekDouble> phys = m_phys + m_phys_offset[expansion];
-            for(i = 0; i < nq; ++i)
+            for (int i = 0; i < data.num_elements(); ++i)
             {
-                outfile << (fabs(phys[i]) < NekConstants::kNekZeroTol ? 0 : phys[i]) << " ";
+                outfile << data[i] << " ";
             }
             outfile << endl;
             outfile << "        </DataArray>" << endl;
         }
 
+        /**
+         * The points of an element form a tensor-product grid in its
+         * standard region, with the number of quadrature points in each
+         * direction given in \a npts.
+         */
+        void ExpList::v_GetVtkPieceGeometry(
+            int expansion,
+            int istrip,
+            Array<OneD, Array<OneD, NekDouble> > &coords,
+            Array<OneD, int> &npts)
+        {
+            boost::ignore_unused(istrip);
+
+            int dim = (*m_exp)[expansion]->GetShapeDimension();
+            npts = Array<OneD, int>(3, 1);
+            for (int i = 0; i < dim; ++i)
+            {
+                npts[i] = (*m_exp)[expansion]->GetNumPoints(i);
+            }
+
+            int ntot = npts[0]*npts[1]*npts[2];
+            coords = Array<OneD, Array<OneD, NekDouble> >(3);
+            for (int i = 0; i < 3; ++i)
+            {
+                coords[i] = Array<OneD, NekDouble>(ntot, 0.0);
+            }
+            (*m_exp)[expansion]->GetCoords(coords[0], coords[1], coords[2]);
+        }
+
+        void ExpList::v_GetVtkPieceData(
+            int expansion,
+            Array<OneD, NekDouble> &data)
+        {
+            int nq = (*m_exp)[expansion]->GetTotPoints();
+            data = Array<OneD, NekDouble>(nq);
+
+            const Array<OneD, NekDouble> phys = m_phys + m_phys_offset[expansion];
+            for (int i = 0; i < nq; ++i)
+            {
+                data[i] = fabs(phys[i]) < NekConstants::kNekZeroTol ?
+                    0.0 : phys[i];
+            }
+        }
+
         /**
          * Given a spectral/hp approximation
          * \f$u^{\delta}(\boldsymbol{x})\f$ evaluated at the quadrature points
@@ -2135,6 +2492,208 @@ namespace Nektar
                 locExpList->UpdatePhys());
         }
 
+        /**
+         * Return the coordinates of the quadrature points of boundary region
+         * @p region, whose expansion is @p locExpList. They are computed on
+         * the first call and kept until the mesh is reset. If @p x2_in is
+         * set, it replaces the x2 coordinate of all points.
+         */
+        const BndCondCache &ExpList::GetBndCondCoords(
+            const int                        region,
+            const std::shared_ptr<ExpList>  &locExpList,
+            const NekDouble                  x2_in)
+        {
+            BndCondCache &cache = m_bndCondCache[region];
+            int npoints = locExpList->GetNpoints();
+
+            if (cache.m_x0.num_elements() != npoints ||
+                (cache.m_x2In != x2_in &&
+                 x2_in == NekConstants::kNekUnsetDouble))
+            {
+                cache.m_x0   = Array<OneD, NekDouble>(npoints, 0.0);
+                cache.m_x1   = Array<OneD, NekDouble>(npoints, 0.0);
+                cache.m_x2   = Array<OneD, NekDouble>(npoints, 0.0);
+                cache.m_x2In = NekConstants::kNekUnsetDouble;
+                locExpList->GetCoords(cache.m_x0, cache.m_x1, cache.m_x2);
+            }
+
+            if (cache.m_x2In != x2_in)
+            {
+                Vmath::Fill(npoints, x2_in, cache.m_x2, 1);
+                cache.m_x2In = x2_in;
+            }
+
+            return cache;
+        }
+
+        /**
+         * Return the file of a boundary condition, or an empty string if its
+         * values are not read from file.
+         */
+        static std::string GetBndCondFile(
+            const SpatialDomains::BoundaryConditionShPtr &bndCond)
+        {
+            switch (bndCond->GetBoundaryConditionType())
+            {
+                case SpatialDomains::eDirichlet:
+                    return std::static_pointer_cast<
+                        SpatialDomains::DirichletBoundaryCondition>(
+                            bndCond)->m_filename;
+                case SpatialDomains::eNeumann:
+                    return std::static_pointer_cast<
+                        SpatialDomains::NeumannBoundaryCondition>(
+                            bndCond)->m_filename;
+                case SpatialDomains::eRobin:
+                    return std::static_pointer_cast<
+                        SpatialDomains::RobinBoundaryCondition>(
+                            bndCond)->m_filename;
+                default:
+                    return "";
+            }
+        }
+
+        /**
+         * Return the modification time of the boundary condition file
+         * @p fileName, or zero if it cannot be read. A parallel field file is
+         * a directory, whose own time does not change when the files in it
+         * are rewritten, so the latest time of its files is used instead.
+         * Times have a resolution of one second.
+         */
+        static std::time_t GetBndCondFileTime(const std::string &fileName)
+        {
+            boost::system::error_code ec;
+            std::time_t fileTime = fs::last_write_time(fileName, ec);
+            if (ec)
+            {
+                return 0;
+            }
+
+            if (fs::is_directory(fileName, ec))
+            {
+                fs::directory_iterator it(fileName, ec), end;
+                for (; !ec && it != end; it.increment(ec))
+                {
+                    boost::system::error_code fileEc;
+                    std::time_t t = fs::last_write_time(it->path(), fileEc);
+                    if (!fileEc)
+                    {
+                        fileTime = std::max(fileTime, t);
+                    }
+                }
+            }
+
+            return fileTime;
+        }
+
+        /**
+         * Determine which of the file boundary conditions in
+         * @p bndConditions evaluated at @p time must be read again by
+         * ExtractCachedFileBCs. This must be called by all processes of the
+         * communicator of the expansion before each evaluation. The files of
+         * all regions are checked with a single reduction, which is skipped
+         * when no process has file boundary conditions to evaluate at this
+         * time. If a file has changed on any process, all files evaluated at
+         * this time are read again.
+         */
+        void ExpList::CheckFileBCs(
+            const Array<OneD, const SpatialDomains::BoundaryConditionShPtr>
+                            &bndConditions,
+            const NekDouble  time)
+        {
+            int nbnd = bndConditions.num_elements();
+
+            if (m_fileBCs < 0)
+            {
+                m_fileBCs = 0;
+                for (int i = 0; i < nbnd; ++i)
+                {
+                    if (GetBndCondFile(bndConditions[i]) != "")
+                    {
+                        m_fileBCs = std::max(m_fileBCs,
+                            bndConditions[i]->IsTimeDependent() ? 2 : 1);
+                    }
+                }
+                m_comm->AllReduce(m_fileBCs, LibUtilities::ReduceMax);
+            }
+
+            if (m_fileBCs == 0 || (m_fileBCs == 1 && time != 0.0))
+            {
+                return;
+            }
+
+            int reload = 0;
+            std::map<int, std::time_t> fileTimes;
+            for (int i = 0; i < nbnd; ++i)
+            {
+                std::string fileName = GetBndCondFile(bndConditions[i]);
+                if (fileName == "" ||
+                    !(time == 0.0 || bndConditions[i]->IsTimeDependent()))
+                {
+                    continue;
+                }
+
+                BndCondCache &cache = m_bndCondCache[i];
+                fileTimes[i] = GetBndCondFileTime(fileName);
+                if (!cache.m_fileLoaded || fileTimes[i] != cache.m_fileTime)
+                {
+                    reload = 1;
+                }
+            }
+
+            m_comm->AllReduce(reload, LibUtilities::ReduceMax);
+
+            for (auto &it : fileTimes)
+            {
+                BndCondCache &cache = m_bndCondCache[it.first];
+                cache.m_fileReload  = reload;
+                if (reload)
+                {
+                    cache.m_fileTime = it.second;
+                }
+            }
+        }
+
+        /**
+         * Set the coefficients and physical values of @p locExpList, the
+         * expansion of boundary region @p region, from the file @p fileName
+         * as ExtractFileBCs does. The file is only read and projected again
+         * if CheckFileBCs has found that it was modified since it was last
+         * read; otherwise the values are copied from the cache.
+         */
+        void ExpList::ExtractCachedFileBCs(
+            const int                        region,
+            const std::string               &fileName,
+            LibUtilities::CommSharedPtr      comm,
+            const std::string               &varName,
+            const std::shared_ptr<ExpList>  &locExpList)
+        {
+            BndCondCache &cache = m_bndCondCache[region];
+
+            int ncoeffs = locExpList->GetNcoeffs();
+            int npoints = locExpList->GetNpoints();
+
+            if (cache.m_fileReload || !cache.m_fileLoaded)
+            {
+                ExtractFileBCs(fileName, comm, varName, locExpList);
+
+                cache.m_fileCoeffs = Array<OneD, NekDouble>(ncoeffs);
+                cache.m_filePhys   = Array<OneD, NekDouble>(npoints);
+                Vmath::Vcopy(ncoeffs, locExpList->GetCoeffs(), 1,
+                             cache.m_fileCoeffs, 1);
+                Vmath::Vcopy(npoints, locExpList->GetPhys(), 1,
+                             cache.m_filePhys, 1);
+                cache.m_fileLoaded = true;
+                cache.m_fileReload = false;
+            }
+            else
+            {
+                Vmath::Vcopy(ncoeffs, cache.m_fileCoeffs, 1,
+                             locExpList->UpdateCoeffs(), 1);
+                Vmath::Vcopy(npoints, cache.m_filePhys, 1,
+                             locExpList->UpdatePhys(), 1);
+            }
+        }
+
         /**
          * Given a spectral/hp approximation
          * \f$u^{\delta}(\boldsymbol{x})\f$ evaluated at the quadrature points
@@ -2647,9 +3206,10 @@ namespace Nektar
         void ExpList::v_GetFwdBwdTracePhys(
                                 const Array<OneD,const NekDouble>  &field,
                                       Array<OneD,NekDouble> &Fwd,
-                                      Array<OneD,NekDouble> &Bwd)
+                                      Array<OneD,NekDouble> &Bwd,
+                                bool DoExchange)
         {
-            boost::ignore_unused(field, Fwd, Bwd);
+            boost::ignore_unused(field, Fwd, Bwd, DoExchange);
             NEKERROR(ErrorUtil::efatal,
                      "This method is not defined or valid for this class type");
         }
@@ -3308,6 +3868,7 @@ namespace Nektar
             int  collmax    = (colOpt.GetMaxCollectionSize() > 0
                                         ? colOpt.GetMaxCollectionSize()
                                         : 2*m_exp->size());
+            int  nThreads   = colOpt.GetNumThreads();
 
             // clear vectors in case previously called
             m_collections.clear();
@@ -3321,111 +3882,79 @@ namespace Nektar
                     std::pair<LocalRegions::ExpansionSharedPtr,int> ((*m_exp)[i],i));
             }
 
+            // Split the elements of each type into collections of contiguous
+            // elements of the same order.
+            vector<vector<StdRegions::StdExpansionSharedPtr> > collExps;
+            vector<Collections::OperatorImpMap> impTypes;
+
             for (auto &it : collections)
             {
                 LocalRegions::ExpansionSharedPtr exp = it.second[0].first;
 
-                Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(exp);
+                Collections::OperatorImpMap impType = colOpt.GetOperatorImpMap(exp);
                 vector<StdRegions::StdExpansionSharedPtr> collExp;
 
                 int prevCoeffOffset     = m_coeff_offset[it.second[0].second];
                 int prevPhysOffset      = m_phys_offset [it.second[0].second];
-                int collcnt;
+                int prevnCoeff          = exp->GetNcoeffs();
+                int prevnPhys           = exp->GetTotPoints();
+                int collcnt             = 1;
 
                 m_coll_coeff_offset.push_back(prevCoeffOffset);
                 m_coll_phys_offset .push_back(prevPhysOffset);
-
-                if(it.second.size() == 1) // single element case
-                {
-                    collExp.push_back(it.second[0].first);
-
-                    // if no Imp Type provided and No settign in xml file.
-                    // reset impTypes using timings
-                    if(autotuning)
+                collExp.push_back(exp);
+
+                for (int i = 1; i < it.second.size(); ++i)
+                {
+                    int nCoeffs     = it.second[i].first->GetNcoeffs();
+                    int nPhys       = it.second[i].first->GetTotPoints();
+                    int coeffOffset = m_coeff_offset[it.second[i].second];
+                    int physOffset  = m_phys_offset [it.second[i].second];
+
+                    // check to see if next elmt is different or
+                    // collmax reached and if so end collection
+                    // and start new one
+                    if(prevCoeffOffset + nCoeffs != coeffOffset ||
+                       prevnCoeff != nCoeffs ||
+                       prevPhysOffset + nPhys != physOffset ||
+                       prevnPhys != nPhys || collcnt >= collmax)
                     {
-                        impTypes = colOpt.SetWithTimings(collExp,
-                                                         impTypes, verbose);
-                    }
+                        collExps.push_back(collExp);
+                        impTypes.push_back(impType);
 
-                    Collections::Collection tmp(collExp, impTypes);
-                    m_collections.push_back(tmp);
-                }
-                else
-                {
-                    // set up first geometry
-                    collExp.push_back(it.second[0].first);
-                    int prevnCoeff = it.second[0].first->GetNcoeffs();
-                    int prevnPhys  = it.second[0].first->GetTotPoints();
-                    collcnt = 1;
-
-                    for (int i = 1; i < it.second.size(); ++i)
-                    {
-                        int nCoeffs     = it.second[i].first->GetNcoeffs();
-                        int nPhys       = it.second[i].first->GetTotPoints();
-                        int coeffOffset = m_coeff_offset[it.second[i].second];
-                        int physOffset  = m_phys_offset [it.second[i].second];
-
-                        // check to see if next elmt is different or
-                        // collmax reached and if so end collection
-                        // and start new one
-                        if(prevCoeffOffset + nCoeffs != coeffOffset ||
-                           prevnCoeff != nCoeffs ||
-                           prevPhysOffset + nPhys != physOffset ||
-                           prevnPhys != nPhys || collcnt >= collmax)
-                        {
-
-                            // if no Imp Type provided and No
-                            // settign in xml file. reset
-                            // impTypes using timings
-                            if(autotuning)
-                            {
-                                impTypes = colOpt.SetWithTimings(collExp,
-                                                                 impTypes,
-                                                                 verbose);
-                            }
-
-                            Collections::Collection tmp(collExp, impTypes);
-                            m_collections.push_back(tmp);
+                        // start new geom list
+                        collExp.clear();
 
+                        m_coll_coeff_offset.push_back(coeffOffset);
+                        m_coll_phys_offset .push_back(physOffset);
+                        collcnt = 0;
+                    }
 
-                            // start new geom list
-                            collExp.clear();
+                    collExp.push_back(it.second[i].first);
+                    collcnt++;
 
-                            m_coll_coeff_offset.push_back(coeffOffset);
-                            m_coll_phys_offset .push_back(physOffset);
-                            collExp.push_back(it.second[i].first);
-                            collcnt = 1;
-                        }
-                        else // add to list of collections
-                        {
-                            collExp.push_back(it.second[i].first);
-                            collcnt++;
-                        }
-
-                        // if end of list finish up collection
-                        if (i == it.second.size() - 1)
-                        {
-                            // if no Imp Type provided and No
-                            // settign in xml file.
-                            if(autotuning)
-                            {
-                                impTypes = colOpt.SetWithTimings(collExp,
-                                                                 impTypes,verbose);
-                            }
+                    prevCoeffOffset = coeffOffset;
+                    prevPhysOffset  = physOffset;
+                    prevnCoeff      = nCoeffs;
+                    prevnPhys       = nPhys;
+                }
 
-                            Collections::Collection tmp(collExp, impTypes);
-                            m_collections.push_back(tmp);
-                            collExp.clear();
-                            collcnt = 0;
+                collExps.push_back(collExp);
+                impTypes.push_back(impType);
+            }
 
-                        }
+            // if no Imp Type provided and No setting in xml file reset
+            // impTypes using timings. This is done collectively so that
+            // all processes make the same choices.
+            if(autotuning)
+            {
+                impTypes = colOpt.SetWithTimings(m_comm, collExps, verbose);
+            }
 
-                        prevCoeffOffset = coeffOffset;
-                        prevPhysOffset  = physOffset;
-                        prevnCoeff      = nCoeffs;
-                        prevnPhys       = nPhys;
-                    }
-                }
+            for (int i = 0; i < collExps.size(); ++i)
+            {
+                Collections::Collection tmp(collExps[i], impTypes[i], nThreads);
+                m_collections.push_back(tmp);
             }
         }
 
@@ -35,6 +35,8 @@
 #ifndef NEKTAR_LIBS_MULTIREGIONS_EXPLIST_H
 #define NEKTAR_LIBS_MULTIREGIONS_EXPLIST_H
 
+#include <ctime>
+
 #include <boost/core/ignore_unused.hpp>
 
 #include <LibUtilities/Communication/Transposition.h>
@@ -97,6 +99,32 @@ namespace Nektar
         typedef std::map<GlobalMatrixKey,DNekScalBlkMatSharedPtr> BlockMatrixMap;
         /// A shared pointer to a BlockMatrixMap.
         typedef std::shared_ptr<BlockMatrixMap> BlockMatrixMapShPtr;
+
+        /// Coordinates and file data of a boundary region, kept between
+        /// evaluations of its boundary condition.
+        struct BndCondCache
+        {
+            BndCondCache() :
+                m_x2In(NekConstants::kNekUnsetDouble),
+                m_fileLoaded(false),
+                m_fileReload(true),
+                m_fileTime(0)
+            {
+            }
+
+            /// Coordinates of the quadrature points of the region.
+            Array<OneD, NekDouble> m_x0, m_x1, m_x2;
+            /// Value which replaces the x2 coordinate, if any.
+            NekDouble              m_x2In;
+            /// Whether the file data below is valid.
+            bool                   m_fileLoaded;
+            /// Whether the file must be read at the next evaluation.
+            bool                   m_fileReload;
+            /// Modification time of the file when it was read.
+            std::time_t            m_fileTime;
+            /// Coefficients and physical values read from the file.
+            Array<OneD, NekDouble> m_fileCoeffs, m_filePhys;
+        };
                    
 
         /// Base class for all multi-elemental spectral/hp expansions.
@@ -441,6 +469,27 @@ namespace Nektar
                 v_WriteVtkPieceData(outfile, expansion, var);
             }
 
+            /// Get the coordinates of the VTK piece of element \a expansion,
+            /// which form a tensor-product grid of \a npts points in each
+            /// direction. Used by the binary VTK writers.
+            void GetVtkPieceGeometry(
+                int expansion,
+                int istrip,
+                Array<OneD, Array<OneD, NekDouble> > &coords,
+                Array<OneD, int> &npts)
+            {
+                v_GetVtkPieceGeometry(expansion, istrip, coords, npts);
+            }
+
+            /// Get the field values at the points of the VTK piece of
+            /// element \a expansion.
+            void GetVtkPieceData(
+                int expansion,
+                Array<OneD, NekDouble> &data)
+            {
+                v_GetVtkPieceData(expansion, data);
+            }
+
             /// This function returns the dimension of the coordinates of the
             /// element \a eid.
             // inline
@@ -688,7 +737,18 @@ namespace Nektar
                 Array<OneD, NekDouble>       &locCoords,
                 NekDouble tol = 0.0,
                 bool returnNearestElmt = false);
-            
+
+            /** This function returns the indices and the local
+             * coordinates of the local elemental expansions
+             * containing each of the points given by \a gloCoords.
+             **/
+            MULTI_REGIONS_EXPORT void GetExpIndices(
+                const Array<OneD, const Array<OneD, NekDouble> > &gloCoords,
+                Array<OneD, int>                          &elmtIds,
+                Array<OneD, Array<OneD, NekDouble> >      &locCoords,
+                NekDouble tol = 0.0,
+                bool returnNearestElmt = false);
+
             /** This function return the expansion field value
              * at the coordinates given as input.
              **/
@@ -799,7 +859,8 @@ namespace Nektar
             inline void GetFwdBwdTracePhys(
                 const Array<OneD,const NekDouble> &field,
                       Array<OneD,NekDouble> &Fwd,
-                      Array<OneD,NekDouble> &Bwd);
+                      Array<OneD,NekDouble> &Bwd,
+                bool DoExchange = true);
 
             inline const std::vector<bool> &GetLeftAdjacentFaces(void) const;
             
@@ -1115,6 +1176,14 @@ namespace Nektar
             /// Mapping from geometry ID of element to index inside #m_exp
             std::unordered_map<int, int> m_elmtToExpId;
 
+            /// Cached data of the boundary regions, indexed by region.
+            std::map<int, BndCondCache> m_bndCondCache;
+
+            /// Whether any process has file boundary conditions which are
+            /// time-dependent (2), only time-independent ones (1) or none
+            /// (0). Set to -1 until the first evaluation.
+            int m_fileBCs;
+
             /// This function assembles the block diagonal matrix of local
             /// matrices of the type \a mtype.
             const DNekScalBlkMatSharedPtr GenBlockMatrix(
@@ -1213,7 +1282,8 @@ namespace Nektar
             virtual void v_GetFwdBwdTracePhys(
                 const Array<OneD,const NekDouble>  &field,
                       Array<OneD,NekDouble> &Fwd,
-                      Array<OneD,NekDouble> &Bwd);
+                      Array<OneD,NekDouble> &Bwd,
+                bool DoExchange);
 
             virtual const std::vector<bool> &v_GetLeftAdjacentFaces(void) const;
 
@@ -1460,6 +1530,16 @@ namespace Nektar
                 int expansion,
                 std::string var);
 
+            virtual void v_GetVtkPieceGeometry(
+                int expansion,
+                int istrip,
+                Array<OneD, Array<OneD, NekDouble> > &coords,
+                Array<OneD, int> &npts);
+
+            virtual void v_GetVtkPieceData(
+                int expansion,
+                Array<OneD, NekDouble> &data);
+
             virtual NekDouble v_L2(
                 const Array<OneD, const NekDouble> &phys,
                 const Array<OneD, const NekDouble> &soln = NullNekDouble1DArray);
@@ -1492,6 +1572,24 @@ namespace Nektar
                                 LibUtilities::CommSharedPtr       comm,
                                 const std::string                &varName,
                                 const std::shared_ptr<ExpList>  locExpList);
+
+            const BndCondCache &GetBndCondCoords(
+                const int                        region,
+                const std::shared_ptr<ExpList>  &locExpList,
+                const NekDouble                  x2_in =
+                    NekConstants::kNekUnsetDouble);
+
+            void CheckFileBCs(
+                const Array<OneD, const SpatialDomains::BoundaryConditionShPtr>
+                                &bndConditions,
+                const NekDouble  time);
+
+            void ExtractCachedFileBCs(
+                const int                        region,
+                const std::string               &fileName,
+                LibUtilities::CommSharedPtr      comm,
+                const std::string               &varName,
+                const std::shared_ptr<ExpList>  &locExpList);
             
             // Utility function for a common case of retrieving a
             // BoundaryCondition from a boundary condition collection.
@@ -2315,12 +2413,19 @@ namespace Nektar
             v_GetFwdBwdTracePhys(Fwd,Bwd);
         }
 
+        /**
+         * If DoExchange is false, the values on partition boundaries are not
+         * assembled; the caller must then pass Fwd and Bwd to
+         * AssemblyMapDG::UniversalTraceAssembleBegin and
+         * AssemblyMapDG::UniversalTraceAssembleEnd of the trace map.
+         */
         inline void ExpList::GetFwdBwdTracePhys(
             const Array<OneD,const NekDouble>  &field,
                   Array<OneD,NekDouble> &Fwd,
-                  Array<OneD,NekDouble> &Bwd)
+                  Array<OneD,NekDouble> &Bwd,
+            bool DoExchange)
         {
-            v_GetFwdBwdTracePhys(field,Fwd,Bwd);
+            v_GetFwdBwdTracePhys(field,Fwd,Bwd,DoExchange);
         }
 
         inline const std::vector<bool> &ExpList::GetLeftAdjacentFaces(void) const
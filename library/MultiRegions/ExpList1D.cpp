@@ -1175,16 +1175,14 @@ namespace Nektar
         void ExpList1D::v_WriteVtkPieceHeader(std::ostream &outfile, int expansion, int)
         {
             int i,j;
-            int nquad0 = (*m_exp)[expansion]->GetNumPoints(0);
+            Array<OneD, Array<OneD, NekDouble> > coords;
+            Array<OneD, int> npts;
+            GetVtkPieceGeometry(expansion, 0, coords, npts);
+
+            int nquad0 = npts[0];
             int ntot = nquad0;
             int ntotminus = (nquad0-1);
 
-            Array<OneD,NekDouble> coords[3];
-            coords[0] = Array<OneD,NekDouble>(ntot, 0.0);
-            coords[1] = Array<OneD,NekDouble>(ntot, 0.0);
-            coords[2] = Array<OneD,NekDouble>(ntot, 0.0);
-            (*m_exp)[expansion]->GetCoords(coords[0],coords[1],coords[2]);
-
             outfile << "    <Piece NumberOfPoints=\""
                     << ntot << "\" NumberOfCells=\""
                     << ntotminus << "\">" << endl;
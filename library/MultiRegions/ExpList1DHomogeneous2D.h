@@ -108,6 +108,12 @@ namespace Nektar
 
             virtual void v_WriteVtkPieceHeader(std::ostream &outfile, int expansion, int istrip);
 
+            virtual void v_GetVtkPieceGeometry(
+                int expansion,
+                int istrip,
+                Array<OneD, Array<OneD, NekDouble> > &coords,
+                Array<OneD, int> &npts);
+
         private:
         };
 
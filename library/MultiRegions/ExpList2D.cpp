@@ -1147,20 +1147,16 @@ namespace Nektar
             int expansion,
             int istrip)
         {
-            boost::ignore_unused(istrip);
-
             int i,j;
-            int nquad0 = (*m_exp)[expansion]->GetNumPoints(0);
-            int nquad1 = (*m_exp)[expansion]->GetNumPoints(1);
+            Array<OneD, Array<OneD, NekDouble> > coords;
+            Array<OneD, int> npts;
+            GetVtkPieceGeometry(expansion, istrip, coords, npts);
+
+            int nquad0 = npts[0];
+            int nquad1 = npts[1];
             int ntot = nquad0*nquad1;
             int ntotminus = (nquad0-1)*(nquad1-1);
 
-            Array<OneD,NekDouble> coords[3];
-            coords[0] = Array<OneD,NekDouble>(ntot,0.0);
-            coords[1] = Array<OneD,NekDouble>(ntot,0.0);
-            coords[2] = Array<OneD,NekDouble>(ntot,0.0);
-            (*m_exp)[expansion]->GetCoords(coords[0],coords[1],coords[2]);
-
             outfile << "    <Piece NumberOfPoints=\""
                     << ntot << "\" NumberOfCells=\""
                     << ntotminus << "\">" << endl;
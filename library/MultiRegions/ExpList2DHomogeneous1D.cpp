@@ -374,8 +374,6 @@ namespace Nektar
             int expansion,
             int istrip)
         {
-            boost::ignore_unused(istrip);
-
             // If there is only one plane (e.g. HalfMode), we write a 2D plane.
             if (m_planes.num_elements() == 1)
             {
@@ -383,40 +381,16 @@ namespace Nektar
                 return;
             }
 
-            // If we are using Fourier points, output extra plane to fill domain
-            int outputExtraPlane = 0;
-            if ( m_homogeneousBasis->GetBasisType()   == LibUtilities::eFourier
-               && m_homogeneousBasis->GetPointsType() ==
-                    LibUtilities::eFourierEvenlySpaced)
-            {
-                outputExtraPlane = 1;
-            }
             int i, j;
-            int nquad0 = (*m_exp)[expansion]->GetNumPoints(0);
-            int nquad1 = m_planes.num_elements() + outputExtraPlane;
+            Array<OneD, Array<OneD, NekDouble> > coords;
+            Array<OneD, int> npts;
+            GetVtkPieceGeometry(expansion, istrip, coords, npts);
+
+            int nquad0 = npts[0];
+            int nquad1 = npts[1];
             int ntot = nquad0*nquad1;
             int ntotminus = (nquad0-1)*(nquad1-1);
 
-            Array<OneD,NekDouble> coords[3];
-            coords[0] = Array<OneD,NekDouble>(ntot);
-            coords[1] = Array<OneD,NekDouble>(ntot);
-            coords[2] = Array<OneD,NekDouble>(ntot);
-            GetCoords(expansion,coords[0],coords[1],coords[2]);
-
-            if (outputExtraPlane)
-            {
-                // Copy coords[0] and coords[1] to extra plane
-                Array<OneD,NekDouble> tmp;
-                Vmath::Vcopy (nquad0, coords[0], 1,
-                                      tmp = coords[0] + (nquad1-1)*nquad0, 1);
-                Vmath::Vcopy (nquad0, coords[1], 1,
-                                      tmp = coords[1] + (nquad1-1)*nquad0, 1);
-                // Fill coords[2] for extra plane
-                NekDouble z = coords[2][nquad0*m_planes.num_elements()-1] +
-                              (coords[2][nquad0] - coords[2][0]);
-                Vmath::Fill(nquad0, z, tmp = coords[2] + (nquad1-1)*nquad0, 1);
-            }
-
             outfile << "    <Piece NumberOfPoints=\""
                     << ntot << "\" NumberOfCells=\""
                     << ntotminus << "\">" << endl;
@@ -470,6 +444,58 @@ namespace Nektar
             outfile << "      <PointData>" << endl;
         }
 
+        void ExpList2DHomogeneous1D::v_GetVtkPieceGeometry(
+            int                                   expansion,
+            int                                   istrip,
+            Array<OneD, Array<OneD, NekDouble> > &coords,
+            Array<OneD, int>                     &npts)
+        {
+            boost::ignore_unused(istrip);
+
+            // If there is only one plane (e.g. HalfMode), we write a 2D plane.
+            if (m_planes.num_elements() == 1)
+            {
+                m_planes[0]->GetVtkPieceGeometry(expansion, 0, coords, npts);
+                return;
+            }
+
+            // If we are using Fourier points, output extra plane to fill domain
+            int outputExtraPlane = 0;
+            if ( m_homogeneousBasis->GetBasisType()   == LibUtilities::eFourier
+               && m_homogeneousBasis->GetPointsType() ==
+                    LibUtilities::eFourierEvenlySpaced)
+            {
+                outputExtraPlane = 1;
+            }
+            int nquad0 = (*m_exp)[expansion]->GetNumPoints(0);
+            int nquad1 = m_planes.num_elements() + outputExtraPlane;
+            int ntot = nquad0*nquad1;
+
+            npts = Array<OneD, int>(3, 1);
+            npts[0] = nquad0;
+            npts[1] = nquad1;
+
+            coords = Array<OneD, Array<OneD, NekDouble> >(3);
+            coords[0] = Array<OneD,NekDouble>(ntot);
+            coords[1] = Array<OneD,NekDouble>(ntot);
+            coords[2] = Array<OneD,NekDouble>(ntot);
+            GetCoords(expansion,coords[0],coords[1],coords[2]);
+
+            if (outputExtraPlane)
+            {
+                // Copy coords[0] and coords[1] to extra plane
+                Array<OneD,NekDouble> tmp;
+                Vmath::Vcopy (nquad0, coords[0], 1,
+                                      tmp = coords[0] + (nquad1-1)*nquad0, 1);
+                Vmath::Vcopy (nquad0, coords[1], 1,
+                                      tmp = coords[1] + (nquad1-1)*nquad0, 1);
+                // Fill coords[2] for extra plane
+                NekDouble z = coords[2][nquad0*m_planes.num_elements()-1] +
+                              (coords[2][nquad0] - coords[2][0]);
+                Vmath::Fill(nquad0, z, tmp = coords[2] + (nquad1-1)*nquad0, 1);
+            }
+        }
+
         void ExpList2DHomogeneous1D::v_GetNormals(
             Array<OneD, Array<OneD, NekDouble> > &normals)
         {
@@ -127,6 +127,12 @@ namespace Nektar
                 int expansion,
                 int istrip);
 
+            virtual void v_GetVtkPieceGeometry(
+                int expansion,
+                int istrip,
+                Array<OneD, Array<OneD, NekDouble> > &coords,
+                Array<OneD, int> &npts);
+
             virtual void v_GetNormals(
                 Array<OneD, Array<OneD, NekDouble> > &normals);
             
@@ -374,50 +374,17 @@ namespace Nektar
                 return;
             }
 
-            // If we are using Fourier points, output extra plane to fill domain
-            int outputExtraPlane = 0;
-            if ( m_homogeneousBasis->GetBasisType()   == LibUtilities::eFourier
-               && m_homogeneousBasis->GetPointsType() ==
-                    LibUtilities::eFourierEvenlySpaced)
-            {
-                outputExtraPlane = 1;
-            }
-
             int i,j,k;
-            int nq0 = (*m_exp)[expansion]->GetNumPoints(0);
-            int nq1 = (*m_exp)[expansion]->GetNumPoints(1);
-            int nq2 = m_planes.num_elements() + outputExtraPlane;
+            Array<OneD, Array<OneD, NekDouble> > coords;
+            Array<OneD, int> npts;
+            GetVtkPieceGeometry(expansion, istrip, coords, npts);
+
+            int nq0 = npts[0];
+            int nq1 = npts[1];
+            int nq2 = npts[2];
             int ntot = nq0*nq1*nq2;
             int ntotminus = (nq0-1)*(nq1-1)*(nq2-1);
 
-            Array<OneD,NekDouble> coords[3];
-            coords[0] = Array<OneD,NekDouble>(ntot);
-            coords[1] = Array<OneD,NekDouble>(ntot);
-            coords[2] = Array<OneD,NekDouble>(ntot);
-            GetCoords(expansion,coords[0],coords[1],coords[2]);
-
-            if (outputExtraPlane)
-            {
-                // Copy coords[0] and coords[1] to extra plane
-                Array<OneD,NekDouble> tmp;
-                Vmath::Vcopy (nq0*nq1, coords[0], 1,
-                                      tmp = coords[0] + (nq2-1)*nq0*nq1, 1);
-                Vmath::Vcopy (nq0*nq1, coords[1], 1,
-                                      tmp = coords[1] + (nq2-1)*nq0*nq1, 1);
-                // Fill coords[2] for extra plane
-                NekDouble z = coords[2][nq0*nq1*m_planes.num_elements()-1] +
-                              (coords[2][nq0*nq1] - coords[2][0]);
-                Vmath::Fill(nq0*nq1, z, tmp = coords[2] + (nq2-1)*nq0*nq1, 1);
-            }
-
-            NekDouble DistStrip;
-            m_session->LoadParameter("DistStrip", DistStrip, 0);
-            // Reset the z-coords for homostrips
-            for(int i = 0; i < ntot; i++)
-            {
-                coords[2][i] += istrip*DistStrip;
-            }
-
             outfile << "    <Piece NumberOfPoints=\""
                     << ntot << "\" NumberOfCells=\""
                     << ntotminus << "\">" << endl;
@@ -478,6 +445,67 @@ namespace Nektar
             outfile << "      <PointData>" << endl;
         }
 
+        void ExpList3DHomogeneous1D::v_GetVtkPieceGeometry(
+            int                                   expansion,
+            int                                   istrip,
+            Array<OneD, Array<OneD, NekDouble> > &coords,
+            Array<OneD, int>                     &npts)
+        {
+            // If there is only one plane (e.g. HalfMode), we write a 2D plane.
+            if (m_planes.num_elements() == 1)
+            {
+                m_planes[0]->GetVtkPieceGeometry(expansion, 0, coords, npts);
+                return;
+            }
+
+            // If we are using Fourier points, output extra plane to fill domain
+            int outputExtraPlane = 0;
+            if ( m_homogeneousBasis->GetBasisType()   == LibUtilities::eFourier
+               && m_homogeneousBasis->GetPointsType() ==
+                    LibUtilities::eFourierEvenlySpaced)
+            {
+                outputExtraPlane = 1;
+            }
+
+            int nq0 = (*m_exp)[expansion]->GetNumPoints(0);
+            int nq1 = (*m_exp)[expansion]->GetNumPoints(1);
+            int nq2 = m_planes.num_elements() + outputExtraPlane;
+            int ntot = nq0*nq1*nq2;
+
+            npts = Array<OneD, int>(3);
+            npts[0] = nq0;
+            npts[1] = nq1;
+            npts[2] = nq2;
+
+            coords = Array<OneD, Array<OneD, NekDouble> >(3);
+            coords[0] = Array<OneD,NekDouble>(ntot);
+            coords[1] = Array<OneD,NekDouble>(ntot);
+            coords[2] = Array<OneD,NekDouble>(ntot);
+            GetCoords(expansion,coords[0],coords[1],coords[2]);
+
+            if (outputExtraPlane)
+            {
+                // Copy coords[0] and coords[1] to extra plane
+                Array<OneD,NekDouble> tmp;
+                Vmath::Vcopy (nq0*nq1, coords[0], 1,
+                                      tmp = coords[0] + (nq2-1)*nq0*nq1, 1);
+                Vmath::Vcopy (nq0*nq1, coords[1], 1,
+                                      tmp = coords[1] + (nq2-1)*nq0*nq1, 1);
+                // Fill coords[2] for extra plane
+                NekDouble z = coords[2][nq0*nq1*m_planes.num_elements()-1] +
+                              (coords[2][nq0*nq1] - coords[2][0]);
+                Vmath::Fill(nq0*nq1, z, tmp = coords[2] + (nq2-1)*nq0*nq1, 1);
+            }
+
+            NekDouble DistStrip;
+            m_session->LoadParameter("DistStrip", DistStrip, 0);
+            // Reset the z-coords for homostrips
+            for(int i = 0; i < ntot; i++)
+            {
+                coords[2][i] += istrip*DistStrip;
+            }
+        }
+
         NekDouble ExpList3DHomogeneous1D::v_L2(
             const Array<OneD, const NekDouble> &inarray,
             const Array<OneD, const NekDouble> &soln)
@@ -139,6 +139,12 @@ namespace Nektar
             virtual void v_WriteVtkPieceHeader(std::ostream &outfile,
                                                int expansion, int istrip);
 
+            virtual void v_GetVtkPieceGeometry(
+                int expansion,
+                int istrip,
+                Array<OneD, Array<OneD, NekDouble> > &coords,
+                Array<OneD, int> &npts);
+
             virtual NekDouble v_L2(
                 const Array<OneD, const NekDouble> &inarray,
                 const Array<OneD, const NekDouble> &soln = NullNekDouble1DArray);
@@ -357,21 +357,19 @@ namespace Nektar
         }
 
 
-        void ExpList3DHomogeneous2D::v_WriteVtkPieceHeader(std::ostream &outfile, int expansion, int)
+        void ExpList3DHomogeneous2D::v_WriteVtkPieceHeader(std::ostream &outfile, int expansion, int istrip)
         {
             int i,j,k;
-            int nquad0 = (*m_exp)[expansion]->GetNumPoints(0);
-            int nquad1 = m_homogeneousBasis_y->GetNumPoints();
-            int nquad2 = m_homogeneousBasis_z->GetNumPoints();
+            Array<OneD, Array<OneD, NekDouble> > coords;
+            Array<OneD, int> npts;
+            GetVtkPieceGeometry(expansion, istrip, coords, npts);
+
+            int nquad0 = npts[0];
+            int nquad1 = npts[1];
+            int nquad2 = npts[2];
             int ntot = nquad0*nquad1*nquad2;
             int ntotminus = (nquad0-1)*(nquad1-1)*(nquad2-1);
 
-            Array<OneD,NekDouble> coords[3];
-            coords[0] = Array<OneD,NekDouble>(ntot);
-            coords[1] = Array<OneD,NekDouble>(ntot);
-            coords[2] = Array<OneD,NekDouble>(ntot);
-            GetCoords(expansion,coords[0],coords[1],coords[2]);
-
             outfile << "    <Piece NumberOfPoints=\""
                     << ntot << "\" NumberOfCells=\""
                     << ntotminus << "\">" << endl;
@@ -432,6 +430,28 @@ namespace Nektar
             outfile << "      <PointData>" << endl;
         }
 
+        void ExpList3DHomogeneous2D::v_GetVtkPieceGeometry(
+            int                                   expansion,
+            int                                   istrip,
+            Array<OneD, Array<OneD, NekDouble> > &coords,
+            Array<OneD, int>                     &npts)
+        {
+            boost::ignore_unused(istrip);
+
+            npts = Array<OneD, int>(3);
+            npts[0] = (*m_exp)[expansion]->GetNumPoints(0);
+            npts[1] = m_homogeneousBasis_y->GetNumPoints();
+            npts[2] = m_homogeneousBasis_z->GetNumPoints();
+
+            int ntot = npts[0]*npts[1]*npts[2];
+
+            coords = Array<OneD, Array<OneD, NekDouble> >(3);
+            coords[0] = Array<OneD,NekDouble>(ntot);
+            coords[1] = Array<OneD,NekDouble>(ntot);
+            coords[2] = Array<OneD,NekDouble>(ntot);
+            GetCoords(expansion,coords[0],coords[1],coords[2]);
+        }
+
 
         NekDouble ExpList3DHomogeneous2D::v_L2(
             const Array<OneD, const NekDouble> &inarray,
@@ -50,7 +50,8 @@ namespace Nektar
             ExpList(),
             m_homogeneousBasis(LibUtilities::NullBasisSharedPtr),
             m_lhom(1),
-            m_homogeneous1DBlockMat(MemoryManager<Homo1DBlockMatrixMap>::AllocateSharedPtr())
+            m_homogeneous1DBlockMat(MemoryManager<Homo1DBlockMatrixMap>::AllocateSharedPtr()),
+            m_transChunks(1)
         {
         }
 
@@ -100,6 +101,7 @@ namespace Nektar
 
             if(m_useFFT)
             {
+                LibUtilities::NektarFFT::LoadPlanOptions(m_session);
                 m_FFT = LibUtilities::GetNektarFFTFactory().CreateInstance(
                                 "NekFFTW", m_homogeneousBasis->GetNumPoints());
             }
@@ -120,6 +122,9 @@ namespace Nektar
                                     "with FFTW");
                 }
             }
+
+            m_session->LoadParameter("HomoTransChunks", m_transChunks, 4);
+            ASSERTL0(m_transChunks > 0, "HomoTransChunks must be positive.");
         }
 
 
@@ -138,7 +143,8 @@ namespace Nektar
             m_lhom(In.m_lhom), 
             m_homogeneous1DBlockMat(In.m_homogeneous1DBlockMat),
             m_dealiasing(In.m_dealiasing),
-            m_padsize(In.m_padsize)
+            m_padsize(In.m_padsize),
+            m_transChunks(In.m_transChunks)
         {
             m_planes = Array<OneD, ExpListSharedPtr>(In.m_planes.num_elements());
         }
@@ -155,7 +161,8 @@ namespace Nektar
             m_lhom(In.m_lhom), 
             m_homogeneous1DBlockMat(MemoryManager<Homo1DBlockMatrixMap>::AllocateSharedPtr()),
             m_dealiasing(In.m_dealiasing),
-            m_padsize(In.m_padsize)
+            m_padsize(In.m_padsize),
+            m_transChunks(In.m_transChunks)
         {
             m_planes = Array<OneD, ExpListSharedPtr>(In.m_planes.num_elements());
         }
@@ -242,8 +249,13 @@ namespace Nektar
             Array<OneD, NekDouble> ShufV1V2_PAD_coef(m_padsize,0.0);
             Array<OneD, NekDouble> ShufV1V2_PAD_phys(m_padsize,0.0);
 
-            m_transposition->Transpose(V1, ShufV1, false, LibUtilities::eXYtoZ);
-            m_transposition->Transpose(V2, ShufV2, false, LibUtilities::eXYtoZ);
+            // Transpose both inputs in a single exchange.
+            Array<OneD, Array<OneD, NekDouble> > V(2), ShufV(2);
+            V[0]     = V1;
+            V[1]     = V2;
+            ShufV[0] = ShufV1;
+            ShufV[1] = ShufV2;
+            m_transposition->Transpose(V, ShufV, false, LibUtilities::eXYtoZ);
 
             // Looping on the pencils
             for(int i = 0 ; i < num_dfts_per_proc ; i++)
@@ -302,159 +314,146 @@ namespace Nektar
                         Array<OneD, Array<OneD, NekDouble> > &outarray,
                         CoeffState coeffstate)
         {
+            boost::ignore_unused(coeffstate);
+
             int ndim = inarray1.num_elements();
             ASSERTL1( inarray2.num_elements() % ndim == 0,
                      "Wrong dimensions for DealiasedDotProd.");
             int nvec = inarray2.num_elements() / ndim;
+            int nin  = ndim + ndim*nvec;
 
             int num_dofs = inarray1[0].num_elements();
             int N = m_homogeneousBasis->GetNumPoints();
 
             int num_points_per_plane = num_dofs/m_planes.num_elements();
-            int num_proc;
-            if(!m_session->DefinesSolverInfo("HomoStrip"))
-            {
-                num_proc             = m_comm->GetColumnComm()->GetSize();
-            }
-            else
-            {
-                num_proc             = m_StripZcomm->GetSize();
-            }
-            int num_dfts_per_proc    = num_points_per_plane / num_proc
-                                        + (num_points_per_plane % num_proc > 0);
+            int num_dfts_per_proc    = m_transposition->GetNumPencilsPerProc(
+                                                num_points_per_plane);
 
-            // Get inputs in Fourier space
-            Array<OneD, Array<OneD, NekDouble> > V1(ndim);
-            Array<OneD, Array<OneD, NekDouble> > V2(ndim*nvec);
-            if(m_WaveSpace)
-            {
-                for (int i = 0; i < ndim; i++)
-                {
-                    V1[i] = inarray1[i];
-                }
-                for (int i = 0; i < ndim*nvec; i++)
-                {
-                    V2[i] = inarray2[i];
-                }
-            }
-            else
-            {
-                for (int i = 0; i < ndim; i++)
-                {
-                    V1[i] = Array<OneD, NekDouble> (num_dofs);
-                    HomogeneousFwdTrans(inarray1[i],V1[i],coeffstate);
-                }
-                for (int i = 0; i < ndim*nvec; i++)
-                {
-                    V2[i] = Array<OneD, NekDouble> (num_dofs);
-                    HomogeneousFwdTrans(inarray2[i],V2[i],coeffstate);
-                }
-            }
-
-            // Allocate variables for ffts
-            Array<OneD, Array<OneD, NekDouble> > ShufV1(ndim);
-            Array<OneD, NekDouble>               ShufV1_PAD_coef(m_padsize,0.0);
-            Array<OneD, Array<OneD, NekDouble> > ShufV1_PAD_phys(ndim);
+            // All inputs are transposed together. Outside of wave space the
+            // homogeneous FFT is applied to each pencil after transposition,
+            // rather than transposing to and from Fourier space first.
+            Array<OneD, Array<OneD, NekDouble> > V(nin), ShufV(nin);
             for (int i = 0; i < ndim; i++)
             {
-                ShufV1[i]          = Array<OneD, NekDouble>
-                                     (num_dfts_per_proc*N,0.0);
-                ShufV1_PAD_phys[i] = Array<OneD, NekDouble>
-                                     (m_padsize,0.0);
+                V[i] = inarray1[i];
             }
-
-            Array<OneD, Array<OneD, NekDouble> > ShufV2(ndim*nvec);
-            Array<OneD, NekDouble>               ShufV2_PAD_coef(m_padsize,0.0);
-            Array<OneD, Array<OneD, NekDouble> > ShufV2_PAD_phys(ndim*nvec);
             for (int i = 0; i < ndim*nvec; i++)
             {
-                ShufV2[i]          = Array<OneD, NekDouble>
-                                     (num_dfts_per_proc*N,0.0);
-                ShufV2_PAD_phys[i] = Array<OneD, NekDouble>
-                                     (m_padsize,0.0);
+                V[ndim+i] = inarray2[i];
+            }
+            for (int i = 0; i < nin; i++)
+            {
+                ShufV[i] = Array<OneD, NekDouble>(num_dfts_per_proc*N, 0.0);
             }
 
             Array<OneD, Array<OneD, NekDouble> > ShufV1V2(nvec);
-            Array<OneD, NekDouble>               ShufV1V2_PAD_coef(m_padsize,0.0);
-            Array<OneD, NekDouble>               ShufV1V2_PAD_phys(m_padsize,0.0);
             for (int i = 0; i < nvec; i++)
             {
-                ShufV1V2[i]          = Array<OneD, NekDouble>
-                                     (num_dfts_per_proc*N,0.0);
+                ShufV1V2[i] = Array<OneD, NekDouble>(num_dfts_per_proc*N, 0.0);
             }
 
-            // Transpose inputs
-            for (int i = 0; i < ndim; i++)
-            {
-                m_transposition->Transpose(V1[i], ShufV1[i], false,
-                                           LibUtilities::eXYtoZ);
-            }
-            for (int i = 0; i < ndim*nvec; i++)
+            // Allocate variables for ffts
+            Array<OneD, NekDouble>               ShufV_PAD_coef(m_padsize,0.0);
+            Array<OneD, Array<OneD, NekDouble> > ShufV_PAD_phys(nin);
+            for (int i = 0; i < nin; i++)
             {
-                m_transposition->Transpose(V2[i], ShufV2[i], false,
-                                           LibUtilities::eXYtoZ);
+                ShufV_PAD_phys[i] = Array<OneD, NekDouble>(m_padsize,0.0);
             }
+            Array<OneD, NekDouble>               ShufV1V2_PAD_coef(m_padsize,0.0);
+            Array<OneD, NekDouble>               ShufV1V2_PAD_phys(m_padsize,0.0);
+            Array<OneD, NekDouble>               tmp;
 
-            // Looping on the pencils
-            for(int i = 0 ; i < num_dfts_per_proc ; i++)
+            // The pencils are split into chunks. The transposition of chunk
+            // k+1 is in flight while the FFTs of chunk k are performed, and
+            // the results of each chunk are sent back as soon as they are
+            // ready.
+            int nchunks    = std::min(m_transChunks, num_dfts_per_proc);
+            int chunk_size = (num_dfts_per_proc + nchunks - 1) / nchunks;
+            nchunks        = (num_dfts_per_proc + chunk_size - 1) / chunk_size;
+
+            std::vector<LibUtilities::TranspositionExchange> fwd(nchunks);
+            std::vector<LibUtilities::TranspositionExchange> bwd(nchunks);
+
+            m_transposition->TransposeBegin(V, ShufV, fwd[0],
+                                            LibUtilities::eXYtoZ, 0,
+                                            std::min(chunk_size,
+                                                     num_dfts_per_proc));
+
+            for (int c = 0; c < nchunks; c++)
             {
-                for (int j = 0; j < ndim; j++)
-                {
-                    // Copying the i-th pencil pf lenght N into a bigger
-                    // pencil of lenght 1.5N We are in Fourier space
-                    Vmath::Vcopy(N, &(ShufV1[j][i*N]), 1,
-                                    &(ShufV1_PAD_coef[0]), 1);
-                    // Moving to physical space using the padded system
-                    m_FFT_deal->FFTBwdTrans(ShufV1_PAD_coef, ShufV1_PAD_phys[j]);
-                }
-                for (int j = 0; j < ndim*nvec; j++)
+                int start = c * chunk_size;
+                int end   = std::min(start + chunk_size, num_dfts_per_proc);
+
+                if (c + 1 < nchunks)
                 {
-                    Vmath::Vcopy(N, &(ShufV2[j][i*N]), 1,
-                                    &(ShufV2_PAD_coef[0]), 1);
-                    m_FFT_deal->FFTBwdTrans(ShufV2_PAD_coef, ShufV2_PAD_phys[j]);
+                    m_transposition->TransposeBegin(
+                        V, ShufV, fwd[c+1], LibUtilities::eXYtoZ, end,
+                        std::min(chunk_size, num_dfts_per_proc - end));
                 }
+                m_transposition->TransposeEnd(fwd[c]);
 
-                // Performing the vectors multiplication in physical space on
-                // the padded system
-                for (int j = 0; j < nvec; j++)
+                // Looping on the pencils
+                for (int i = start; i < end; i++)
                 {
-                    Vmath::Zero(m_padsize, ShufV1V2_PAD_phys, 1);
-                    for (int k = 0; k < ndim; k++)
+                    for (int j = 0; j < nin; j++)
                     {
-                        Vmath::Vvtvp(m_padsize, ShufV1_PAD_phys[k], 1,
-                                                ShufV2_PAD_phys[j*ndim+k], 1,
-                                                ShufV1V2_PAD_phys, 1,
-                                                ShufV1V2_PAD_phys, 1);
+                        // Copying the i-th pencil pf lenght N into a bigger
+                        // pencil of lenght 1.5N We are in Fourier space
+                        if (m_WaveSpace)
+                        {
+                            Vmath::Vcopy(N, &(ShufV[j][i*N]), 1,
+                                            &(ShufV_PAD_coef[0]), 1);
+                        }
+                        else
+                        {
+                            m_FFT->FFTFwdTrans(tmp = ShufV[j] + i*N,
+                                               ShufV_PAD_coef);
+                        }
+                        // Moving to physical space using the padded system
+                        m_FFT_deal->FFTBwdTrans(ShufV_PAD_coef,
+                                                ShufV_PAD_phys[j]);
                     }
-                    // Moving back the result (V1*V2)_phys in Fourier space,
-                    // padded system
-                    m_FFT_deal->FFTFwdTrans(ShufV1V2_PAD_phys, ShufV1V2_PAD_coef);
-                    // Copying the first half of the padded pencil in the full
-                    // vector (Fourier space)
-                    Vmath::Vcopy(N, &(ShufV1V2_PAD_coef[0]), 1,
-                                    &(ShufV1V2[j][i*N]),     1);
-                }
-            }
 
-            // Moving the results to the output
-            if (m_WaveSpace)
-            {
-                for (int j = 0; j < nvec; j++)
-                {
-                    m_transposition->Transpose(ShufV1V2[j], outarray[j],
-                                           false,
-                                           LibUtilities::eZtoXY);
+                    // Performing the vectors multiplication in physical
+                    // space on the padded system
+                    for (int j = 0; j < nvec; j++)
+                    {
+                        Vmath::Zero(m_padsize, ShufV1V2_PAD_phys, 1);
+                        for (int k = 0; k < ndim; k++)
+                        {
+                            Vmath::Vvtvp(m_padsize, ShufV_PAD_phys[k], 1,
+                                         ShufV_PAD_phys[ndim+j*ndim+k], 1,
+                                         ShufV1V2_PAD_phys, 1,
+                                         ShufV1V2_PAD_phys, 1);
+                        }
+                        // Moving back the result (V1*V2)_phys in Fourier
+                        // space, padded system
+                        m_FFT_deal->FFTFwdTrans(ShufV1V2_PAD_phys,
+                                                ShufV1V2_PAD_coef);
+                        // Copying the first half of the padded pencil in the
+                        // full vector, in Fourier or physical space
+                        if (m_WaveSpace)
+                        {
+                            Vmath::Vcopy(N, &(ShufV1V2_PAD_coef[0]), 1,
+                                            &(ShufV1V2[j][i*N]),     1);
+                        }
+                        else
+                        {
+                            m_FFT->FFTBwdTrans(ShufV1V2_PAD_coef,
+                                               tmp = ShufV1V2[j] + i*N);
+                        }
+                    }
                 }
+
+                // Moving the results to the output
+                m_transposition->TransposeBegin(ShufV1V2, outarray, bwd[c],
+                                                LibUtilities::eZtoXY, start,
+                                                end - start);
             }
-            else
+
+            for (int c = 0; c < nchunks; c++)
             {
-                Array<OneD, NekDouble> V1V2(num_dofs);
-                for (int j = 0; j < nvec; j++)
-                {
-                    m_transposition->Transpose(ShufV1V2[j], V1V2, false,
-                                       LibUtilities::eZtoXY);
-                    HomogeneousBwdTrans(V1V2, outarray[j], coeffstate);
-                }
+                m_transposition->TransposeEnd(bwd[c]);
             }
         }
 
@@ -672,19 +671,14 @@ namespace Nektar
                                  inarray,1,fft_in,1);
                 }
                 
+                // Transform all of the z-lines with a single batched plan
                 if(IsForwards)
                 {
-                    for(int i = 0 ; i < num_dfts_per_proc ; i++)
-                    {
-                        m_FFT->FFTFwdTrans(m_tmpIN = fft_in + i*m_homogeneousBasis->GetNumPoints(), m_tmpOUT = fft_out + i*m_homogeneousBasis->GetNumPoints());
-                    }
+                    m_FFT->FFTFwdTrans(num_dfts_per_proc, fft_in, fft_out);
                 }
                 else 
                 {
-                    for(int i = 0 ; i < num_dfts_per_proc ; i++)
-                    {
-                        m_FFT->FFTBwdTrans(m_tmpIN = fft_in + i*m_homogeneousBasis->GetNumPoints(), m_tmpOUT = fft_out + i*m_homogeneousBasis->GetNumPoints());
-                    }
+                    m_FFT->FFTBwdTrans(num_dfts_per_proc, fft_in, fft_out);
                 }
         
                 if(UnShuff)
@@ -1120,13 +1114,14 @@ namespace Nektar
             }
         }
 
-        void ExpListHomogeneous1D::v_WriteVtkPieceData(std::ostream &outfile, int expansion,
-                                        std::string var)
+        void ExpListHomogeneous1D::v_GetVtkPieceData(
+            int                     expansion,
+            Array<OneD, NekDouble> &data)
         {
             // If there is only one plane (e.g. HalfMode), we write a 2D plane.
             if (m_planes.num_elements() == 1)
             {
-                m_planes[0]->WriteVtkPieceData(outfile, expansion, var);
+                m_planes[0]->GetVtkPieceData(expansion, data);
                 return;
             }
 
@@ -1163,28 +1158,27 @@ namespace Nektar
                 }
             }
 
-            // printing the fields of that zone
-            outfile << "        <DataArray type=\"Float64\" Name=\""
-                    << var << "\">" << endl;
-            outfile << "          ";
-            for (int n = 0; n < m_planes.num_elements(); ++n)
+            int nplanes = m_planes.num_elements();
+            data = Array<OneD, NekDouble>((nplanes + outputExtraPlane) * nq);
+
+            for (int n = 0; n < nplanes; ++n)
             {
                 const Array<OneD, NekDouble> phys = m_phys + m_phys_offset[expansion] + n*npoints_per_plane;
                 for(i = 0; i < nq; ++i)
                 {
-                    outfile << (fabs(phys[i]) < NekConstants::kNekZeroTol ? 0 : phys[i]) << " ";
+                    data[n*nq + i] = fabs(phys[i]) < NekConstants::kNekZeroTol ?
+                        0.0 : phys[i];
                 }
             }
             if (outputExtraPlane)
             {
                 for(i = 0; i < nq; ++i)
                 {
-                    outfile << (fabs(extraPlane[i]) < NekConstants::kNekZeroTol ?
-                                0 : extraPlane[i]) << " ";
+                    data[nplanes*nq + i] =
+                        fabs(extraPlane[i]) < NekConstants::kNekZeroTol ?
+                        0.0 : extraPlane[i];
                 }
             }
-            outfile << endl;
-            outfile << "        </DataArray>" << endl;
         }
         
         void ExpListHomogeneous1D::v_PhysInterp1DScaled(const NekDouble scale, const Array<OneD, NekDouble> &inarray, Array<OneD, NekDouble> &outarray)
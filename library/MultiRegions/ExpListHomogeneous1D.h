@@ -221,8 +221,9 @@ namespace Nektar
             virtual void v_ExtractCoeffsToCoeffs(
                                                  const std::shared_ptr<ExpList> &fromExpList, const Array<OneD, const NekDouble> &fromCoeffs, Array<OneD, NekDouble> &toCoeffs);
 
-            virtual void v_WriteVtkPieceData(std::ostream &outfile, int expansion,
-                                             std::string var);
+            virtual void v_GetVtkPieceData(
+                int expansion,
+                Array<OneD, NekDouble> &data);
 
             virtual void v_PhysInterp1DScaled(const NekDouble scale, const Array<OneD, NekDouble> &inarray, Array<OneD, NekDouble> &outarray);
 
@@ -280,6 +281,10 @@ namespace Nektar
             bool m_dealiasing;
             int m_padsize;
 
+            /// Number of chunks in which the dealiased product transposes
+            /// are pipelined with the FFTs.
+            int m_transChunks;
+
             /// Spectral vanishing Viscosity coefficient for stabilisation 
             Array<OneD, NekDouble> m_specVanVisc;
         };
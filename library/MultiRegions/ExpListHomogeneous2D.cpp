@@ -91,6 +91,7 @@ namespace Nektar
 
             if(m_useFFT)
             {
+                LibUtilities::NektarFFT::LoadPlanOptions(m_session);
                 m_FFT_y = LibUtilities::GetNektarFFTFactory().CreateInstance("NekFFTW", m_ny);
                 m_FFT_z = LibUtilities::GetNektarFFTFactory().CreateInstance("NekFFTW", m_nz);
             }
@@ -430,36 +431,24 @@ namespace Nektar
                 
                 if(IsForwards)
                 {
-                    for(int i=0;i<(p*m_nz);i++)
-                    {
-                        m_FFT_y->FFTFwdTrans(m_tmpIN = fft_in + i*m_ny, m_tmpOUT = fft_out + i*m_ny);
-                    }
+                    m_FFT_y->FFTFwdTrans(p*m_nz, fft_in, fft_out);
                     
                 }
                 else 
                 {
-                    for(int i=0;i<(p*m_nz);i++)
-                    {
-                        m_FFT_y->FFTBwdTrans(m_tmpIN = fft_in + i*m_ny, m_tmpOUT = fft_out + i*m_ny);
-                    }
+                    m_FFT_y->FFTBwdTrans(p*m_nz, fft_in, fft_out);
                 }
         
                 m_transposition->Transpose(fft_out,fft_in,false,LibUtilities::eYZtoZY);
                 
                 if(IsForwards)
                 {
-                    for(int i=0;i<(p*m_ny);i++)
-                    {
-                        m_FFT_z->FFTFwdTrans(m_tmpIN = fft_in + i*m_nz, m_tmpOUT = fft_out + i*m_nz);
-                    }
+                    m_FFT_z->FFTFwdTrans(p*m_ny, fft_in, fft_out);
                     
                 }
                 else 
                 {
-                    for(int i=0;i<(p*m_ny);i++)
-                    {
-                        m_FFT_z->FFTBwdTrans(m_tmpIN = fft_in + i*m_nz, m_tmpOUT = fft_out + i*m_nz);
-                    }
+                    m_FFT_z->FFTBwdTrans(p*m_ny, fft_in, fft_out);
                 }
         
                 //TODO: required ZYtoX routine
@@ -783,27 +772,25 @@ namespace Nektar
             }
         }
         
-        void ExpListHomogeneous2D::v_WriteVtkPieceData(std::ostream &outfile, int expansion,
-                                        std::string var)
+        void ExpListHomogeneous2D::v_GetVtkPieceData(
+            int                     expansion,
+            Array<OneD, NekDouble> &data)
         {
             int i;
             int nq = (*m_exp)[expansion]->GetTotPoints();
             int npoints_per_line = m_lines[0]->GetTotPoints();
+            int nlines = m_lines.num_elements();
 
-            // printing the fields of that zone
-            outfile << "        <DataArray type=\"Float64\" Name=\""
-                    << var << "\">" << endl;
-            outfile << "          ";
-            for (int n = 0; n < m_lines.num_elements(); ++n)
+            data = Array<OneD, NekDouble>(nlines * nq);
+            for (int n = 0; n < nlines; ++n)
             {
                 const Array<OneD, NekDouble> phys = m_phys + m_phys_offset[expansion] + n*npoints_per_line;
                 for(i = 0; i < nq; ++i)
                 {
-                    outfile << (fabs(phys[i]) < NekConstants::kNekZeroTol ? 0 : phys[i]) << " ";
+                    data[n*nq + i] = fabs(phys[i]) < NekConstants::kNekZeroTol ?
+                        0.0 : phys[i];
                 }
             }
-            outfile << endl;
-            outfile << "        </DataArray>" << endl;
         }
     
         void ExpListHomogeneous2D::v_PhysDeriv(const Array<OneD, const NekDouble> &inarray,
@@ -63,6 +63,12 @@ namespace Nektar
             m_tolerance = pLocToGloMap->GetIterativeTolerance();
             m_maxiter   = pLocToGloMap->GetMaxIterations();
 
+            std::string iterSolver = pLocToGloMap->GetLinSysIterSolver();
+            ASSERTL0(iterSolver == "ConjugateGradient" ||
+                     iterSolver == "PipelinedConjugateGradient",
+                     "Unknown LinSysIterSolver " + iterSolver);
+            m_pipelined = iterSolver == "PipelinedConjugateGradient";
+
             LibUtilities::CommSharedPtr vComm = m_expList.lock()->GetComm()->GetRowComm();
             m_root    = (vComm->GetRank())? false : true;
 
@@ -143,14 +149,27 @@ namespace Nektar
 
                 // check the input vector (rhs) is not zero
 
-                NekDouble rhsNorm = Vmath::Dot2(nNonDir,
-                                                pInput + nDir,
-                                                pInput + nDir,
-                                                m_map + nDir);
+                // notation follows the paper cited:
+                // \alpha_i = \tilda{x_i}^T b^n
+                // projected x, px = \sum \alpha_i \tilda{x_i}
+                // The rhs norm is exchanged together with the \alpha_i.
 
-                vComm->AllReduce(rhsNorm, Nektar::LibUtilities::ReduceSum);
+                int nPrev = m_prevLinSol.size();
+                Array<OneD, NekDouble> alpha     (nPrev + 1, 0.0);
+                for (int i = 0; i < nPrev; i++)
+                {
+                    alpha[i] = Vmath::Dot2(nNonDir,
+                                           m_prevLinSol[i],
+                                           pInput + nDir,
+                                           m_map + nDir);
+                }
+                alpha[nPrev] = Vmath::Dot2(nNonDir,
+                                           pInput + nDir,
+                                           pInput + nDir,
+                                           m_map + nDir);
+                vComm->AllReduce(alpha, Nektar::LibUtilities::ReduceSum);
 
-                if (rhsNorm < NekConstants::kNekZeroTol)
+                if (alpha[nPrev] < NekConstants::kNekZeroTol)
                 {
                     Array<OneD, NekDouble> tmp = pOutput+nDir;
                     Vmath::Zero(nNonDir, tmp, 1);
@@ -169,21 +188,7 @@ namespace Nektar
                 NekVector<NekDouble> tmpx  (nNonDir, tmp = tmpx_s  + nDir, eWrapper);
 
 
-                // notation follows the paper cited:
-                // \alpha_i = \tilda{x_i}^T b^n
-                // projected x, px = \sum \alpha_i \tilda{x_i}
-
-                Array<OneD, NekDouble> alpha     (m_prevLinSol.size(), 0.0);
-                for (int i = 0; i < m_prevLinSol.size(); i++)
-                {
-                    alpha[i] = Vmath::Dot2(nNonDir,
-                                           m_prevLinSol[i],
-                                           pInput + nDir,
-                                           m_map + nDir);
-                }
-                vComm->AllReduce(alpha, Nektar::LibUtilities::ReduceSum);
-
-                for (int i = 0; i < m_prevLinSol.size(); i++)
+                for (int i = 0; i < nPrev; i++)
                 {
                     if (alpha[i] < NekConstants::kNekZeroTol)
                     {
@@ -358,6 +363,13 @@ namespace Nektar
             const AssemblyMapSharedPtr        &plocToGloMap,
             const int                          nDir)
         {
+            if (m_pipelined)
+            {
+                DoPipelinedConjugateGradient(nGlobal, pInput, pOutput,
+                                             plocToGloMap, nDir);
+                return;
+            }
+
             if (!m_precon)
             {
                 v_UniqueMap();
@@ -540,6 +552,168 @@ namespace Nektar
             }
         }
 
+        /**
+         * Solve a global linear system using the pipelined conjugate
+         * gradient method (Ghysels and Vanroose, Parallel Computing 40,
+         * 2014). Recurrences for the preconditioned residual \f$u = Mr\f$,
+         * \f$w = Au\f$ and their preconditioned images are added to those of
+         * DoConjugateGradient, so that the inner products of an iteration
+         * are exchanged in a single non-blocking reduction which overlaps
+         * the application of the preconditioner and the operator. The method
+         * is equivalent to DoConjugateGradient in exact arithmetic, at the
+         * cost of four additional vector updates per iteration.
+         *
+         * @param       pInput      Input residual  of all DOFs.
+         * @param       pOutput     Solution vector of all DOFs.
+         */
+        void GlobalLinSysIterative::DoPipelinedConjugateGradient(
+            const int                          nGlobal,
+            const Array<OneD,const NekDouble> &pInput,
+                  Array<OneD,      NekDouble> &pOutput,
+            const AssemblyMapSharedPtr        &plocToGloMap,
+            const int                          nDir)
+        {
+            if (!m_precon)
+            {
+                v_UniqueMap();
+                m_precon = CreatePrecon(plocToGloMap);
+                m_precon->BuildPreconditioner();
+            }
+
+            // Get the communicator for performing data exchanges
+            LibUtilities::CommSharedPtr vComm
+                = m_expList.lock()->GetComm()->GetRowComm();
+
+            // Get vector sizes
+            int nNonDir = nGlobal - nDir;
+
+            // Allocate array storage. Vectors passed to the operator hold
+            // all DOFs, with zero Dirichlet entries.
+            Array<OneD, NekDouble> u_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> w_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> v_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> t_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> r_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> p_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> s_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> q_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> z_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> tmp, tmp2;
+
+            NekDouble alpha = 0.0, beta = 0.0, rho, rho_old = 0.0, mu, eps;
+            Array<OneD, NekDouble> vExchange(3, 0.0);
+            LibUtilities::CommRequestSharedPtr request =
+                vComm->CreateRequest(1);
+
+            // Copy initial residual from input
+            Vmath::Vcopy(nNonDir, &pInput[nDir], 1, &r_A[0], 1);
+            // zero homogeneous out array ready for solution updates
+            // Should not be earlier in case input vector is same as
+            // output and above copy has been peformed
+            Vmath::Zero(nNonDir, tmp = pOutput + nDir, 1);
+
+            if(m_rhs_magnitude == NekConstants::kNekUnsetDouble)
+            {
+                NekVector<NekDouble> inGlob (nGlobal, pInput, eWrapper);
+                Set_Rhs_Magnitude(inGlob);
+            }
+
+            // u_0 = M r_0, w_0 = A u_0
+            m_precon->DoPreconditioner(r_A, tmp = u_A + nDir);
+            v_DoMatrixMultiply(u_A, w_A);
+
+            m_totalIterations = 0;
+
+            for (int k = 0; ; ++k)
+            {
+                // <r_k, u_k>, <w_k, u_k>, <r_k, r_k>
+                vExchange[0] = Vmath::Dot2(nNonDir,
+                                           r_A,
+                                           u_A + nDir,
+                                           m_map + nDir);
+                vExchange[1] = Vmath::Dot2(nNonDir,
+                                           w_A + nDir,
+                                           u_A + nDir,
+                                           m_map + nDir);
+                vExchange[2] = Vmath::Dot2(nNonDir,
+                                           r_A,
+                                           r_A,
+                                           m_map + nDir);
+
+                vComm->IAllReduce(vExchange, Nektar::LibUtilities::ReduceSum,
+                                  request);
+
+                // v_k = M w_k, t_k = A v_k, overlapping the reduction
+                m_precon->DoPreconditioner(tmp  = w_A + nDir,
+                                           tmp2 = v_A + nDir);
+                v_DoMatrixMultiply(v_A, t_A);
+
+                vComm->WaitAll(request);
+
+                rho = vExchange[0];
+                mu  = vExchange[1];
+                eps = vExchange[2];
+
+                // Count iterations as in DoConjugateGradient
+                m_totalIterations = k > 0 ? k + 1 : 0;
+
+                // test if norm is within tolerance
+                if (eps < m_tolerance * m_tolerance * m_rhs_magnitude)
+                {
+                    if (m_verbose && m_root)
+                    {
+                        cout << "CG iterations made = " << m_totalIterations
+                             << " using tolerance of "  << m_tolerance
+                             << " (error = " << sqrt(eps/m_rhs_magnitude)
+                             << ", rhs_mag = " << sqrt(m_rhs_magnitude) <<  ")"
+                             << endl;
+                    }
+                    break;
+                }
+
+                if(k >= m_maxiter)
+                {
+                    if (m_root)
+                    {
+                        cout << "CG iterations made = " << m_totalIterations
+                             << " using tolerance of "  << m_tolerance
+                             << " (error = " << sqrt(eps/m_rhs_magnitude)
+                             << ", rhs_mag = " << sqrt(m_rhs_magnitude) <<  ")"
+                             << endl;
+                    }
+                    ROOTONLY_NEKERROR(ErrorUtil::efatal,
+                                      "Exceeded maximum number of iterations");
+                }
+
+                // Compute search direction and solution coefficients
+                if (k == 0)
+                {
+                    alpha = rho/mu;
+                }
+                else
+                {
+                    beta  = rho/rho_old;
+                    alpha = rho/(mu - rho*beta/alpha);
+                }
+                rho_old = rho;
+
+                // Update search direction p_k and its images s_k = A p_k,
+                // q_k = M s_k and z_k = A q_k
+                Vmath::Svtvp(nNonDir, beta, &p_A[0], 1, &u_A[nDir], 1, &p_A[0], 1);
+                Vmath::Svtvp(nNonDir, beta, &s_A[0], 1, &w_A[nDir], 1, &s_A[0], 1);
+                Vmath::Svtvp(nNonDir, beta, &q_A[0], 1, &v_A[nDir], 1, &q_A[0], 1);
+                Vmath::Svtvp(nNonDir, beta, &z_A[0], 1, &t_A[nDir], 1, &z_A[0], 1);
+
+                // Update solution x_{k+1}
+                Vmath::Svtvp(nNonDir, alpha, &p_A[0], 1, &pOutput[nDir], 1, &pOutput[nDir], 1);
+
+                // Update r_{k+1}, u_{k+1} = M r_{k+1} and w_{k+1} = A u_{k+1}
+                Vmath::Svtvp(nNonDir, -alpha, &s_A[0], 1, &r_A[0], 1, &r_A[0], 1);
+                Vmath::Svtvp(nNonDir, -alpha, &q_A[0], 1, &u_A[nDir], 1, &u_A[nDir], 1);
+                Vmath::Svtvp(nNonDir, -alpha, &z_A[0], 1, &w_A[nDir], 1, &w_A[nDir], 1);
+            }
+        }
+
         void GlobalLinSysIterative::Set_Rhs_Magnitude(
             const NekVector<NekDouble> &pIn)
         {
@@ -93,6 +93,9 @@ namespace Nektar
             /// Total counter of previous solutions
             int m_numPrevSols;
 
+            /// Whether to use the pipelined conjugate gradient method
+            bool m_pipelined;
+
             /// A-conjugate projection technique
             void DoAconjugateProjection(
                     const int pNumRows,
@@ -109,6 +112,14 @@ namespace Nektar
                     const AssemblyMapSharedPtr &locToGloMap,
                     const int pNumDir);
 
+            /// Iterative solve with a single non-blocking reduction per
+            /// iteration
+            void DoPipelinedConjugateGradient(
+                    const int pNumRows,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const AssemblyMapSharedPtr &locToGloMap,
+                    const int pNumDir);
 
             void Set_Rhs_Magnitude(const NekVector<NekDouble> &pIn);
 
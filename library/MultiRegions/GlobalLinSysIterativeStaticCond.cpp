@@ -302,19 +302,12 @@ namespace Nektar
                 cnt += loc_lda;
             }
 
-            DNekSmvBsrDiagBlkMat::SparseStorageSharedPtrVector
-                sparseStorage (1);
-
-            BCOMatType partMat;
-            convertCooToBco(1, gmat_coo, partMat);
-
-            sparseStorage[0] =
-                 MemoryManager<DNekSmvBsrDiagBlkMat::StorageType>::
-                    AllocateSharedPtr(rows, cols, 1, partMat, matStorage );
-
-            // Create block diagonal matrix
-            m_sparseSchurCompl = MemoryManager<DNekSmvBsrDiagBlkMat>::
-                                            AllocateSharedPtr(sparseStorage);
+            // Create the global matrix in the storage selected by
+            // GlobalMatrixStorageType. BSR storage keeps unit blocks, as
+            // the assembled matrix has no block structure to exploit.
+            m_globalSchurCompl = MemoryManager<GlobalMatrix>::
+                AllocateSharedPtr(m_expList.lock()->GetSession(),
+                                  rows, cols, gmat_coo, matStorage, 1);
         }
 
 
@@ -324,9 +317,10 @@ namespace Nektar
          */
         void GlobalLinSysIterativeStaticCond::PrepareLocalSchurComplement()
         {
+            LibUtilities::SessionReaderSharedPtr session =
+                m_expList.lock()->GetSession();
             LocalMatrixStorageStrategy storageStrategy =
-                m_expList.lock()->GetSession()->
-                    GetSolverInfoAsEnum<LocalMatrixStorageStrategy>(
+                session->GetSolverInfoAsEnum<LocalMatrixStorageStrategy>(
                                        "LocalMatrixStorageStrategy");
 
             switch(storageStrategy)
@@ -390,6 +384,44 @@ namespace Nektar
                     DNekScalMatSharedPtr loc_mat;
                     int loc_lda;
                     int blockSize = 0;
+
+                    MatrixStorageType matStorageType =
+                        session->GetSolverInfoAsEnum<MatrixStorageType>(
+                            "GlobalMatrixStorageType");
+
+                    if (matStorageType == eSmvSELL)
+                    {
+                        // SELL-C-sigma storage holds the block-diagonal
+                        // matrix as a whole.
+                        COOMatType locmat_coo;
+                        int nrows = 0;
+                        for (int n = 0;
+                             n < m_schurCompl->GetNumberOfBlockRows(); ++n)
+                        {
+                            loc_mat = m_schurCompl->GetBlock(n,n);
+                            loc_lda = loc_mat->GetRows();
+
+                            for (int i = 0; i < loc_lda; ++i)
+                            {
+                                for (int j = 0; j < loc_lda; ++j)
+                                {
+                                    locmat_coo[std::make_pair(nrows + i,
+                                                              nrows + j)] =
+                                        (*loc_mat)(i,j);
+                                }
+                            }
+                            nrows += loc_lda;
+
+                            GlobalLinSys::v_DropStaticCondBlock(n);
+                        }
+
+                        m_globalSchurCompl = MemoryManager<GlobalMatrix>::
+                            AllocateSharedPtr(session, nrows, nrows,
+                                              locmat_coo);
+                        break;
+                    }
+
+                    int nThreads = GlobalMatrix::LoadNumThreads(session);
                     
                     // First run through to split the set of local matrices into
                     // partitions of fixed block size, and count number of local
@@ -458,6 +490,7 @@ namespace Nektar
                             AllocateSharedPtr(
                                 partitions[part].first, partitions[part].first,
                                 partitions[part].second, partMat, matStorage );
+                        sparseStorage[part]->SetNumThreads(nThreads);
                     }
 
                     // Create block diagonal matrix
@@ -493,16 +526,23 @@ namespace Nektar
                 Array<OneD, NekDouble> in  = pInput  + nDir;
                 Array<OneD, NekDouble> out = pOutput + nDir;
 
-                m_sparseSchurCompl->Multiply(in,out);
+                m_globalSchurCompl->Multiply(in,out);
                 asmMap->UniversalAssembleBnd(pOutput, nDir);
             }
-            else if (m_sparseSchurCompl)
+            else if (m_sparseSchurCompl || m_globalSchurCompl)
             {
                 // Do matrix multiply locally using block-diagonal sparse matrix
                 Array<OneD, NekDouble> tmp = m_wsp + nLocal;
 
                 asmMap->GlobalToLocalBnd(pInput, m_wsp);
-                m_sparseSchurCompl->Multiply(m_wsp,tmp);
+                if (m_globalSchurCompl)
+                {
+                    m_globalSchurCompl->Multiply(m_wsp,tmp);
+                }
+                else
+                {
+                    m_sparseSchurCompl->Multiply(m_wsp,tmp);
+                }
                 asmMap->AssembleBnd(tmp, pOutput);
             }
             else
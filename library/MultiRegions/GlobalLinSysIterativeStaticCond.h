@@ -145,6 +145,10 @@ namespace Nektar
             Array<OneD, NekDouble>                   m_scale;
             /// Sparse representation of Schur complement matrix at this level
             DNekSmvBsrDiagBlkMatSharedPtr            m_sparseSchurCompl;
+            /// Schur complement matrix at this level, in the storage of
+            /// GlobalMatrixStorageType, when assembled globally or when
+            /// this storage is SmvSELL
+            GlobalMatrixSharedPtr                    m_globalSchurCompl;
             /// Utility strings
             static std::string                       storagedef;
             static std::string                       storagelookupIds[];
@@ -33,7 +33,9 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <MultiRegions/GlobalMatrix.h>
+#include <LibUtilities/BasicUtils/Thread.h>
 #include <LibUtilities/LinearAlgebra/StorageSmvBsr.hpp>
+#include <LibUtilities/LinearAlgebra/StorageSmvSell.hpp>
 #include <LibUtilities/LinearAlgebra/SparseMatrix.hpp>
 #include <LibUtilities/LinearAlgebra/SparseUtils.hpp>
 
@@ -50,7 +52,9 @@ namespace Nektar
             RegisterDefaultSolverInfo("GlobalMatrixStorageType","SmvBSR");
         std::string GlobalMatrix::lookupIds[3] = {
             LibUtilities::SessionReader::RegisterEnumValue(
-                "GlobalMatrixStorageType", "SmvBSR", MultiRegions::eSmvBSR)
+                "GlobalMatrixStorageType", "SmvBSR", MultiRegions::eSmvBSR),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "GlobalMatrixStorageType", "SmvSELL", MultiRegions::eSmvSELL)
         };
 
 
@@ -64,20 +68,29 @@ namespace Nektar
          * @param   rows        Number of rows in matrix.
          * @param   columns     Number of columns in matrix.
          * @param   cooMat      ?
+         * @param   blockSize   Size of the dense sub-blocks of BSR storage.
+         *                      If zero, the SparseBlockSize parameter is
+         *                      used.
          */
         GlobalMatrix::GlobalMatrix(
                                    const LibUtilities::SessionReaderSharedPtr& pSession,
                                    unsigned int rows, 
                                    unsigned int columns,
                                    const COOMatType &cooMat,
-                                   const MatrixStorage& matStorage):
+                                   const MatrixStorage& matStorage,
+                                   const int blockSize):
             m_smvbsrmatrix(),
+            m_smvsellmatrix(),
             m_rows(rows),
-            m_mulCallsCounter(0)
+            m_mulCallsCounter(0),
+            m_copyOp(false)
         {
             MatrixStorageType storageType = pSession->
                 GetSolverInfoAsEnum<MatrixStorageType>("GlobalMatrixStorageType");
 
+            // Number of threads over which the multiply is split
+            int nThreads = LoadNumThreads(pSession);
+
             unsigned int brows, bcols;
 
             // Size of dense matrix sub-blocks
@@ -88,7 +101,12 @@ namespace Nektar
             // assuming current sparse format allows
             // block-sparse data representation
 
-            if(pSession->DefinesParameter("SparseBlockSize"))
+            if (blockSize > 0)
+            {
+                block_size = blockSize;
+            }
+            else if(storageType == eSmvBSR &&
+               pSession->DefinesParameter("SparseBlockSize"))
             {
                 pSession->LoadParameter("SparseBlockSize", block_size);
                 ASSERTL1(block_size > 0,"SparseBlockSize parameter must to be positive");
@@ -105,7 +123,10 @@ namespace Nektar
                 m_tmpout = Array<OneD, NekDouble> (brows*block_size, 0.0);
             }
 
-            convertCooToBco(block_size, cooMat, bcoMat);
+            if (storageType == eSmvBSR)
+            {
+                convertCooToBco(block_size, cooMat, bcoMat);
+            }
 
             size_t matBytes = 0;
             switch(storageType)
@@ -118,6 +139,7 @@ namespace Nektar
                             MemoryManager<DNekSmvBsrMat::StorageType>::
                                     AllocateSharedPtr(
                                         brows, bcols, block_size, bcoMat, matStorage );
+                    sparseStorage->SetNumThreads(nThreads);
 
                     // Create sparse matrix
                     m_smvbsrmatrix = MemoryManager<DNekSmvBsrMat>::
@@ -128,6 +150,29 @@ namespace Nektar
                     }
                     break;
 
+                case eSmvSELL:
+                    {
+                    ASSERTL0(matStorage == eFULL,
+                             "SmvSELL storage requires a full matrix");
+
+                    int chunkSize, sortWindow;
+                    pSession->LoadParameter("SellChunkSize",  chunkSize,  8);
+                    pSession->LoadParameter("SellSortWindow", sortWindow, 256);
+                    ASSERTL0(chunkSize > 0 && sortWindow > 0,
+                             "SellChunkSize and SellSortWindow must be "
+                             "positive");
+
+                    // Create zero-based SELL-C-sigma sparse storage
+                    m_smvsellmatrix = MemoryManager<DNekSmvSellMat>::
+                        AllocateSharedPtr(rows, columns, cooMat, chunkSize,
+                                          sortWindow);
+                    m_smvsellmatrix->SetNumThreads(nThreads);
+
+                    matBytes = m_smvsellmatrix->GetMemoryUsage();
+
+                    }
+                    break;
+
                 default:
                     NEKERROR(ErrorUtil::efatal,"Unsupported sparse storage type chosen");
             }
@@ -155,7 +200,11 @@ namespace Nektar
         void GlobalMatrix::Multiply(const Array<OneD,const NekDouble> &in, 
                                           Array<OneD,      NekDouble> &out)
         {
-            if (!m_copyOp)
+            if (m_smvsellmatrix)
+            {
+                m_smvsellmatrix->Multiply(&in[0], &out[0]);
+            }
+            else if (!m_copyOp)
             {
                 if (m_smvbsrmatrix)  m_smvbsrmatrix->Multiply(in,out);
             }
@@ -173,15 +222,44 @@ namespace Nektar
             m_mulCallsCounter++;
         }
 
+        /**
+         * Reads the SparseNumThreads parameter and, if it is greater than
+         * one, starts the session thread manager on which the multiplies of
+         * the sparse matrices are split.
+         */
+        int GlobalMatrix::LoadNumThreads(
+            const LibUtilities::SessionReaderSharedPtr& pSession)
+        {
+            int nThreads = 1;
+            pSession->LoadParameter("SparseNumThreads", nThreads, 1);
+            ASSERTL0(nThreads > 0, "SparseNumThreads must be positive");
+
+            if (nThreads > 1)
+            {
+                Thread::ThreadMaster &tms = Thread::GetThreadMaster();
+                if (!tms.GetInstance(Thread::ThreadMaster::SessionJob)
+                         ->IsInitialised())
+                {
+                    tms.SetThreadingType("ThreadManagerBoost");
+                    tms.CreateInstance(Thread::ThreadMaster::SessionJob,
+                                       nThreads);
+                }
+            }
+
+            return nThreads;
+        }
+
         unsigned long GlobalMatrix::GetMulCallsCounter() const 
         {
             if (m_smvbsrmatrix)  return m_smvbsrmatrix->GetMulCallsCounter();
+            if (m_smvsellmatrix) return m_mulCallsCounter;
             return -1;
         }
 
         unsigned int GlobalMatrix::GetNumNonZeroEntries() const
         {
             if (m_smvbsrmatrix)  return m_smvbsrmatrix->GetNumNonZeroEntries();
+            if (m_smvsellmatrix) return m_smvsellmatrix->GetNumNonZeroEntries();
             return -1;
         }
 
@@ -48,6 +48,8 @@ namespace Nektar
         public:
             typedef NekSparseMatrix<StorageSmvBsr<NekDouble> > DNekSmvBsrMat;
             typedef std::shared_ptr<DNekSmvBsrMat> DNekSmvBsrMatSharedPtr;
+            typedef StorageSmvSell<NekDouble> DNekSmvSellMat;
+            typedef std::shared_ptr<DNekSmvSellMat> DNekSmvSellMatSharedPtr;
 
             /// Construct a new matrix.
             MULTI_REGIONS_EXPORT GlobalMatrix(
@@ -55,7 +57,8 @@ namespace Nektar
                          unsigned int rows,
                          unsigned int columns,
                          const COOMatType &cooMat,
-                         const MatrixStorage& matStorage = eFULL);
+                         const MatrixStorage& matStorage = eFULL,
+                         const int blockSize = 0);
 
             MULTI_REGIONS_EXPORT ~GlobalMatrix() {}
 
@@ -68,9 +71,15 @@ namespace Nektar
             MULTI_REGIONS_EXPORT unsigned long GetMulCallsCounter() const;
             MULTI_REGIONS_EXPORT unsigned int  GetNumNonZeroEntries() const;
 
+            /// Number of threads over which sparse multiplies are split.
+            MULTI_REGIONS_EXPORT static int LoadNumThreads(
+                const LibUtilities::SessionReaderSharedPtr& pSession);
+
         private:
             /// Pointer to a double-precision Nektar++ sparse matrix.
             DNekSmvBsrMatSharedPtr       m_smvbsrmatrix;
+            /// Pointer to a double-precision SELL-C-sigma sparse matrix.
+            DNekSmvSellMatSharedPtr      m_smvsellmatrix;
 
             unsigned int                 m_rows;
             Array<OneD, NekDouble>       m_tmpin;
@@ -146,12 +146,14 @@ namespace Nektar
         // sparse libraries
         enum MatrixStorageType
         {
-            eSmvBSR
+            eSmvBSR,
+            eSmvSELL
         };
 
         const char* const MatrixStorageTypeMap[] =
         {
-            "SmvBSR"
+            "SmvBSR",
+            "SmvSELL"
         };
 
 
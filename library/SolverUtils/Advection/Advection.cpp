@@ -34,6 +34,7 @@
 
 #include <boost/core/ignore_unused.hpp>
 
+#include <LibUtilities/BasicUtils/Timer.h>
 #include <SolverUtils/Advection/Advection.h>
 
 namespace Nektar
@@ -81,6 +82,7 @@ void Advection::Advect(
     const Array<OneD, Array<OneD, NekDouble> >        &pFwd,
     const Array<OneD, Array<OneD, NekDouble> >        &pBwd)
 {
+    LibUtilities::TimerRegion region("Advect");
     v_Advect(nConvectiveFields, pFields, pAdvVel, pInarray,
             pOutarray, pTime, pFwd, pBwd);
 }
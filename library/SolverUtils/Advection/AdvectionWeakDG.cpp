@@ -35,6 +35,7 @@
 #include <boost/core/ignore_unused.hpp>
 
 #include <SolverUtils/Advection/AdvectionWeakDG.h>
+#include <MultiRegions/AssemblyMap/AssemblyMapDG.h>
 #include <iostream>
 #include <iomanip>
 
@@ -109,31 +110,31 @@ namespace Nektar
             ASSERTL1(m_riemann,
                      "Riemann solver must be provided for AdvectionWeakDG.");
 
-            m_fluxVector(inarray, fluxvector);
-
-            // Get the advection part (without numerical flux)
-            for(i = 0; i < nConvectiveFields; ++i)
-            {
-                tmp[i] = Array<OneD, NekDouble>(nCoeffs, 0.0);
-
-                fields[i]->IProductWRTDerivBase(fluxvector[i],tmp[i]);
-            }
-
             // Store forwards/backwards space along trace space
             Array<OneD, Array<OneD, NekDouble> > Fwd    (nConvectiveFields);
             Array<OneD, Array<OneD, NekDouble> > Bwd    (nConvectiveFields);
             Array<OneD, Array<OneD, NekDouble> > numflux(nConvectiveFields);
+            Array<OneD, Array<OneD, NekDouble> > traces;
 
             if (pFwd == NullNekDoubleArrayofArray ||
                 pBwd == NullNekDoubleArrayofArray)
             {
+                // Start the exchange of the trace values of all fields
+                // along partition boundaries, which is completed once the
+                // volume terms have been computed.
+                traces = Array<OneD, Array<OneD, NekDouble> >(
+                    2 * nConvectiveFields);
                 for(i = 0; i < nConvectiveFields; ++i)
                 {
                     Fwd[i]     = Array<OneD, NekDouble>(nTracePointsTot, 0.0);
                     Bwd[i]     = Array<OneD, NekDouble>(nTracePointsTot, 0.0);
                     numflux[i] = Array<OneD, NekDouble>(nTracePointsTot, 0.0);
-                    fields[i]->GetFwdBwdTracePhys(inarray[i], Fwd[i], Bwd[i]);
+                    fields[i]->GetFwdBwdTracePhys(inarray[i], Fwd[i], Bwd[i],
+                                                  false);
+                    traces[i]                     = Fwd[i];
+                    traces[i + nConvectiveFields] = Bwd[i];
                 }
+                fields[0]->GetTraceMap()->UniversalTraceAssembleBegin(traces);
             }
             else
             {
@@ -145,6 +146,21 @@ namespace Nektar
                 }
             }
 
+            m_fluxVector(inarray, fluxvector);
+
+            // Get the advection part (without numerical flux)
+            for(i = 0; i < nConvectiveFields; ++i)
+            {
+                tmp[i] = Array<OneD, NekDouble>(nCoeffs, 0.0);
+
+                fields[i]->IProductWRTDerivBase(fluxvector[i],tmp[i]);
+            }
+
+            if (traces.num_elements())
+            {
+                fields[0]->GetTraceMap()->UniversalTraceAssembleEnd(traces);
+            }
+
             m_riemann->Solve(m_spaceDim, Fwd, Bwd, numflux);
 
             // Evaulate <\phi, \hat{F}\cdot n> - OutField[i]
@@ -32,6 +32,7 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <LibUtilities/BasicUtils/Timer.h>
 #include <SolverUtils/Diffusion/Diffusion.h>
 
 namespace Nektar
@@ -59,6 +60,7 @@ namespace Nektar
             const Array<OneD, Array<OneD, NekDouble> >        &pFwd,
             const Array<OneD, Array<OneD, NekDouble> >        &pBwd)
         {
+            LibUtilities::TimerRegion region("Diffuse");
             v_Diffuse(nConvectiveFields, fields, inarray, outarray, pFwd, pBwd);
         }
     }
@@ -37,6 +37,7 @@
 
 #include <boost/algorithm/string/predicate.hpp>
 
+#include <MultiRegions/AssemblyMap/AssemblyMapDG.h>
 #include <SolverUtils/Diffusion/DiffusionLDG.h>
 
 namespace Nektar
@@ -86,7 +87,6 @@ void DiffusionLDG::v_Diffuse(
     std::size_t nCoeffs   = fields[0]->GetNcoeffs();
     std::size_t nTracePts = fields[0]->GetTrace()->GetTotPoints();
 
-    Array<OneD, NekDouble> tmp{nCoeffs};
     Array<OneD, Array<OneD, Array<OneD, NekDouble>>> flux{nDim};
     Array<OneD, Array<OneD, Array<OneD, NekDouble>>> qfield{nDim};
 
@@ -102,21 +102,61 @@ void DiffusionLDG::v_Diffuse(
         }
     }
 
+    // Extract the trace values of the solution without the parallel
+    // exchange, and start a single exchange for all variables which is
+    // completed once the volume terms have been evaluated.
+    MultiRegions::AssemblyMapDGSharedPtr traceMap = fields[0]->GetTraceMap();
+
+    Array<OneD, Array<OneD, NekDouble>> uFwd{nConvectiveFields};
+    Array<OneD, Array<OneD, NekDouble>> uBwd{nConvectiveFields};
+    Array<OneD, Array<OneD, NekDouble>> traces{2 * nConvectiveFields};
+
+    for (std::size_t i = 0; i < nConvectiveFields; ++i)
+    {
+        uFwd[i] = Array<OneD, NekDouble>{nTracePts, 0.0};
+        uBwd[i] = Array<OneD, NekDouble>{nTracePts, 0.0};
+        fields[i]->GetFwdBwdTracePhys(inarray[i], uFwd[i], uBwd[i], false);
+
+        traces[i]                     = uFwd[i];
+        traces[i + nConvectiveFields] = uBwd[i];
+    }
+    traceMap->UniversalTraceAssembleBegin(traces);
+
+    // Volume contribution to q_{\eta} and q_{\xi}
+    Array<OneD, Array<OneD, Array<OneD, NekDouble>>> qcoeffs{nDim};
+    for (std::size_t j = 0; j < nDim; ++j)
+    {
+        qcoeffs[j] = Array<OneD, Array<OneD, NekDouble>>{nConvectiveFields};
+        for (std::size_t i = 0; i < nConvectiveFields; ++i)
+        {
+            qcoeffs[j][i] = Array<OneD, NekDouble>{nCoeffs};
+            fields[i]->IProductWRTDerivBase(j, inarray[i], qcoeffs[j][i]);
+            Vmath::Neg(nCoeffs, qcoeffs[j][i], 1);
+        }
+    }
+
+    traceMap->UniversalTraceAssembleEnd(traces);
+
     // Compute q_{\eta} and q_{\xi}
     // Obtain numerical fluxes
-
-    NumFluxforScalar(fields, inarray, flux, pFwd, pBwd);
+    if (pFwd == NullNekDoubleArrayofArray ||
+        pBwd == NullNekDoubleArrayofArray)
+    {
+        NumFluxforScalar(fields, inarray, flux, uFwd, uBwd);
+    }
+    else
+    {
+        NumFluxforScalar(fields, inarray, flux, pFwd, pBwd);
+    }
 
     for (std::size_t j = 0; j < nDim; ++j)
     {
         for (std::size_t i = 0; i < nConvectiveFields; ++i)
         {
-            fields[i]->IProductWRTDerivBase(j, inarray[i], tmp);
-            Vmath::Neg(nCoeffs, tmp, 1);
-            fields[i]->AddTraceIntegral(flux[j][i], tmp);
+            fields[i]->AddTraceIntegral(flux[j][i], qcoeffs[j][i]);
             fields[i]->SetPhysState(false);
-            fields[i]->MultiplyByElmtInvMass(tmp, tmp);
-            fields[i]->BwdTrans(tmp, qfield[j][i]);
+            fields[i]->MultiplyByElmtInvMass(qcoeffs[j][i], qcoeffs[j][i]);
+            fields[i]->BwdTrans(qcoeffs[j][i], qfield[j][i]);
         }
     }
 
@@ -133,25 +173,56 @@ void DiffusionLDG::v_Diffuse(
     // Get viscous tensor
     m_fluxVector(inarray, qfield, viscTensor);
 
-    // Compute u from q_{\eta} and q_{\xi}
-    // Obtain numerical fluxes
-    NumFluxforVector(fields, inarray, viscTensor, flux[0]);
+    // Extract the trace values of the viscous tensor and exchange them
+    // while the volume terms are evaluated.
+    Array<OneD, Array<OneD, Array<OneD, NekDouble>>> qFwd{nDim};
+    Array<OneD, Array<OneD, Array<OneD, NekDouble>>> qBwd{nDim};
+    traces = Array<OneD, Array<OneD, NekDouble>>{2 * nDim * nConvectiveFields};
+
+    for (std::size_t j = 0; j < nDim; ++j)
+    {
+        qFwd[j] = Array<OneD, Array<OneD, NekDouble>>{nConvectiveFields};
+        qBwd[j] = Array<OneD, Array<OneD, NekDouble>>{nConvectiveFields};
+        for (std::size_t i = 0; i < nConvectiveFields; ++i)
+        {
+            qFwd[j][i] = Array<OneD, NekDouble>{nTracePts, 0.0};
+            qBwd[j][i] = Array<OneD, NekDouble>{nTracePts, 0.0};
+            fields[i]->GetFwdBwdTracePhys(viscTensor[j][i], qFwd[j][i],
+                                          qBwd[j][i], false);
+
+            std::size_t n = 2 * (j * nConvectiveFields + i);
+            traces[n]     = qFwd[j][i];
+            traces[n + 1] = qBwd[j][i];
+        }
+    }
+    traceMap->UniversalTraceAssembleBegin(traces);
 
     Array<OneD, Array<OneD, NekDouble>> qdbase{nDim};
+    Array<OneD, Array<OneD, NekDouble>> outcoeffs{nConvectiveFields};
     for (std::size_t i = 0; i < nConvectiveFields; ++i)
     {
         for (std::size_t j = 0; j < nDim; ++j)
         {
             qdbase[j] = viscTensor[j][i];
         }
-        fields[i]->IProductWRTDerivBase(qdbase, tmp);
+        outcoeffs[i] = Array<OneD, NekDouble>{nCoeffs};
+        fields[i]->IProductWRTDerivBase(qdbase, outcoeffs[i]);
+        Vmath::Neg(nCoeffs, outcoeffs[i], 1);
+    }
 
+    traceMap->UniversalTraceAssembleEnd(traces);
+
+    // Compute u from q_{\eta} and q_{\xi}
+    // Obtain numerical fluxes
+    NumFluxforVector(fields, uFwd, uBwd, viscTensor, qFwd, qBwd, flux[0]);
+
+    for (std::size_t i = 0; i < nConvectiveFields; ++i)
+    {
         // Evaulate  <\phi, \hat{F}\cdot n> - outarray[i]
-        Vmath::Neg(nCoeffs, tmp, 1);
-        fields[i]->AddTraceIntegral(flux[0][i], tmp);
+        fields[i]->AddTraceIntegral(flux[0][i], outcoeffs[i]);
         fields[i]->SetPhysState(false);
-        fields[i]->MultiplyByElmtInvMass(tmp, tmp);
-        fields[i]->BwdTrans(tmp, outarray[i]);
+        fields[i]->MultiplyByElmtInvMass(outcoeffs[i], outcoeffs[i]);
+        fields[i]->BwdTrans(outcoeffs[i], outarray[i]);
     }
 }
 
@@ -277,23 +348,24 @@ void DiffusionLDG::ApplyScalarBCs(
 }
 
 /**
- * @brief Build the numerical flux for the 2nd order derivatives
+ * @brief Build the numerical flux for the 2nd order derivatives from the
+ * already exchanged trace values \a uFwd, \a uBwd of the solution and
+ * \a qFwd, \a qBwd of the viscous tensor.
  * todo: add variable coeff and h dependence to penalty term
  */
 void DiffusionLDG::NumFluxforVector(
     const Array<OneD, MultiRegions::ExpListSharedPtr> &fields,
-    const Array<OneD, Array<OneD, NekDouble>> &ufield,
-    Array<OneD, Array<OneD, Array<OneD, NekDouble>>> &qfield,
+    const Array<OneD, Array<OneD, NekDouble>> &uFwd,
+    const Array<OneD, Array<OneD, NekDouble>> &uBwd,
+    const Array<OneD, Array<OneD, Array<OneD, NekDouble>>> &qfield,
+    const Array<OneD, Array<OneD, Array<OneD, NekDouble>>> &qFwd,
+    const Array<OneD, Array<OneD, Array<OneD, NekDouble>>> &qBwd,
     Array<OneD, Array<OneD, NekDouble>> &qflux)
 {
     std::size_t nTracePts  = fields[0]->GetTrace()->GetTotPoints();
     std::size_t nvariables = fields.num_elements();
     std::size_t nDim       = qfield.num_elements();
 
-    Array<OneD, NekDouble> Fwd{nTracePts};
-    Array<OneD, NekDouble> Bwd{nTracePts};
-    Array<OneD, NekDouble> qFwd{nTracePts};
-    Array<OneD, NekDouble> qBwd{nTracePts};
     Array<OneD, NekDouble> qfluxtemp{nTracePts, 0.0};
     Array<OneD, NekDouble> uterm{nTracePts};
 
@@ -302,18 +374,14 @@ void DiffusionLDG::NumFluxforVector(
     for (std::size_t i = 0; i < nvariables; ++i)
     {
         // Generate Stability term = - C11 ( u- - u+ )
-        fields[i]->GetFwdBwdTracePhys(ufield[i], Fwd, Bwd);
-        Vmath::Vsub(nTracePts, Fwd, 1, Bwd, 1, uterm, 1);
+        Vmath::Vsub(nTracePts, uFwd[i], 1, uBwd[i], 1, uterm, 1);
         Vmath::Smul(nTracePts, -m_C11, uterm, 1, uterm, 1);
 
         qflux[i] = Array<OneD, NekDouble>{nTracePts, 0.0};
         for (std::size_t j = 0; j < nDim; ++j)
         {
-            //  Compute Fwd and Bwd value of ufield of jth direction
-            fields[i]->GetFwdBwdTracePhys(qfield[j][i], qFwd, qBwd);
-
             // Downwind
-            Vmath::Vcopy(nTracePts, qBwd, 1, qfluxtemp, 1);
+            Vmath::Vcopy(nTracePts, qBwd[j][i], 1, qfluxtemp, 1);
 
             Vmath::Vmul(nTracePts, m_traceNormals[j], 1, qfluxtemp, 1,
                         qfluxtemp, 1);
@@ -324,8 +392,8 @@ void DiffusionLDG::NumFluxforVector(
             // Imposing weak boundary condition with flux
             if (fields[0]->GetBndCondExpansions().num_elements())
             {
-                ApplyVectorBCs(fields, i, j, qfield[j][i], qFwd, qBwd,
-                               qfluxtemp);
+                ApplyVectorBCs(fields, i, j, qfield[j][i], qFwd[j][i],
+                               qBwd[j][i], qfluxtemp);
             }
 
             // q_hat \cdot n = (q_xi \cdot n_xi) or (q_eta \cdot n_eta)
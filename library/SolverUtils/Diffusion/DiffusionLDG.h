@@ -94,8 +94,11 @@ namespace Nektar
 
             void NumFluxforVector(
                 const Array<OneD, MultiRegions::ExpListSharedPtr>       &fields,
-                const Array<OneD, Array<OneD, NekDouble> >              &ufield,
-                      Array<OneD, Array<OneD, Array<OneD, NekDouble> > >&qfield,
+                const Array<OneD, Array<OneD, NekDouble> >              &uFwd,
+                const Array<OneD, Array<OneD, NekDouble> >              &uBwd,
+                const Array<OneD, Array<OneD, Array<OneD, NekDouble> > >&qfield,
+                const Array<OneD, Array<OneD, Array<OneD, NekDouble> > >&qFwd,
+                const Array<OneD, Array<OneD, Array<OneD, NekDouble> > >&qBwd,
                       Array<OneD, Array<OneD, NekDouble> >              &qflux);
 
             void ApplyVectorBCs(
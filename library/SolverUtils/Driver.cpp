@@ -32,6 +32,8 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <LibUtilities/BasicUtils/NekManager.hpp>
+#include <LibUtilities/BasicUtils/Timer.h>
 #include <SolverUtils/Driver.h>
 
 using namespace std;
@@ -91,6 +93,14 @@ void Driver::v_InitObject(ostream &out)
 {
     try
     {
+        // Limit the memory held by each manager pool, given in megabytes.
+        if (m_session->DefinesParameter("ManagerMemoryBudget"))
+        {
+            NekDouble budget = m_session->GetParameter("ManagerMemoryBudget");
+            LibUtilities::NekManagerRegistry::SetMemoryBudget(
+                static_cast<size_t>(budget * 1024.0 * 1024.0));
+        }
+
         // Retrieve the equation system to solve.
         ASSERTL0(m_session->DefinesSolverInfo("EqType"),
                  "EqType SolverInfo tag must be defined.");
@@ -207,5 +217,36 @@ Array<OneD, NekDouble> Driver::v_GetImagEvl(void)
     return NullNekDouble1DArray;
 }
 
+/**
+ * Print the table of timing regions on the root process if the
+ * --timing-regions option is given, and write them to the file given by
+ * --timing-json. Both are reduced across all processes of the session.
+ */
+void Driver::OutputTimingRegions(std::ostream &out)
+{
+    if (m_session->DefinesCmdLineArgument("timing-regions"))
+    {
+        LibUtilities::Timer::PrintElapsedRegions(m_comm, out);
+    }
+
+    if (m_session->DefinesCmdLineArgument("timing-json"))
+    {
+        LibUtilities::Timer::WriteElapsedRegions(
+            m_comm, m_session->GetCmdLineArgument<std::string>("timing-json"));
+    }
+}
+
+/**
+ * Print the number of objects and memory held by each NekManager pool,
+ * summed across all processes, if the --manager-stats option is given.
+ */
+void Driver::OutputManagerStatistics(std::ostream &out)
+{
+    if (m_session->DefinesCmdLineArgument("manager-stats"))
+    {
+        LibUtilities::NekManagerRegistry::PrintStatistics(m_comm, out);
+    }
+}
+
 }
 }
@@ -116,6 +116,13 @@ protected:
     SOLVER_UTILS_EXPORT virtual Array<OneD, NekDouble> v_GetRealEvl(void);
     SOLVER_UTILS_EXPORT virtual Array<OneD, NekDouble> v_GetImagEvl(void);
 
+    /// Report timing regions if requested on the command line.
+    SOLVER_UTILS_EXPORT void OutputTimingRegions(std::ostream &out);
+
+    /// Report the memory held by the matrix managers if requested on the
+    /// command line.
+    SOLVER_UTILS_EXPORT void OutputManagerStatistics(std::ostream &out);
+
 
     static std::string evolutionOperatorLookupIds[];
     static std::string evolutionOperatorDef;
@@ -131,6 +138,8 @@ inline void Driver::InitObject(std::ostream &out)
 inline void Driver::Execute(std::ostream &out)
 {
     v_Execute(out);
+    OutputTimingRegions(out);
+    OutputManagerStatistics(out);
 }
 
 inline Array<OneD, EquationSystemSharedPtr> Driver::GetEqu()
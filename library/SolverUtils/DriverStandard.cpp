@@ -36,6 +36,10 @@
 
 #include <SolverUtils/DriverStandard.h>
 
+#ifdef NEKTAR_MEMORY_POOL_ENABLED
+#include <LibUtilities/Memory/ThreadSpecificPool.hpp>
+#endif
+
 using namespace std;
 
 namespace Nektar
@@ -96,6 +100,15 @@ namespace Nektar
                 cout << "-------------------------------------------" << endl;
                 cout << "Total Computation Time = " << CPUtime << "s" << endl;
                 cout << "-------------------------------------------" << endl;
+
+#ifdef NEKTAR_MEMORY_POOL_ENABLED
+                if (m_session->DefinesCmdLineArgument("verbose"))
+                {
+                    GetMemoryPool().PrintStatistics(cout);
+                    cout << "-------------------------------------------"
+                         << endl;
+                }
+#endif
             }
 
             // Evaluate and output computation time and solution accuracy.
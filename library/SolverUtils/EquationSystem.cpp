@@ -660,6 +660,8 @@ namespace Nektar
             m_session->LoadParameter("FinTime",       m_fintime,    0);
             m_session->LoadParameter("NumQuadPointsError",
                                      m_NumQuadPointsError, 0);
+            m_session->MatchSolverInfo("AsyncCheckpoint", "True",
+                                       m_asyncCheckpoint, false);
 
             // Check uniqueness of checkpoint output
             ASSERTL0((m_checktime == 0.0 && m_checksteps == 0) ||
@@ -1052,6 +1054,7 @@ namespace Nektar
         void EquationSystem::v_Output(void)
         {
             WriteFld(m_sessionName + ".fld");
+            m_fld->WaitForWrite();
         }
                 
         /**
@@ -1209,7 +1212,18 @@ namespace Nektar
             bool backup = true;
 #endif
 
-            m_fld->Write(outname, FieldDef, FieldData, fieldMetaDataMap, backup);
+            // With AsyncCheckpoint, FieldData is handed over to a background
+            // write and the time-stepping continues while it completes.
+            if (m_asyncCheckpoint)
+            {
+                m_fld->WriteAsync(outname, FieldDef, FieldData,
+                                  fieldMetaDataMap, backup);
+            }
+            else
+            {
+                m_fld->Write(outname, FieldDef, FieldData, fieldMetaDataMap,
+                             backup);
+            }
         }
 
 
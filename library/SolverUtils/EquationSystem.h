@@ -363,6 +363,8 @@ class Interpolator;
             int                                         m_steps;
             /// Number of steps between checkpoints.
             int                                         m_checksteps;
+            /// Write field files in the background.
+            bool                                        m_asyncCheckpoint;
             /// Spatial dimension (>= expansion dim).
             int                                         m_spacedim;
             /// Expansion dimension.
@@ -69,6 +69,8 @@ FilterCheckpoint::FilterCheckpoint(
     m_outputFrequency = round(equ.Evaluate());
 
     m_fld = LibUtilities::FieldIO::CreateDefault(pSession);
+
+    m_session->MatchSolverInfo("AsyncCheckpoint", "True", m_async, false);
 }
 
 FilterCheckpoint::~FilterCheckpoint()
@@ -115,7 +117,14 @@ void FilterCheckpoint::v_Update(
                                         pFields[j]->UpdateCoeffs());
         }
     }
-    m_fld->Write(vOutputFilename.str(),FieldDef,FieldData);
+    if (m_async)
+    {
+        m_fld->WriteAsync(vOutputFilename.str(), FieldDef, FieldData);
+    }
+    else
+    {
+        m_fld->Write(vOutputFilename.str(),FieldDef,FieldData);
+    }
     m_outputIndex++;
 }
 
@@ -124,6 +133,8 @@ void FilterCheckpoint::v_Finalise(
         const NekDouble &time)
 {
     boost::ignore_unused(pFields, time);
+
+    m_fld->WaitForWrite();
 }
 
 bool FilterCheckpoint::v_IsTimeDependent()
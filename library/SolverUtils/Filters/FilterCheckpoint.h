@@ -84,6 +84,7 @@ private:
     unsigned int m_outputFrequency;
     std::string m_outputFile;
     LibUtilities::FieldIOSharedPtr m_fld;
+    bool m_async;
 };
 }
 }
@@ -216,39 +216,47 @@ void FilterHistoryPoints::v_Initialise(
     Array<OneD, int>       idList  (vHP, -1   );
     Array<OneD, NekDouble> dist    (vHP,  1e16);
     Array<OneD, NekDouble> dist_loc(vHP,  1e16);
-    std::vector<Array<OneD, NekDouble> > LocCoords;
+    Array<OneD, Array<OneD, NekDouble> > LocCoords;
+
+    // Determine the expansion and local coordinates of all history
+    // points at once.
+    Array<OneD, Array<OneD, NekDouble> > pts(3);
+    for (int j = 0; j < 3; ++j)
+    {
+        pts[j] = Array<OneD, NekDouble>(vHP);
+    }
+    for (i = 0; i < vHP; ++i)
+    {
+        m_historyPoints[i]->GetCoords(pts[0][i], pts[1][i], pts[2][i]);
+    }
+
+    if (m_isHomogeneous1D)
+    {
+        pFields[0]->GetPlane(0)->GetExpIndices(pts, idList, LocCoords,
+                                        NekConstants::kGeomFactorsTol);
+    }
+    else
+    {
+        pFields[0]->GetExpIndices(pts, idList, LocCoords,
+                                        NekConstants::kGeomFactorsTol);
+    }
 
     // Find the nearest element on this process to which the history
     // point could belong and note down the distance from the element
     // and the process ID.
     for (i = 0; i < vHP; ++i)
     {
-        Array<OneD, NekDouble> locCoords(pFields[0]->GetShapeDimension());
+        Array<OneD, NekDouble> locCoords = LocCoords[i];
         m_historyPoints[i]->GetCoords(  gloCoord[0],
                                         gloCoord[1],
                                         gloCoord[2]);
 
-        // Determine the expansion and local coordinates
-        if (m_isHomogeneous1D)
-        {
-            idList[i] = pFields[0]->GetPlane(0)->GetExpIndex(gloCoord,locCoords,
-                                        NekConstants::kGeomFactorsTol);
-        }
-        else
-        {
-            idList[i] = pFields[0]->GetExpIndex(gloCoord,locCoords,
-                                        NekConstants::kGeomFactorsTol);
-        }
-
-        for(int j = 0; j < 3; ++j)
+        for(int j = 0; j < locCoords.num_elements(); ++j)
         {
             locCoords[j] = std::max(locCoords[j], -1.0);
             locCoords[j] = std::min(locCoords[j], 1.0);
         }
 
-        // Save Local coordinates for later
-        LocCoords.push_back(locCoords);
-
         // For those points for which a potential nearby element exists
         // compute the perp. distance from the point to the element and
         // store in the distances array.
@@ -33,6 +33,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <FieldUtils/Interpolator.h>
+#include <LibUtilities/BasicUtils/Timer.h>
 #include <SolverUtils/Forcing/Forcing.h>
 
 using namespace std;
@@ -75,6 +76,7 @@ namespace Nektar
                 Array<OneD, Array<OneD, NekDouble> >&              outarray,
                 const NekDouble&                                   time)
         {
+            LibUtilities::TimerRegion region("Forcing");
             v_Apply(fields, inarray, outarray, time);
         }
 
@@ -57,6 +57,49 @@ namespace Nektar
 {
     namespace SolverUtils
     {
+        /**
+         * Applies the interleaved rotation matrices @a mat to @a nVec vectors
+         * of @a DIM components, or their transposes if @a transpose is set.
+         */
+        template<int DIM>
+        static void RotateVectors(
+            const int               nq,
+            const int               nVec,
+            const bool              transpose,
+            const NekDouble        *mat,
+            const NekDouble *const *in,
+                  NekDouble *const *out)
+        {
+            // Stride between entries of a row (or column if transposed).
+            const int rs = transpose ? DIM : 1;
+            const int cs = transpose ? 1 : DIM;
+
+            for (int i = 0; i < nq; ++i, mat += DIM * DIM)
+            {
+                for (int v = 0; v < nVec; ++v)
+                {
+                    const NekDouble *const *vin  = in  + v * DIM;
+                          NekDouble *const *vout = out + v * DIM;
+
+                    NekDouble x[DIM];
+                    for (int k = 0; k < DIM; ++k)
+                    {
+                        x[k] = vin[k][i];
+                    }
+
+                    for (int j = 0; j < DIM; ++j)
+                    {
+                        NekDouble tmp = x[0] * mat[j * cs];
+                        for (int k = 1; k < DIM; ++k)
+                        {
+                            tmp += x[k] * mat[j * cs + k * rs];
+                        }
+                        vout[j][i] = tmp;
+                    }
+                }
+            }
+        }
+
         /**
          * Retrieves the singleton instance of the Riemann solver factory.
          */
@@ -113,26 +156,84 @@ namespace Nektar
 
                 int nFields = Fwd   .num_elements();
                 int nPts    = Fwd[0].num_elements();
-                
-                if (m_rotStorage[0].num_elements()    != nFields ||
-                    m_rotStorage[0][0].num_elements() != nPts)
+                int nNorm   = normals.num_elements();
+                int nVec    = vecLocs.num_elements();
+
+                CheckRotationMatrices(normals);
+
+                // Only the vector components need separate storage; the
+                // remaining fields are aliased below.
+                int vx = nVec > 0 ? (int)vecLocs[0][0] : 0;
+                if (m_rotStorage[0].num_elements()     != nFields ||
+                    m_rotStorage[0][vx].num_elements() != nPts)
                 {
                     for (int i = 0; i < 3; ++i)
                     {
                         m_rotStorage[i] =
                             Array<OneD, Array<OneD, NekDouble> >(nFields);
-                        for (int j = 0; j < nFields; ++j)
+                        for (int j = 0; j < nVec; ++j)
                         {
-                            m_rotStorage[i][j] = Array<OneD, NekDouble>(nPts);
+                            for (int k = 0; k < nNorm; ++k)
+                            {
+                                m_rotStorage[i][(int)vecLocs[j][k]] =
+                                    Array<OneD, NekDouble>(nPts);
+                            }
                         }
                     }
                 }
 
-                rotateToNormal  (Fwd, normals, vecLocs, m_rotStorage[0]);
-                rotateToNormal  (Bwd, normals, vecLocs, m_rotStorage[1]);
-                v_Solve         (nDim, m_rotStorage[0], m_rotStorage[1],
-                                       m_rotStorage[2]);
-                rotateFromNormal(m_rotStorage[2], normals, vecLocs, flux);
+                // Scalar fields are unaffected by the rotation, so pass the
+                // caller's arrays straight through to v_Solve.
+                std::vector<bool> isVec(nFields, false);
+                for (int j = 0; j < nVec; ++j)
+                {
+                    for (int k = 0; k < nNorm; ++k)
+                    {
+                        isVec[(int)vecLocs[j][k]] = true;
+                    }
+                }
+                for (int j = 0; j < nFields; ++j)
+                {
+                    if (!isVec[j])
+                    {
+                        m_rotStorage[0][j] = Fwd [j];
+                        m_rotStorage[1][j] = Bwd [j];
+                        m_rotStorage[2][j] = flux[j];
+                    }
+                }
+
+                // Rotate the Fwd and Bwd vectors together in a single pass
+                // over the trace points, then rotate the flux back.
+                std::vector<const NekDouble *> in (2 * nVec * nNorm);
+                std::vector<NekDouble *>       out(2 * nVec * nNorm);
+                for (int j = 0; j < nVec; ++j)
+                {
+                    for (int k = 0; k < nNorm; ++k)
+                    {
+                        int f = (int)vecLocs[j][k];
+                        int l = j * nNorm + k;
+                        int m = (nVec + j) * nNorm + k;
+                        in [l] = Fwd[f].get();
+                        out[l] = m_rotStorage[0][f].get();
+                        in [m] = Bwd[f].get();
+                        out[m] = m_rotStorage[1][f].get();
+                    }
+                }
+                ApplyRotation(nNorm, nPts, 2 * nVec, false, &in[0], &out[0]);
+
+                v_Solve(nDim, m_rotStorage[0], m_rotStorage[1],
+                              m_rotStorage[2]);
+
+                for (int j = 0; j < nVec; ++j)
+                {
+                    for (int k = 0; k < nNorm; ++k)
+                    {
+                        int f = (int)vecLocs[j][k];
+                        in [j * nNorm + k] = m_rotStorage[2][f].get();
+                        out[j * nNorm + k] = flux[f].get();
+                    }
+                }
+                ApplyRotation(nNorm, nPts, nVec, true, &in[0], &out[0]);
             }
             else
             {
@@ -165,81 +266,36 @@ namespace Nektar
             const Array<OneD, const Array<OneD, NekDouble> > &vecLocs,
                   Array<OneD,       Array<OneD, NekDouble> > &outarray)
         {
+            const int nq    = inarray[0].num_elements();
+            const int nNorm = normals.num_elements();
+            const int nVec  = vecLocs.num_elements();
+
             for (int i = 0; i < inarray.num_elements(); ++i)
             {
                 Vmath::Vcopy(inarray[i].num_elements(), inarray[i], 1,
                              outarray[i], 1);
             }
 
-            for (int i = 0; i < vecLocs.num_elements(); i++)
+            CheckRotationMatrices(normals);
+
+            std::vector<const NekDouble *> in (nVec * nNorm);
+            std::vector<NekDouble *>       out(nVec * nNorm);
+            for (int i = 0; i < nVec; i++)
             {
-                ASSERTL1(vecLocs[i].num_elements() == normals.num_elements(),
+                ASSERTL1(vecLocs[i].num_elements() == nNorm,
                          "vecLocs[i] element count mismatch");
 
-                switch (normals.num_elements())
+                for (int j = 0; j < nNorm; ++j)
                 {
-                    case 1:
-                    {    // do nothing
-                        const int nq = inarray[0].num_elements();
-                        const int vx = (int)vecLocs[i][0];
-                        Vmath::Vmul (nq, inarray [vx], 1, normals [0],  1,
-                                         outarray[vx], 1);
-                        break;
-                    }
-                    case 2:
-                    {
-                        const int nq = inarray[0].num_elements();
-                        const int vx = (int)vecLocs[i][0];
-                        const int vy = (int)vecLocs[i][1];
-
-                        Vmath::Vmul (nq, inarray [vx], 1, normals [0],  1,
-                                         outarray[vx], 1);
-                        Vmath::Vvtvp(nq, inarray [vy], 1, normals [1],  1,
-                                         outarray[vx], 1, outarray[vx], 1);
-                        Vmath::Vmul (nq, inarray [vx], 1, normals [1],  1,
-                                         outarray[vy], 1);
-                        Vmath::Vvtvm(nq, inarray [vy], 1, normals [0],  1,
-                                         outarray[vy], 1, outarray[vy], 1);
-                        break;
-                    }
-
-                    case 3:
-                    {
-                        const int nq = inarray[0].num_elements();
-                        const int vx = (int)vecLocs[i][0];
-                        const int vy = (int)vecLocs[i][1];
-                        const int vz = (int)vecLocs[i][2];
-
-                        // Generate matrices if they don't already exist.
-                        if (m_rotMat.num_elements() == 0)
-                        {
-                            GenerateRotationMatrices(normals);
-                        }
-
-                        // Apply rotation matrices.
-                        Vmath::Vvtvvtp(nq, inarray [vx], 1, m_rotMat[0],  1,
-                                           inarray [vy], 1, m_rotMat[1],  1,
-                                           outarray[vx], 1);
-                        Vmath::Vvtvp  (nq, inarray [vz], 1, m_rotMat[2],  1,
-                                           outarray[vx], 1, outarray[vx], 1);
-                        Vmath::Vvtvvtp(nq, inarray [vx], 1, m_rotMat[3],  1,
-                                           inarray [vy], 1, m_rotMat[4],  1,
-                                           outarray[vy], 1);
-                        Vmath::Vvtvp  (nq, inarray [vz], 1, m_rotMat[5],  1,
-                                           outarray[vy], 1, outarray[vy], 1);
-                        Vmath::Vvtvvtp(nq, inarray [vx], 1, m_rotMat[6],  1,
-                                           inarray [vy], 1, m_rotMat[7],  1,
-                                           outarray[vz], 1);
-                        Vmath::Vvtvp  (nq, inarray [vz], 1, m_rotMat[8],  1,
-                                           outarray[vz], 1, outarray[vz], 1);
-                        break;
-                    }
-
-                    default:
-                        ASSERTL1(false, "Invalid space dimension.");
-                        break;
+                    in [i * nNorm + j] = inarray [(int)vecLocs[i][j]].get();
+                    out[i * nNorm + j] = outarray[(int)vecLocs[i][j]].get();
                 }
             }
+
+            if (nVec > 0)
+            {
+                ApplyRotation(nNorm, nq, nVec, false, &in[0], &out[0]);
+            }
         }
         
         /**
@@ -256,74 +312,36 @@ namespace Nektar
             const Array<OneD, const Array<OneD, NekDouble> > &vecLocs,
                   Array<OneD,       Array<OneD, NekDouble> > &outarray)
         {
+            const int nq    = normals[0].num_elements();
+            const int nNorm = normals.num_elements();
+            const int nVec  = vecLocs.num_elements();
+
             for (int i = 0; i < inarray.num_elements(); ++i)
             {
                 Vmath::Vcopy(inarray[i].num_elements(), inarray[i], 1,
                              outarray[i], 1);
             }
 
-            for (int i = 0; i < vecLocs.num_elements(); i++)
+            CheckRotationMatrices(normals);
+
+            std::vector<const NekDouble *> in (nVec * nNorm);
+            std::vector<NekDouble *>       out(nVec * nNorm);
+            for (int i = 0; i < nVec; i++)
             {
-                ASSERTL1(vecLocs[i].num_elements() == normals.num_elements(),
+                ASSERTL1(vecLocs[i].num_elements() == nNorm,
                          "vecLocs[i] element count mismatch");
 
-                switch (normals.num_elements())
+                for (int j = 0; j < nNorm; ++j)
                 {
-                    case 1:
-                    {    // do nothing
-                        const int nq = normals[0].num_elements();
-                        const int vx = (int)vecLocs[i][0];
-                        Vmath::Vmul (nq, inarray [vx], 1, normals [0],  1,
-                                         outarray[vx], 1);
-                        break;
-                    }
-                    case 2:
-                    {
-                        const int nq = normals[0].num_elements();
-                        const int vx = (int)vecLocs[i][0];
-                        const int vy = (int)vecLocs[i][1];
-
-                        Vmath::Vmul (nq, inarray [vy], 1, normals [1],  1,
-                                         outarray[vx], 1);
-                        Vmath::Vvtvm(nq, inarray [vx], 1, normals [0],  1,
-                                         outarray[vx], 1, outarray[vx], 1);
-                        Vmath::Vmul (nq, inarray [vx], 1, normals [1],  1,
-                                         outarray[vy], 1);
-                        Vmath::Vvtvp(nq, inarray [vy], 1, normals [0],  1,
-                                         outarray[vy], 1, outarray[vy], 1);
-                        break;
-                    }
-
-                    case 3:
-                    {
-                        const int nq = normals[0].num_elements();
-                        const int vx = (int)vecLocs[i][0];
-                        const int vy = (int)vecLocs[i][1];
-                        const int vz = (int)vecLocs[i][2];
-
-                        Vmath::Vvtvvtp(nq, inarray [vx], 1, m_rotMat[0],  1,
-                                           inarray [vy], 1, m_rotMat[3],  1,
-                                           outarray[vx], 1);
-                        Vmath::Vvtvp  (nq, inarray [vz], 1, m_rotMat[6],  1,
-                                           outarray[vx], 1, outarray[vx], 1);
-                        Vmath::Vvtvvtp(nq, inarray [vx], 1, m_rotMat[1],  1,
-                                           inarray [vy], 1, m_rotMat[4],  1,
-                                           outarray[vy], 1);
-                        Vmath::Vvtvp  (nq, inarray [vz], 1, m_rotMat[7],  1,
-                                           outarray[vy], 1, outarray[vy], 1);
-                        Vmath::Vvtvvtp(nq, inarray [vx], 1, m_rotMat[2],  1,
-                                           inarray [vy], 1, m_rotMat[5],  1,
-                                           outarray[vz], 1);
-                        Vmath::Vvtvp  (nq, inarray [vz], 1, m_rotMat[8],  1,
-                                           outarray[vz], 1, outarray[vz], 1);
-                        break;
-                    }
-
-                    default:
-                        ASSERTL1(false, "Invalid space dimension.");
-                        break;
+                    in [i * nNorm + j] = inarray [(int)vecLocs[i][j]].get();
+                    out[i * nNorm + j] = outarray[(int)vecLocs[i][j]].get();
                 }
             }
+
+            if (nVec > 0)
+            {
+                ApplyRotation(nNorm, nq, nVec, true, &in[0], &out[0]);
+            }
         }
 
         /**
@@ -377,38 +395,122 @@ namespace Nektar
         }
 
         /**
-         * @brief Generate rotation matrices for 3D expansions.
+         * @brief Generate the rotation matrices for each trace point.
+         *
+         * The matrices are stored interleaved in #m_rotMat as one row-major
+         * nDim x nDim block per point, so that all of the vector components
+         * at a point can be rotated from a single contiguous block. In 1D the
+         * matrix is the normal component, in 2D it is
+         *
+         * \f[ \begin{pmatrix} n_x & n_y \\ -n_y & n_x \end{pmatrix} \f]
+         *
+         * and in 3D it is the (non-unique) rotation from the trace normal to
+         * the x-axis given by RiemannSolver::FromToRotation.
          */
         void RiemannSolver::GenerateRotationMatrices(
             const Array<OneD, const Array<OneD, NekDouble> > &normals)
         {
             Array<OneD, NekDouble> xdir(3,0.0);
             Array<OneD, NekDouble> tn  (3);
-            NekDouble tmp[9];
-            const int nq = normals[0].num_elements();
-            int i, j;
+            const int nDim = normals.num_elements();
+            const int nq   = normals[0].num_elements();
+            int i;
             xdir[0] = 1.0;
 
             // Allocate storage for rotation matrices.
-            m_rotMat = Array<OneD, Array<OneD, NekDouble> >(9);
-            
-            for (i = 0; i < 9; ++i)
-            {
-                m_rotMat[i] = Array<OneD, NekDouble>(nq);
-            }
-            for (i = 0; i < normals[0].num_elements(); ++i)
+            m_rotMat     = Array<OneD, NekDouble>(nDim * nDim * nq);
+            m_rotNormals = normals;
+
+            switch (nDim)
             {
-                // Generate matrix which takes us from (1,0,0) vector to trace
-                // normal.
-                tn[0] = normals[0][i];
-                tn[1] = normals[1][i];
-                tn[2] = normals[2][i];
-                FromToRotation(tn, xdir, tmp);
-                
-                for (j = 0; j < 9; ++j)
+                case 1:
                 {
-                    m_rotMat[j][i] = tmp[j];
+                    Vmath::Vcopy(nq, normals[0], 1, m_rotMat, 1);
+                    break;
                 }
+                case 2:
+                {
+                    for (i = 0; i < nq; ++i)
+                    {
+                        m_rotMat[4*i  ] =  normals[0][i];
+                        m_rotMat[4*i+1] =  normals[1][i];
+                        m_rotMat[4*i+2] = -normals[1][i];
+                        m_rotMat[4*i+3] =  normals[0][i];
+                    }
+                    break;
+                }
+                case 3:
+                {
+                    for (i = 0; i < nq; ++i)
+                    {
+                        // Generate matrix which takes us from (1,0,0) vector
+                        // to trace normal.
+                        tn[0] = normals[0][i];
+                        tn[1] = normals[1][i];
+                        tn[2] = normals[2][i];
+                        FromToRotation(tn, xdir, &m_rotMat[9*i]);
+                    }
+                    break;
+                }
+                default:
+                    ASSERTL1(false, "Invalid space dimension.");
+                    break;
+            }
+        }
+
+        /**
+         * @brief Regenerate the rotation matrices if @a normals is not the
+         * set of normals they were built from.
+         *
+         * The normals of a static mesh do not change, so the matrices are
+         * computed on the first solve and reused. Normals are compared by
+         * storage rather than value, so code which updates the normals in
+         * place must reset #m_rotNormals.
+         */
+        void RiemannSolver::CheckRotationMatrices(
+            const Array<OneD, const Array<OneD, NekDouble> > &normals)
+        {
+            if (m_rotNormals.num_elements()    != normals.num_elements()    ||
+                m_rotNormals[0].num_elements() != normals[0].num_elements() ||
+                m_rotNormals[0].get()          != normals[0].get())
+            {
+                GenerateRotationMatrices(normals);
+            }
+        }
+
+        /**
+         * @brief Rotate @a nVec vectors by the matrices in #m_rotMat.
+         *
+         * Each vector is given by @a nDim consecutive component pointers in
+         * @a in and @a out. All vectors are rotated in a single pass over the
+         * trace points. If @a transpose is set the inverse rotation is
+         * applied. @a in and @a out may coincide.
+         */
+        void RiemannSolver::ApplyRotation(
+            const int               nDim,
+            const int               nq,
+            const int               nVec,
+            const bool              transpose,
+            const NekDouble *const *in,
+                  NekDouble *const *out)
+        {
+            switch (nDim)
+            {
+                case 1:
+                    RotateVectors<1>(nq, nVec, transpose, &m_rotMat[0],
+                                     in, out);
+                    break;
+                case 2:
+                    RotateVectors<2>(nq, nVec, transpose, &m_rotMat[0],
+                                     in, out);
+                    break;
+                case 3:
+                    RotateVectors<3>(nq, nVec, transpose, &m_rotMat[0],
+                                     in, out);
+                    break;
+                default:
+                    ASSERTL1(false, "Invalid space dimension.");
+                    break;
             }
         }
 
@@ -151,8 +151,11 @@ namespace Nektar
             std::map<std::string, RSScalarFuncType> m_auxScal;
             /// Map of auxiliary vector function types.
             std::map<std::string, RSVecFuncType>    m_auxVec;
-            /// Rotation matrices for each trace quadrature point.
-            Array<OneD, Array<OneD, NekDouble> >    m_rotMat;
+            /// Rotation matrices for each trace quadrature point, stored
+            /// interleaved as one row-major nDim x nDim block per point.
+            Array<OneD, NekDouble>                  m_rotMat;
+            /// Normals from which #m_rotMat was generated.
+            Array<OneD, const Array<OneD, NekDouble> > m_rotNormals;
             /// Rotation storage
             Array<OneD, Array<OneD, Array<OneD, NekDouble> > > m_rotStorage;
 
@@ -170,6 +173,15 @@ namespace Nektar
 
             void GenerateRotationMatrices(
                 const Array<OneD, const Array<OneD, NekDouble> > &normals);
+            void CheckRotationMatrices(
+                const Array<OneD, const Array<OneD, NekDouble> > &normals);
+            void ApplyRotation(
+                const int               nDim,
+                const int               nq,
+                const int               nVec,
+                const bool              transpose,
+                const NekDouble *const *in,
+                      NekDouble *const *out);
             void FromToRotation(
                 Array<OneD, const NekDouble> &from,
                 Array<OneD, const NekDouble> &to,
@@ -40,6 +40,7 @@ using namespace std;
 #include <boost/format.hpp>
 
 #include <LibUtilities/TimeIntegration/TimeIntegrationWrapper.h>
+#include <LibUtilities/BasicUtils/NekManager.hpp>
 #include <LibUtilities/BasicUtils/Timer.h>
 #include <MultiRegions/AssemblyMap/AssemblyMapDG.h>
 #include <SolverUtils/UnsteadySystem.h>
@@ -139,6 +140,9 @@ namespace Nektar
             // By default attempt to forward transform initial condition.
             m_homoInitialFwd = true;
 
+            m_session->MatchSolverInfo("ReadOnlyManagers", "True",
+                                       m_readOnlyManagers, false);
+
             // Set up filters
             for (auto &x : m_session->GetFilters())
             {
@@ -203,6 +207,8 @@ namespace Nektar
         {
             ASSERTL0(m_intScheme != 0, "No time integration scheme.");
 
+            LibUtilities::TimerRegion solveRegion("DoSolve");
+
             int i = 1;
             int nvariables = 0;
             int nfields = m_fields.num_elements();
@@ -295,13 +301,21 @@ namespace Nektar
         
                 // Perform any solver-specific pre-integration steps
                 timer.Start();
-                if (v_PreIntegrate(step))
+                bool stop;
+                {
+                    LibUtilities::TimerRegion region("PreIntegrate");
+                    stop = v_PreIntegrate(step);
+                }
+                if (stop)
                 {
                     break;
                 }
 
-                fields = m_intScheme->TimeIntegrate(
-                    stepCounter, m_timestep, m_intSoln, m_ode);
+                {
+                    LibUtilities::TimerRegion region("TimeIntegrate");
+                    fields = m_intScheme->TimeIntegrate(
+                        stepCounter, m_timestep, m_intSoln, m_ode);
+                }
                 timer.Stop();
 
                 m_time  += m_timestep;
@@ -347,7 +361,11 @@ namespace Nektar
                 }
 
                 // Perform any solver-specific post-integration steps
-                if (v_PostIntegrate(step))
+                {
+                    LibUtilities::TimerRegion region("PostIntegrate");
+                    stop = v_PostIntegrate(step);
+                }
+                if (stop)
                 {
                     break;
                 }
@@ -401,7 +419,10 @@ namespace Nektar
                 for (auto &x : m_filters)
                 {
                     timer.Start();
-                    x.second->Update(m_fields, m_time);
+                    {
+                        LibUtilities::TimerRegion region("Filter " + x.first);
+                        x.second->Update(m_fields, m_time);
+                    }
                     timer.Stop();
                     elapsed = timer.TimePerTest(1);
                     totFilterTime += elapsed;
@@ -439,6 +460,8 @@ namespace Nektar
                 if ((m_checksteps && !((step + 1) % m_checksteps)) ||
                      doCheckTime)
                 {
+                    LibUtilities::TimerRegion region("Checkpoint");
+
                     if(m_HomogeneousType != eNotHomogeneous)
                     {
                         vector<bool> transformed(nfields, false);
@@ -478,7 +501,26 @@ namespace Nektar
                 // Step advance
                 ++step;
                 ++stepCounter;
+
+                // Multi-step schemes start with lower-order schemes, whose
+                // coefficients (and so matrices, such as the Helmholtz
+                // matrices) differ. Once the first step of the final scheme
+                // has been taken, the managers are only read and need not
+                // be locked.
+                if (m_readOnlyManagers && stepCounter ==
+                        m_intScheme->GetIntegrationSteps())
+                {
+                    LibUtilities::NekManagerRegistry::SetReadOnly(true);
+                }
             }
+
+            if (m_readOnlyManagers)
+            {
+                LibUtilities::NekManagerRegistry::SetReadOnly(false);
+            }
+
+            // Complete any checkpoint still being written in the background
+            m_fld->WaitForWrite();
         
             // Print out summary statistics
             if (m_session->GetComm()->GetRank() == 0)
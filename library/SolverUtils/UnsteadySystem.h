@@ -99,6 +99,10 @@ protected:
     /// Number of time steps between outputting status information.
     NekDouble m_filterTimeWarning;
 
+    /// Switch the matrix managers to read-only once the start-up steps of
+    /// the time integration scheme have been taken.
+    bool m_readOnlyManagers;
+
     /// Initialises UnsteadySystem class members.
     SOLVER_UTILS_EXPORT UnsteadySystem(
         const LibUtilities::SessionReaderSharedPtr &pSession,
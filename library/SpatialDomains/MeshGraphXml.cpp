@@ -58,6 +58,29 @@ std::string MeshGraphXml::className =
     GetMeshGraphFactory().RegisterCreatorFunction(
         "Xml", MeshGraphXml::create, "IO with Xml geometry");
 
+/**
+ * Default partitioner to use is Metis. Use Scotch as default if it is
+ * installed. Override default with command-line flags if they are set.
+ */
+static string GetPartitionerName(
+    const LibUtilities::SessionReaderSharedPtr &session)
+{
+    string partitionerName = "Metis";
+    if (GetMeshPartitionFactory().ModuleExists("Scotch"))
+    {
+        partitionerName = "Scotch";
+    }
+    if (session->DefinesCmdLineArgument("use-metis"))
+    {
+        partitionerName = "Metis";
+    }
+    if (session->DefinesCmdLineArgument("use-scotch"))
+    {
+        partitionerName = "Scotch";
+    }
+    return partitionerName;
+}
+
 void MeshGraphXml::PartitionMesh(
     const LibUtilities::SessionReaderSharedPtr session)
 {
@@ -101,21 +124,7 @@ void MeshGraphXml::PartitionMesh(
     }
     else
     {
-        // Default partitioner to use is Metis. Use Scotch as default if it is
-        // installed. Override default with command-line flags if they are set.
-        string partitionerName = "Metis";
-        if (GetMeshPartitionFactory().ModuleExists("Scotch"))
-        {
-            partitionerName = "Scotch";
-        }
-        if (session->DefinesCmdLineArgument("use-metis"))
-        {
-            partitionerName = "Metis";
-        }
-        if (session->DefinesCmdLineArgument("use-scotch"))
-        {
-            partitionerName = "Scotch";
-        }
+        string partitionerName = GetPartitionerName(session);
 
         // Mesh has not been partitioned so do partitioning if required.  Note
         // in the serial case nothing is done as we have already loaded the
@@ -128,46 +137,17 @@ void MeshGraphXml::PartitionMesh(
             ASSERTL0(comm->GetSize() == 1,
                      "The 'part-only' option should be used in serial.");
 
-            // Read 'lite' geometry information
-            ReadGeometry(NullDomainRangeShPtr, false);
-
-            // Number of partitions is specified by the parameter.
-            int nParts;
-            auto comp = CreateCompositeDescriptor();
-
-            MeshPartitionSharedPtr partitioner =
-                GetMeshPartitionFactory().CreateInstance(
-                    partitionerName, session, m_meshDimension,
-                    CreateMeshEntities(), comp);
-
             if (session->DefinesCmdLineArgument("part-only"))
             {
-                nParts = session->GetCmdLineArgument<int>("part-only");
-                partitioner->PartitionMesh(nParts, true);
+                WritePartitions(
+                    session, session->GetCmdLineArgument<int>("part-only"));
             }
             else
             {
-                nParts = session->GetCmdLineArgument<int>("part-only-overlapping");
-                partitioner->PartitionMesh(nParts, true, true);
-            }
-
-            vector<set<unsigned int>> elmtIDs;
-            vector<unsigned int> parts(nParts);
-            for (int i = 0; i < nParts; ++i)
-            {
-                vector<unsigned int> elIDs;
-                set<unsigned int> tmp;
-                partitioner->GetElementIDs(i, elIDs);
-                tmp.insert(elIDs.begin(), elIDs.end());
-                elmtIDs.push_back(tmp);
-                parts[i] = i;
-            }
-
-            this->WriteXMLGeometry(m_session->GetSessionName(), elmtIDs, parts);
-
-            if (isRoot && session->DefinesCmdLineArgument("part-info"))
-            {
-                partitioner->PrintPartInfo(std::cout);
+                WritePartitions(
+                    session,
+                    session->GetCmdLineArgument<int>("part-only-overlapping"),
+                    true);
             }
 
             session->Finalise();
@@ -359,6 +339,52 @@ void MeshGraphXml::PartitionMesh(
     }
 }
 
+/**
+ * Partition the mesh of @p session, which must have been initialised, into
+ * @p nParts partitions and write them to the directory of partitions used by
+ * the part-only option. Unlike the part-only option, this returns to the
+ * caller once the partitions are written.
+ */
+void MeshGraphXml::WritePartitions(
+    const LibUtilities::SessionReaderSharedPtr session,
+    int                                        nParts,
+    bool                                       overlapping)
+{
+    m_session = session;
+
+    // Read 'lite' geometry information
+    ReadGeometry(NullDomainRangeShPtr, false);
+
+    auto comp = CreateCompositeDescriptor();
+
+    MeshPartitionSharedPtr partitioner =
+        GetMeshPartitionFactory().CreateInstance(
+            GetPartitionerName(session), session, m_meshDimension,
+            CreateMeshEntities(), comp);
+
+    partitioner->PartitionMesh(nParts, true, overlapping);
+
+    vector<set<unsigned int>> elmtIDs;
+    vector<unsigned int> parts(nParts);
+    for (int i = 0; i < nParts; ++i)
+    {
+        vector<unsigned int> elIDs;
+        set<unsigned int> tmp;
+        partitioner->GetElementIDs(i, elIDs);
+        tmp.insert(elIDs.begin(), elIDs.end());
+        elmtIDs.push_back(tmp);
+        parts[i] = i;
+    }
+
+    this->WriteXMLGeometry(m_session->GetSessionName(), elmtIDs, parts);
+
+    if (session->GetComm()->TreatAsRankZero() &&
+        session->DefinesCmdLineArgument("part-info"))
+    {
+        partitioner->PrintPartInfo(std::cout);
+    }
+}
+
 void MeshGraphXml::ReadGeometry(
     DomainRangeShPtr rng,
     bool             fillGraph)
@@ -78,6 +78,10 @@ public:
         bool             fillGraph);
     SPATIAL_DOMAINS_EXPORT virtual void PartitionMesh(
         LibUtilities::SessionReaderSharedPtr session);
+    SPATIAL_DOMAINS_EXPORT void WritePartitions(
+        const LibUtilities::SessionReaderSharedPtr session,
+        int                                        nParts,
+        bool                                       overlapping = false);
 
 protected:
     // some of these functions are going to be virtual because they will be
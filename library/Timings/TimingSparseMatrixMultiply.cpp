@@ -0,0 +1,138 @@
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include <LibUtilities/BasicUtils/Thread.h>
+#include <LibUtilities/BasicUtils/Timer.h>
+#include <LibUtilities/LinearAlgebra/SparseUtils.hpp>
+#include <LibUtilities/LinearAlgebra/StorageSmvBsr.hpp>
+#include <LibUtilities/LinearAlgebra/StorageSmvSell.hpp>
+
+using namespace std;
+using namespace Nektar;
+
+// Times the sparse matrix-vector multiply of the SmvBSR and SmvSELL global
+// matrix storage formats on a banded matrix with varying row lengths, which
+// resembles the statically condensed matrices of the iterative solvers.
+int main(int argc, char *argv[])
+{
+    if(argc < 4)
+    {
+        fprintf(stderr,"Usage: TimingSparseMatrixMultiply NumRows NumNonZerosPerRow NumThreads [BlockSize] [ChunkSize] [SortWindow]\n");
+        fprintf(stderr,"    where: - NumRows is the size of the matrix \n");
+        fprintf(stderr,"    where: - NumNonZerosPerRow is the maximum number of nonzeros in a row \n");
+        fprintf(stderr,"    where: - NumThreads is the number of threads used by the multiply \n");
+        fprintf(stderr,"    where: - BlockSize is the SmvBSR block size (default 1) \n");
+        fprintf(stderr,"    where: - ChunkSize is the SmvSELL chunk size (default 8) \n");
+        fprintf(stderr,"    where: - SortWindow is the SmvSELL sorting window (default 256) \n");
+        exit(1);
+    }
+
+    int nRows      = atoi(argv[1]);
+    int nnzPerRow  = atoi(argv[2]);
+    int nThreads   = atoi(argv[3]);
+    int blockSize  = argc > 4 ? atoi(argv[4]) : 1;
+    int chunkSize  = argc > 5 ? atoi(argv[5]) : 8;
+    int sortWindow = argc > 6 ? atoi(argv[6]) : 256;
+
+    // Round the matrix size up to a whole number of blocks.
+    nRows = ((nRows + blockSize - 1) / blockSize) * blockSize;
+
+    // Each row has between half and all of nnzPerRow entries spread over a
+    // band around the diagonal.
+    COOMatType cooMat;
+    srand(1234);
+    const int band = 4 * nnzPerRow;
+    for (int i = 0; i < nRows; ++i)
+    {
+        cooMat[CoordType(i, i)] = 2.0 * nnzPerRow;
+        int nnz = nnzPerRow / 2 + rand() % (nnzPerRow / 2 + 1);
+        for (int k = 1; k < nnz; ++k)
+        {
+            int j = i + rand() % (2 * band + 1) - band;
+            if (j >= 0 && j < nRows)
+            {
+                cooMat[CoordType(i, j)] = -1.0 + 2.0 * rand() / RAND_MAX;
+            }
+        }
+    }
+
+    if (nThreads > 1)
+    {
+        Thread::ThreadMaster &tms = Thread::GetThreadMaster();
+        tms.SetThreadingType("ThreadManagerBoost");
+        tms.CreateInstance(Thread::ThreadMaster::SessionJob, nThreads);
+    }
+
+    BCOMatType bcoMat;
+    convertCooToBco(blockSize, cooMat, bcoMat);
+    int nBlkRows = nRows / blockSize;
+
+    StorageSmvBsr<NekDouble> bsr(nBlkRows, nBlkRows, blockSize, bcoMat);
+    StorageSmvSell<NekDouble> sell(nRows, nRows, cooMat, chunkSize,
+                                   sortWindow);
+    bsr.SetNumThreads(nThreads);
+    sell.SetNumThreads(nThreads);
+
+    Array<OneD, NekDouble> in(nRows), outRef(nRows, 0.0), out(nRows);
+    for (int i = 0; i < nRows; ++i)
+    {
+        in[i] = sin(0.01 * i);
+    }
+    for (auto &entry : cooMat)
+    {
+        outRef[entry.first.first] += entry.second * in[entry.first.second];
+    }
+
+    // Repeat the multiply for at least a second of wall time.
+    LibUtilities::Timer timer;
+    NekDouble exeTime;
+
+    cout << "Rows: " << nRows << ", nonzeros: " << cooMat.size()
+         << ", threads: " << nThreads << endl;
+
+    for (int s = 0; s < 2; ++s)
+    {
+        int nIter = 1;
+        NekDouble elapsed = 0.0;
+        while (elapsed < 1.0)
+        {
+            nIter *= 2;
+            timer.Start();
+            for (int n = 0; n < nIter; ++n)
+            {
+                if (s == 0)
+                {
+                    bsr.Multiply(in, out);
+                }
+                else
+                {
+                    sell.Multiply(in, out);
+                }
+            }
+            timer.Stop();
+            elapsed = timer.TimePerTest(1);
+        }
+        exeTime = timer.TimePerTest(nIter);
+
+        NekDouble err = 0.0;
+        for (int i = 0; i < nRows; ++i)
+        {
+            err = max(err, fabs(out[i] - outRef[i]));
+        }
+
+        size_t bytes = s == 0 ? bsr.GetMemoryUsage() : sell.GetMemoryUsage();
+        NekDouble fill = s == 0 ? bsr.GetFillInRatio() : sell.GetFillInRatio();
+
+        cout << (s == 0 ? "SmvBSR  " : "SmvSELL ")
+             << "time: "     << setw(12) << exeTime << " s, "
+             << "GFLOP/s: "  << setw(8)  << 2.0e-9 * cooMat.size() / exeTime
+             << ", fill-in: " << setw(8) << fill
+             << ", memory: "  << bytes / 1024 << " KB"
+             << ", error: "   << err << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestFieldIOXml.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+// Description: Tests the background writes of FieldIOXml.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/BasicUtils/FieldIOXml.h>
+#include <LibUtilities/Communication/Comm.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace fs = boost::filesystem;
+
+namespace Nektar
+{
+namespace LibUtilities
+{
+namespace FieldIOXmlUnitTest
+{
+
+/**
+ * @brief Write a checkpoint in the background and restart from it.
+ *
+ * The file must not appear under its final name until WaitForWrite has
+ * returned, after which it must read back the data that was written.
+ */
+BOOST_AUTO_TEST_CASE(TestWriteAsyncRestart)
+{
+    CommSharedPtr comm =
+        GetCommFactory().CreateInstance("Serial", 0, nullptr);
+    FieldIOSharedPtr fld =
+        MemoryManager<FieldIOXml>::AllocateSharedPtr(comm, true);
+
+    const unsigned int nModes = 3;
+    std::vector<unsigned int> elmtIds = {3, 7};
+    std::vector<BasisType>    basis(2, eModified_A);
+    std::vector<unsigned int> numModes(2, nModes);
+    std::vector<std::string>  fields = {"u", "v"};
+
+    std::vector<FieldDefinitionsSharedPtr> outDefs(
+        1, MemoryManager<FieldDefinitions>::AllocateSharedPtr(
+               eQuadrilateral, elmtIds, basis, true, numModes, fields));
+
+    const size_t nData = fields.size() * elmtIds.size() * nModes * nModes;
+    std::vector<std::vector<NekDouble> > outData(1);
+    for (size_t i = 0; i < nData; ++i)
+    {
+        outData[0].push_back(0.25 * i - 1.0);
+    }
+    std::vector<NekDouble> expected = outData[0];
+
+    FieldMetaDataMap outInfo;
+    outInfo["Time"] = "0.5";
+
+    fs::path chkFile = fs::temp_directory_path() /
+        fs::unique_path("TestWriteAsync-%%%%-%%%%.chk");
+    std::string chkName = chkFile.string();
+
+    fld->WriteAsync(chkName, outDefs, outData, outInfo);
+    BOOST_CHECK(outData[0].empty());
+    BOOST_CHECK(!fs::exists(chkFile));
+
+    fld->WaitForWrite();
+    BOOST_CHECK(fs::exists(chkFile));
+    BOOST_CHECK(!fs::exists(chkName + ".tmp"));
+
+    std::vector<FieldDefinitionsSharedPtr> inDefs;
+    std::vector<std::vector<NekDouble> >   inData;
+    FieldMetaDataMap                       inInfo;
+    fld->Import(chkName, inDefs, inData, inInfo);
+
+    BOOST_CHECK_EQUAL(inInfo["Time"], "0.5");
+    BOOST_REQUIRE_EQUAL(inDefs.size(), 1);
+    BOOST_CHECK(inDefs[0]->m_elementIDs == elmtIds);
+    BOOST_CHECK(inDefs[0]->m_fields == fields);
+    BOOST_REQUIRE_EQUAL(inData.size(), 1);
+    BOOST_REQUIRE_EQUAL(inData[0].size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(inData[0][i], expected[i]);
+    }
+
+    fs::remove(chkFile);
+}
+
+}
+}
+}
@@ -42,5 +42,63 @@ BOOST_AUTO_TEST_CASE(TestPowOperator)
     BOOST_CHECK_EQUAL(out[0], 65536);
 }
 
+BOOST_AUTO_TEST_CASE(TestFusedBackend)
+{
+    std::vector<std::string> exprs = {
+        "x", "2", "Kp", "-x^2 + PI*y", "x + y*z - t*Kp",
+        "sin(x)*cos(y) + exp(-t)", "(x <= 0.5)*(y > 0.1) + (x == t)",
+        "atan2(y, x) + rad(x, y) + sign(x - y)", "x + awgn(0)"
+    };
+
+    LibUtilities::Interpreter stack, fused;
+    stack.SetBackend(LibUtilities::Interpreter::eStack);
+    fused.SetBackend(LibUtilities::Interpreter::eFused);
+    stack.SetParameter("Kp", 3.5);
+    fused.SetParameter("Kp", 3.5);
+
+    const int npts = 2500;
+    Array<OneD, NekDouble> x(npts), y(npts), z(npts), t(npts, 0.25);
+    Array<OneD, NekDouble> out1(npts), out2(npts);
+    for (int i = 0; i < npts; ++i)
+    {
+        x[i] = sin(0.37 * i);
+        y[i] = cos(0.11 * i);
+        z[i] = (i % 7) / 7.0;
+    }
+
+    for (auto &expr : exprs)
+    {
+        int func1 = stack.DefineFunction("x y z t", expr);
+        int func2 = fused.DefineFunction("x y z t", expr);
+        stack.Evaluate(func1, x, y, z, t, out1);
+        fused.Evaluate(func2, x, y, z, t, out2);
+
+        for (int i = 0; i < npts; ++i)
+        {
+            BOOST_CHECK_EQUAL(out1[i], out2[i]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestFusedMissingVariable)
+{
+    LibUtilities::Interpreter fused;
+    fused.SetBackend(LibUtilities::Interpreter::eFused);
+
+    // Variables which are not passed to Evaluate are zero.
+    int func = fused.DefineFunction("x y z", "x + 2*z");
+    Array<OneD, NekDouble> x(10), out(10);
+    for (int i = 0; i < 10; ++i)
+    {
+        x[i] = 0.5 * i;
+    }
+
+    fused.Evaluate(func, { x }, out);
+    for (int i = 0; i < 10; ++i)
+    {
+        BOOST_CHECK_EQUAL(out[i], x[i]);
+    }
+}
+
 }
 }
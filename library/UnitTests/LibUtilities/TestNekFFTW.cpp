@@ -0,0 +1,140 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestNekFFTW.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+// Description: Tests the batched transforms and wisdom export of NekFFTW.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/FFT/NektarFFT.h>
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+
+namespace Nektar
+{
+namespace LibUtilities
+{
+namespace NekFFTWUnitTest
+{
+
+/// Compare the batched transforms of @a nTrans vectors of length @a N with
+/// the transforms of each vector in turn.
+void CheckBatchedTrans(const int N, const int nTrans)
+{
+    NektarFFTSharedPtr fft =
+        GetNektarFFTFactory().CreateInstance("NekFFTW", N);
+
+    Array<OneD, NekDouble> phys(nTrans*N), coef(nTrans*N), back(nTrans*N);
+    Array<OneD, NekDouble> single(N), tmpIn, tmpOut;
+    for (int i = 0; i < nTrans*N; ++i)
+    {
+        phys[i] = sin(0.37*i) + 0.1*cos(1.3*i*i);
+    }
+
+    fft->FFTFwdTrans(nTrans, phys, coef);
+    for (int i = 0; i < nTrans; ++i)
+    {
+        fft->FFTFwdTrans(tmpIn = phys + i*N, single);
+        for (int j = 0; j < N; ++j)
+        {
+            BOOST_CHECK_SMALL(coef[i*N+j] - single[j], 1e-12);
+        }
+    }
+
+    fft->FFTBwdTrans(nTrans, coef, back);
+    for (int i = 0; i < nTrans; ++i)
+    {
+        fft->FFTBwdTrans(tmpIn = coef + i*N, single);
+        for (int j = 0; j < N; ++j)
+        {
+            BOOST_CHECK_SMALL(back[i*N+j] - single[j], 1e-12);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestNekFFTWBatchedEstimate)
+{
+    NektarFFT::SetPlanRigour(eFFTEstimate);
+    CheckBatchedTrans(16, 1);
+    CheckBatchedTrans(16, 7);
+    CheckBatchedTrans(12, 5);
+}
+
+BOOST_AUTO_TEST_CASE(TestNekFFTWBatchedMeasure)
+{
+    NektarFFT::SetPlanRigour(eFFTMeasure);
+    CheckBatchedTrans(16, 7);
+    CheckBatchedTrans(12, 5);
+    NektarFFT::SetPlanRigour(eFFTEstimate);
+}
+
+BOOST_AUTO_TEST_CASE(TestNekFFTWWisdomExport)
+{
+    boost::filesystem::path file = boost::filesystem::temp_directory_path() /
+        boost::filesystem::unique_path("nekfftw-%%%%-%%%%.wisdom");
+
+    NektarFFT::SetPlanRigour(eFFTMeasure);
+    NektarFFT::SetWisdomFile(file.string());
+    NektarFFT::SetExportWisdom(true);
+
+    // The wisdom is only written once the last transform is destroyed
+    NektarFFTSharedPtr fft1 =
+        GetNektarFFTFactory().CreateInstance("NekFFTW", 20);
+    NektarFFTSharedPtr fft2 =
+        GetNektarFFTFactory().CreateInstance("NekFFTW", 24);
+
+    Array<OneD, NekDouble> phys(3*20, 1.0), coef(3*20);
+    fft1->FFTFwdTrans(3, phys, coef);
+    BOOST_CHECK(!boost::filesystem::exists(file));
+
+    fft1.reset();
+    BOOST_CHECK(!boost::filesystem::exists(file));
+
+    fft2.reset();
+    BOOST_CHECK(boost::filesystem::exists(file));
+    boost::filesystem::remove(file);
+
+    // Processes which do not export the wisdom never write the file
+    NektarFFT::SetExportWisdom(false);
+    fft1 = GetNektarFFTFactory().CreateInstance("NekFFTW", 28);
+    fft1.reset();
+    BOOST_CHECK(!boost::filesystem::exists(file));
+
+    NektarFFT::SetExportWisdom(true);
+    NektarFFT::SetWisdomFile("");
+    NektarFFT::SetPlanRigour(eFFTEstimate);
+}
+
+}
+}
+}
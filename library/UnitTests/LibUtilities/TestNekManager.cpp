@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestNekManager.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests the memory accounting, eviction and read-only mode of
+// NekManager.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/BasicUtils/NekManager.hpp>
+#include <LibUtilities/LinearAlgebra/NekTypeDefs.hpp>
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace Nektar
+{
+namespace LibUtilities
+{
+namespace NekManagerUnitTest
+{
+
+typedef NekManager<int, DNekMat> MatrixManager;
+
+static int numCreated = 0;
+
+DNekMatSharedPtr CreateMatrix(const int &key)
+{
+    ++numCreated;
+    return DNekMatSharedPtr(new DNekMat(key, key, 1.0));
+}
+
+BOOST_AUTO_TEST_CASE(TestNekManagerAccounting)
+{
+    MatrixManager manager(CreateMatrix, "TestNekManagerAccounting");
+    NekManagerPoolInfo &info = *manager.GetPoolInfo();
+
+    manager[10];
+    manager[20];
+    manager[10];
+
+    BOOST_CHECK_EQUAL(info.m_entries.load(), 2);
+    BOOST_CHECK_EQUAL(info.m_hits.load(),    1);
+    BOOST_CHECK_EQUAL(info.m_misses.load(),  2);
+    BOOST_CHECK_EQUAL(info.m_bytes.load(),
+                      2 * sizeof(DNekMat) + 500 * sizeof(NekDouble));
+
+    manager.DeleteObject(20);
+    BOOST_CHECK_EQUAL(info.m_entries.load(), 1);
+    BOOST_CHECK_EQUAL(info.m_bytes.load(),
+                      sizeof(DNekMat) + 100 * sizeof(NekDouble));
+
+    MatrixManager::ClearManager("TestNekManagerAccounting");
+    BOOST_CHECK_EQUAL(info.m_entries.load(), 0);
+    BOOST_CHECK_EQUAL(info.m_bytes.load(),   0);
+}
+
+BOOST_AUTO_TEST_CASE(TestNekManagerEviction)
+{
+    MatrixManager manager(CreateMatrix, "TestNekManagerEviction");
+    NekManagerPoolInfo &info = *manager.GetPoolInfo();
+
+    // Room for the 11x11 and 12x12 matrices, but not all three.
+    NekManagerRegistry::SetMemoryBudget(
+        2 * sizeof(DNekMat) + 265 * sizeof(NekDouble),
+        "TestNekManagerEviction");
+
+    manager[10];
+    manager[11];
+    manager[10];
+    manager[12];
+
+    // The least recently used matrix is discarded.
+    BOOST_CHECK_EQUAL(info.m_entries.load(),   2);
+    BOOST_CHECK_EQUAL(info.m_evictions.load(), 1);
+    BOOST_CHECK(manager.AlreadyCreated(10));
+    BOOST_CHECK(!manager.AlreadyCreated(11));
+    BOOST_CHECK(manager.AlreadyCreated(12));
+
+    NekManagerRegistry::SetMemoryBudget(0, "TestNekManagerEviction");
+}
+
+BOOST_AUTO_TEST_CASE(TestNekManagerReadOnly)
+{
+    MatrixManager manager(CreateMatrix, "TestNekManagerReadOnly");
+    NekManagerPoolInfo &info = *manager.GetPoolInfo();
+
+    DNekMatSharedPtr mat = manager[3];
+
+    NekManagerRegistry::SetReadOnly(true);
+    numCreated = 0;
+
+    // Stored objects are shared, others are created but not stored.
+    BOOST_CHECK(manager[3] == mat);
+    manager[4];
+    manager[4];
+    BOOST_CHECK_EQUAL(numCreated, 2);
+    BOOST_CHECK_EQUAL(info.m_readOnlyMisses.load(), 2);
+    BOOST_CHECK(!manager.AlreadyCreated(4));
+    BOOST_CHECK_EQUAL(info.m_entries.load(), 1);
+
+    NekManagerRegistry::SetReadOnly(false);
+
+    manager[4];
+    BOOST_CHECK(manager.AlreadyCreated(4));
+}
+
+}
+}
+}
@@ -38,6 +38,10 @@
 #include <UnitTests/CountedObject.h>
 
 #include <LibUtilities/Memory/NekMemoryManager.hpp>
+#include <LibUtilities/Memory/ThreadSpecificPool.hpp>
+
+#include <thread>
+#include <vector>
 
 namespace Nektar
 {
@@ -142,5 +146,63 @@ namespace Nektar
             std::shared_ptr<int> m1 = MemoryManager<int>::AllocateSharedPtr();
             m1 = MemoryManager<int>::AllocateSharedPtr();
         }
+
+        BOOST_AUTO_TEST_CASE(testCrossThreadDeallocation)
+        {
+            detail::ThreadSpecificPool pool(24);
+            const size_t n = 10000;
+            std::vector<void*> blocks(n);
+
+            // Allocate on one thread and return the blocks from another.
+            std::thread producer([&]()
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    blocks[i] = pool.Allocate();
+                    *static_cast<size_t*>(blocks[i]) = i;
+                }
+            });
+            producer.join();
+
+            bool intact = true;
+            std::thread consumer([&]()
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    intact &= *static_cast<size_t*>(blocks[i]) == i;
+                    pool.Deallocate(blocks[i]);
+                }
+            });
+            consumer.join();
+            BOOST_CHECK(intact);
+
+            detail::PoolStatistics stats = pool.GetStatistics();
+            BOOST_CHECK_EQUAL(stats.blockSize, 24u);
+            BOOST_CHECK_EQUAL(stats.allocs, n);
+            BOOST_CHECK_EQUAL(stats.inUse, 0u);
+            size_t reserved = stats.reserved;
+
+            // The blocks returned to the producer's cache are reused by the
+            // next thread without reserving more memory.
+            std::thread adopter([&]()
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    blocks[i] = pool.Allocate();
+                }
+            });
+            adopter.join();
+
+            stats = pool.GetStatistics();
+            BOOST_CHECK_EQUAL(stats.allocs, 2 * n);
+            BOOST_CHECK_EQUAL(stats.inUse, n);
+            BOOST_CHECK_EQUAL(stats.reserved, reserved);
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                pool.Deallocate(blocks[i]);
+            }
+            BOOST_CHECK_EQUAL(pool.GetStatistics().inUse, 0u);
+        }
     }
 }
@@ -68,6 +68,18 @@ NekDouble EquationOfState::GetSoundSpeed(const NekDouble &rho,
     return v_GetSoundSpeed(rho, e);
 }
 
+void EquationOfState::GetPressure(const int n, const NekDouble *rho,
+                                  const NekDouble *e, NekDouble *p)
+{
+    v_GetPressureBatch(n, rho, e, p);
+}
+
+void EquationOfState::GetSoundSpeed(const int n, const NekDouble *rho,
+                                    const NekDouble *e, NekDouble *c)
+{
+    v_GetSoundSpeedBatch(n, rho, e, c);
+}
+
 NekDouble EquationOfState::GetEntropy(const NekDouble &rho, const NekDouble &e)
 {
     return v_GetEntropy(rho, e);
@@ -110,4 +122,25 @@ NekDouble EquationOfState::v_GetSoundSpeed(const NekDouble &rho,
 
     return sqrt(chi + kappa * enthalpy);
 }
+
+// General implementation of the batched evaluations, which simply loop over
+// the pointwise versions. Equations of state with a simple closed form should
+// override these so that the loops can be vectorised.
+void EquationOfState::v_GetPressureBatch(const int n, const NekDouble *rho,
+                                         const NekDouble *e, NekDouble *p)
+{
+    for (int i = 0; i < n; ++i)
+    {
+        p[i] = v_GetPressure(rho[i], e[i]);
+    }
+}
+
+void EquationOfState::v_GetSoundSpeedBatch(const int n, const NekDouble *rho,
+                                           const NekDouble *e, NekDouble *c)
+{
+    for (int i = 0; i < n; ++i)
+    {
+        c[i] = v_GetSoundSpeed(rho[i], e[i]);
+    }
+}
 }
@@ -75,6 +75,14 @@ public:
     /// Calculate the sound speed
     NekDouble GetSoundSpeed(const NekDouble &rho, const NekDouble &e);
 
+    /// Calculate the pressure at @p n points
+    void GetPressure(const int n, const NekDouble *rho, const NekDouble *e,
+                     NekDouble *p);
+
+    /// Calculate the sound speed at @p n points
+    void GetSoundSpeed(const int n, const NekDouble *rho, const NekDouble *e,
+                       NekDouble *c);
+
     /// Calculate the entropy
     NekDouble GetEntropy(const NekDouble &rho, const NekDouble &e);
 
@@ -105,6 +113,12 @@ protected:
 
     virtual NekDouble v_GetSoundSpeed(const NekDouble &rho, const NekDouble &e);
 
+    virtual void v_GetPressureBatch(const int n, const NekDouble *rho,
+                                    const NekDouble *e, NekDouble *p);
+
+    virtual void v_GetSoundSpeedBatch(const int n, const NekDouble *rho,
+                                      const NekDouble *e, NekDouble *c);
+
     virtual NekDouble v_GetEntropy(const NekDouble &rho,
                                    const NekDouble &e) = 0;
 
@@ -72,6 +72,26 @@ NekDouble IdealGasEoS::v_GetSoundSpeed(
     return sqrt(m_gamma * m_gasConstant * T);
 }
 
+void IdealGasEoS::v_GetPressureBatch(
+    const int n, const NekDouble *rho, const NekDouble *e, NekDouble *p)
+{
+    for (int i = 0; i < n; ++i)
+    {
+        p[i] = rho[i]*e[i]*(m_gamma-1);
+    }
+}
+
+void IdealGasEoS::v_GetSoundSpeedBatch(
+    const int n, const NekDouble *rho, const NekDouble *e, NekDouble *c)
+{
+    boost::ignore_unused(rho);
+    for (int i = 0; i < n; ++i)
+    {
+        NekDouble T = e[i]*(m_gamma-1)/m_gasConstant;
+        c[i] = sqrt(m_gamma * m_gasConstant * T);
+    }
+}
+
 NekDouble IdealGasEoS::v_GetEntropy(
     const NekDouble &rho, const NekDouble &e)
 {
@@ -74,6 +74,14 @@ class IdealGasEoS : public EquationOfState
         virtual NekDouble v_GetSoundSpeed(
             const NekDouble &rho, const NekDouble &e);
 
+        virtual void v_GetPressureBatch(
+            const int n, const NekDouble *rho, const NekDouble *e,
+            NekDouble *p);
+
+        virtual void v_GetSoundSpeedBatch(
+            const int n, const NekDouble *rho, const NekDouble *e,
+            NekDouble *c);
+
         virtual NekDouble v_GetEntropy(
             const NekDouble &rho, const NekDouble &e);
 
@@ -59,6 +59,12 @@ namespace Nektar
             double  rhoL, double  rhouL, double  rhovL, double  rhowL, double  EL,
             double  rhoR, double  rhouR, double  rhovR, double  rhowR, double  ER,
             double &rhof, double &rhouf, double &rhovf, double &rhowf, double &Ef);
+
+        virtual void v_BatchSolve(
+            const int               n,
+            const NekDouble *const *Fwd,
+            const NekDouble *const *Bwd,
+                  NekDouble *const *flux);
         
         double M1Function(int A, double M);
         double M2Function(int A, double M);
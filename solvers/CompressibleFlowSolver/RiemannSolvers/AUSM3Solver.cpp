@@ -73,75 +73,86 @@ namespace Nektar
         double  rhoR, double  rhouR, double  rhovR, double  rhowR, double  ER,
         double &rhof, double &rhouf, double &rhovf, double &rhowf, double &Ef)
     {
-        // Left and Right velocities
-        NekDouble uL = rhouL / rhoL;
-        NekDouble vL = rhovL / rhoL;
-        NekDouble wL = rhowL / rhoL;
-        NekDouble uR = rhouR / rhoR;
-        NekDouble vR = rhovR / rhoR;
-        NekDouble wR = rhowR / rhoR;
-
-        // Internal energy (per unit mass)
-        NekDouble eL =
-                (EL - 0.5 * (rhouL * uL + rhovL * vL + rhowL * wL)) / rhoL;
-        NekDouble eR =
-                (ER - 0.5 * (rhouR * uR + rhovR * vR + rhowR * wR)) / rhoR;
-        // Pressure
-        NekDouble pL = m_eos->GetPressure(rhoL, eL);
-        NekDouble pR = m_eos->GetPressure(rhoR, eR);
-        // Speed of sound
-        NekDouble cL = m_eos->GetSoundSpeed(rhoL, eL);
-        NekDouble cR = m_eos->GetSoundSpeed(rhoR, eR);
-        
-        // Average speeds of sound
-        NekDouble cA = 0.5 * (cL + cR);
-        
-        // Local Mach numbers
-        NekDouble ML = uL / cA;
-        NekDouble MR = uR / cA;
-        
-        // Parameters for specify the upwinding
-        // Note: if fa = 1 then AUSM3 = AUSM3
-        NekDouble Mco    = 0.01;
-        NekDouble Mtilde = 0.5 * (ML * ML + MR * MR);
-        NekDouble Mo     = std::min(1.0, std::max(Mtilde, Mco*Mco));
-        NekDouble fa     = Mo * (2.0 - Mo);
-        NekDouble beta   = 0.125;
-        NekDouble alpha  = 0.1875;
-        NekDouble sigma  = 1.0;
-        NekDouble Kp     = 0.25;
-        NekDouble Ku     = 0.75;
-        NekDouble rhoA   = 0.5 * (rhoL + rhoR);
-        NekDouble Mp     = -(Kp / fa) * ((pR - pL) / (rhoA * cA * cA)) * 
-                            std::max(1.0 - sigma * Mtilde, 0.0);
-        
-        NekDouble Mbar   = M4Function(0, beta, ML) + 
-                           M4Function(1, beta, MR) + Mp;
-        
-        NekDouble pu     = -2.0 * Ku * rhoA * cA * cA * (MR - ML) * 
-                           P5Function(0, alpha, ML) * P5Function(1, alpha, MR);
-        
-        NekDouble pbar   = pL * P5Function(0, alpha, ML) + 
-                           pR * P5Function(1, alpha, MR) + pu;
-        
-        if (Mbar >= 0.0)
-        {
-            rhof  = cA * Mbar * rhoL;
-            rhouf = cA * Mbar * rhoL * uL + pbar;
-            rhovf = cA * Mbar * rhoL * vL;
-            rhowf = cA * Mbar * rhoL * wL;
-            Ef    = cA * Mbar * (EL + pL);
-        }
-        else
+        const NekDouble *Fwd [5] = {&rhoL, &rhouL, &rhovL, &rhowL, &EL};
+        const NekDouble *Bwd [5] = {&rhoR, &rhouR, &rhovR, &rhowR, &ER};
+        NekDouble       *flux[5] = {&rhof, &rhouf, &rhovf, &rhowf, &Ef};
+
+        AUSM3Solver::v_BatchSolve(1, Fwd, Bwd, flux);
+    }
+
+    /**
+     * @brief AUSM3 Riemann solver at @p n trace points, see v_PointSolve.
+     */
+    void AUSM3Solver::v_BatchSolve(
+        const int               n,
+        const NekDouble *const *Fwd,
+        const NekDouble *const *Bwd,
+              NekDouble *const *flux)
+    {
+        NekDouble uL[kBatchSize], vL[kBatchSize], wL[kBatchSize];
+        NekDouble eL[kBatchSize], pL[kBatchSize], cL[kBatchSize];
+        NekDouble uR[kBatchSize], vR[kBatchSize], wR[kBatchSize];
+        NekDouble eR[kBatchSize], pR[kBatchSize], cR[kBatchSize];
+
+        const NekDouble *rhoL = Fwd[0], *rhoR = Bwd[0];
+        const NekDouble *EL   = Fwd[4], *ER   = Bwd[4];
+
+        // Velocities, internal energy (per unit mass), pressure and speed of
+        // sound
+        GetPrimitiveBatch(n, Fwd, uL, vL, wL, eL, pL, cL);
+        GetPrimitiveBatch(n, Bwd, uR, vR, wR, eR, pR, cR);
+
+        for (int i = 0; i < n; ++i)
         {
-            rhof  = cA * Mbar * rhoR;
-            rhouf = cA * Mbar * rhoR * uR + pbar;
-            rhovf = cA * Mbar * rhoR * vR;
-            rhowf = cA * Mbar * rhoR * wR;
-            Ef    = cA * Mbar * (ER + pR);
+            // Average speeds of sound
+            NekDouble cA = 0.5 * (cL[i] + cR[i]);
+
+            // Local Mach numbers
+            NekDouble ML = uL[i] / cA;
+            NekDouble MR = uR[i] / cA;
+
+            // Parameters for specify the upwinding
+            // Note: if fa = 1 then AUSM3 = AUSM3
+            NekDouble Mco    = 0.01;
+            NekDouble Mtilde = 0.5 * (ML * ML + MR * MR);
+            NekDouble Mo     = std::min(1.0, std::max(Mtilde, Mco*Mco));
+            NekDouble fa     = Mo * (2.0 - Mo);
+            NekDouble beta   = 0.125;
+            NekDouble alpha  = 0.1875;
+            NekDouble sigma  = 1.0;
+            NekDouble Kp     = 0.25;
+            NekDouble Ku     = 0.75;
+            NekDouble rhoA   = 0.5 * (rhoL[i] + rhoR[i]);
+            NekDouble Mp     = -(Kp / fa) *
+                               ((pR[i] - pL[i]) / (rhoA * cA * cA)) *
+                               std::max(1.0 - sigma * Mtilde, 0.0);
+
+            NekDouble Mbar   = M4Function(0, beta, ML) +
+                               M4Function(1, beta, MR) + Mp;
+
+            NekDouble pu     = -2.0 * Ku * rhoA * cA * cA * (MR - ML) *
+                               P5Function(0, alpha, ML) *
+                               P5Function(1, alpha, MR);
+
+            NekDouble pbar   = pL[i] * P5Function(0, alpha, ML) +
+                               pR[i] * P5Function(1, alpha, MR) + pu;
+
+            // Upwind state
+            bool      left = Mbar >= 0.0;
+            NekDouble rho  = left ? rhoL[i] : rhoR[i];
+            NekDouble u    = left ? uL[i]   : uR[i];
+            NekDouble v    = left ? vL[i]   : vR[i];
+            NekDouble w    = left ? wL[i]   : wR[i];
+            NekDouble Ep   = left ? EL[i] + pL[i] : ER[i] + pR[i];
+
+            flux[0][i] = cA * Mbar * rho;
+            flux[1][i] = cA * Mbar * rho * u + pbar;
+            flux[2][i] = cA * Mbar * rho * v;
+            flux[3][i] = cA * Mbar * rho * w;
+            flux[4][i] = cA * Mbar * Ep;
         }
     }
-    
+
     double AUSM3Solver::M1Function(int A, double M)
     {
         double out;
@@ -40,7 +40,7 @@ namespace Nektar
 {
     CompressibleSolver::CompressibleSolver(
         const LibUtilities::SessionReaderSharedPtr& pSession)
-        : RiemannSolver(pSession), m_pointSolve(true)
+        : RiemannSolver(pSession), m_pointSolve(true), m_batchSolve(true)
     {
         m_requiresRotation = true;
 
@@ -60,11 +60,49 @@ namespace Nektar
         const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
               Array<OneD,       Array<OneD, NekDouble> > &flux)
     {
-        if (m_pointSolve)
+        int expDim      = nDim;
+        int nvariables  = Fwd.num_elements();
+
+        if (m_pointSolve && m_batchSolve &&
+            (expDim == 1 || nvariables == expDim+2))
+        {
+            int npts = Fwd[0].num_elements();
+
+            // Storage for the momentum components which are not present in
+            // lower dimensions.
+            NekDouble zero[kBatchSize]    = {};
+            NekDouble discard[kBatchSize];
+
+            const NekDouble *pFwd[5], *pBwd[5];
+            NekDouble       *pFlux[5];
+
+            for (int i = 0; i < npts; i += kBatchSize)
+            {
+                int n = std::min(kBatchSize, npts - i);
+
+                for (int j = 0; j < 5; ++j)
+                {
+                    pFwd [j] = zero;
+                    pBwd [j] = zero;
+                    pFlux[j] = discard;
+                }
+
+                for (int j = 0; j < expDim+1; ++j)
+                {
+                    pFwd [j] = &Fwd [j][i];
+                    pBwd [j] = &Bwd [j][i];
+                    pFlux[j] = &flux[j][i];
+                }
+
+                pFwd [4] = &Fwd [expDim+1][i];
+                pBwd [4] = &Bwd [expDim+1][i];
+                pFlux[4] = &flux[expDim+1][i];
+
+                v_BatchSolve(n, pFwd, pBwd, pFlux);
+            }
+        }
+        else if (m_pointSolve)
         {
-            int expDim      = nDim;
-            int nvariables  = Fwd.num_elements();
-            
             NekDouble rhouf, rhovf;
             
             // Check if PDE-based SC is used
@@ -130,6 +168,54 @@ namespace Nektar
         }
     }
 
+    void CompressibleSolver::v_BatchSolve(
+        const int               n,
+        const NekDouble *const *Fwd,
+        const NekDouble *const *Bwd,
+              NekDouble *const *flux)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            v_PointSolve(
+                Fwd [0][i], Fwd [1][i], Fwd [2][i], Fwd [3][i], Fwd [4][i],
+                Bwd [0][i], Bwd [1][i], Bwd [2][i], Bwd [3][i], Bwd [4][i],
+                flux[0][i], flux[1][i], flux[2][i], flux[3][i], flux[4][i]);
+        }
+    }
+
+    /**
+     * @brief Compute the velocity, internal energy, pressure and sound speed
+     * of @p n conserved states, laid out as in v_BatchSolve.
+     */
+    void CompressibleSolver::GetPrimitiveBatch(
+        const int               n,
+        const NekDouble *const *cons,
+              NekDouble        *u,
+              NekDouble        *v,
+              NekDouble        *w,
+              NekDouble        *e,
+              NekDouble        *p,
+              NekDouble        *c)
+    {
+        const NekDouble *rho  = cons[0];
+        const NekDouble *rhou = cons[1];
+        const NekDouble *rhov = cons[2];
+        const NekDouble *rhow = cons[3];
+        const NekDouble *E    = cons[4];
+
+        for (int i = 0; i < n; ++i)
+        {
+            u[i] = rhou[i] / rho[i];
+            v[i] = rhov[i] / rho[i];
+            w[i] = rhow[i] / rho[i];
+            e[i] = (E[i] - 0.5 * (rhou[i] * u[i] + rhov[i] * v[i] +
+                                  rhow[i] * w[i])) / rho[i];
+        }
+
+        m_eos->GetPressure  (n, rho, e, p);
+        m_eos->GetSoundSpeed(n, rho, e, c);
+    }
+
     NekDouble CompressibleSolver::GetRoeSoundSpeed(
         NekDouble rhoL, NekDouble pL, NekDouble eL, NekDouble HL, NekDouble srL,
         NekDouble rhoR, NekDouble pR, NekDouble eR, NekDouble HR, NekDouble srR,
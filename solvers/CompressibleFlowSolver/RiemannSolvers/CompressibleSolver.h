@@ -46,8 +46,19 @@ namespace Nektar
 {
     class CompressibleSolver : public RiemannSolver
     {
+    public:
+        /// Maximum number of trace points passed to v_BatchSolve.
+        static const int kBatchSize = 64;
+
+        /// Select between the batched and the pointwise solution path.
+        void SetBatchSolve(bool batchSolve)
+        {
+            m_batchSolve = batchSolve;
+        }
+
     protected:
         bool m_pointSolve;
+        bool m_batchSolve;
         EquationOfStateSharedPtr m_eos;
         bool m_idealGas;
         
@@ -82,6 +93,23 @@ namespace Nektar
                      "This function should be defined by subclasses.");
         }
         
+        /**
+         * @brief Solve the Riemann problem at @p n <= #kBatchSize trace
+         * points.
+         *
+         * Each of @p Fwd, @p Bwd and @p flux holds five pointers to the
+         * density, the three momentum components and the energy, so that
+         * solvers can evaluate a whole chunk of points in loops which the
+         * compiler is able to vectorise. Unused momentum components point to
+         * zeroed storage. The default implementation calls v_PointSolve at
+         * each point.
+         */
+        virtual void v_BatchSolve(
+            const int               n,
+            const NekDouble *const *Fwd,
+            const NekDouble *const *Bwd,
+                  NekDouble *const *flux);
+
         virtual void v_PointSolveVisc(
             NekDouble  rhoL, NekDouble  rhouL, NekDouble  rhovL, NekDouble  rhowL, NekDouble  EL, NekDouble EpsL,
             NekDouble  rhoR, NekDouble  rhouR, NekDouble  rhovR, NekDouble  rhowR, NekDouble  ER, NekDouble EpsR,
@@ -94,6 +122,16 @@ namespace Nektar
                      "This function should be defined by subclasses.");
         }
 
+        void GetPrimitiveBatch(
+            const int               n,
+            const NekDouble *const *cons,
+                  NekDouble        *u,
+                  NekDouble        *v,
+                  NekDouble        *w,
+                  NekDouble        *e,
+                  NekDouble        *p,
+                  NekDouble        *c);
+
         NekDouble GetRoeSoundSpeed(
             NekDouble rhoL, NekDouble pL, NekDouble eL, NekDouble HL, NekDouble srL,
             NekDouble rhoR, NekDouble pR, NekDouble eR, NekDouble HR, NekDouble srR,
@@ -172,23 +172,35 @@ namespace Nektar
         NekDouble  rhoL, NekDouble  rhouL, NekDouble  rhovL, NekDouble  rhowL, NekDouble  EL,
         NekDouble  rhoR, NekDouble  rhouR, NekDouble  rhovR, NekDouble  rhowR, NekDouble  ER,
         NekDouble &rhof, NekDouble &rhouf, NekDouble &rhovf, NekDouble &rhowf, NekDouble &Ef)
+    {
+        const NekDouble *Fwd [5] = {&rhoL, &rhouL, &rhovL, &rhowL, &EL};
+        const NekDouble *Bwd [5] = {&rhoR, &rhouR, &rhovR, &rhowR, &ER};
+        NekDouble       *flux[5] = {&rhof, &rhouf, &rhovf, &rhowf, &Ef};
+
+        ExactSolverToro::v_BatchSolve(1, Fwd, Bwd, flux);
+    }
+
+    /**
+     * @brief Exact Riemann solver at @p n trace points, see v_PointSolve.
+     *
+     * The primitive variables and sound speeds of all points are computed
+     * first in a loop which can be vectorised; the Newton-Raphson iteration
+     * and sampling, which branch on the local wave pattern, are then
+     * performed point by point.
+     */
+    void ExactSolverToro::v_BatchSolve(
+        const int               n,
+        const NekDouble *const *Fwd,
+        const NekDouble *const *Bwd,
+              NekDouble *const *flux)
     {
         static NekDouble gamma = m_params["gamma"]();
 
-        // Left and right variables.
-        NekDouble uL = rhouL / rhoL;
-        NekDouble vL = rhovL / rhoL;
-        NekDouble wL = rhowL / rhoL;
-        NekDouble uR = rhouR / rhoR;
-        NekDouble vR = rhovR / rhoR;
-        NekDouble wR = rhowR / rhoR;
-        
-        // Left and right pressure.
-        NekDouble pL = (gamma - 1.0) * 
-                       (EL - 0.5 * (rhouL*uL + rhovL*vL + rhowL*wL));
-        NekDouble pR = (gamma - 1.0) * 
-                       (ER - 0.5 * (rhouR*uR + rhovR*vR + rhowR*wR));
-        
+        NekDouble uLs[kBatchSize], vLs[kBatchSize], wLs[kBatchSize];
+        NekDouble pLs[kBatchSize], cLs[kBatchSize];
+        NekDouble uRs[kBatchSize], vRs[kBatchSize], wRs[kBatchSize];
+        NekDouble pRs[kBatchSize], cRs[kBatchSize];
+
         // Compute gammas.
         NekDouble g[] = { gamma,
                           (gamma-1.0)/(2.0*gamma),
@@ -200,194 +212,228 @@ namespace Nektar
                           0.5*(gamma-1.0),
                           gamma-1.0 };
 
-        // Compute sound speeds.
-        NekDouble cL = sqrt(gamma * pL / rhoL);
-        NekDouble cR = sqrt(gamma * pR / rhoR);
+        for (int i = 0; i < n; ++i)
+        {
+            NekDouble rhoL  = Fwd[0][i], rhoR  = Bwd[0][i];
+            NekDouble rhouL = Fwd[1][i], rhouR = Bwd[1][i];
+            NekDouble rhovL = Fwd[2][i], rhovR = Bwd[2][i];
+            NekDouble rhowL = Fwd[3][i], rhowR = Bwd[3][i];
+            NekDouble EL    = Fwd[4][i], ER    = Bwd[4][i];
 
-        ASSERTL0(g[4]*(cL+cR) > (uR-uL), "Vacuum is generated by given data.");
+            // Left and right variables.
+            uLs[i] = rhouL / rhoL;
+            vLs[i] = rhovL / rhoL;
+            wLs[i] = rhowL / rhoL;
+            uRs[i] = rhouR / rhoR;
+            vRs[i] = rhovR / rhoR;
+            wRs[i] = rhowR / rhoR;
 
-        // Guess initial pressure.
-        NekDouble pOld  = guessp(g, rhoL, uL, pL, cL, rhoR, uR, pR, cR);
-        NekDouble uDiff = uR - uL;
-        NekDouble p, fL, fR, fLd, fRd, change;
-        int k;
+            // Left and right pressure.
+            pLs[i] = (gamma - 1.0) *
+                (EL - 0.5 * (rhouL*uLs[i] + rhovL*vLs[i] + rhowL*wLs[i]));
+            pRs[i] = (gamma - 1.0) *
+                (ER - 0.5 * (rhouR*uRs[i] + rhovR*vRs[i] + rhowR*wRs[i]));
 
-        // Newton-Raphson iteration for pressure in star region.
-        for (k = 0; k < NRITER; ++k)
+            // Compute sound speeds.
+            cLs[i] = sqrt(gamma * pLs[i] / rhoL);
+            cRs[i] = sqrt(gamma * pRs[i] / rhoR);
+        }
+
+        for (int i = 0; i < n; ++i)
         {
-            prefun(g, pOld, rhoL, pL, cL, fL, fLd);
-            prefun(g, pOld, rhoR, pR, cR, fR, fRd);
-            p = pOld - (fL+fR+uDiff) / (fLd+fRd);
-            change = 2 * fabs((p-pOld)/(p+pOld));
-            
-            if (change <= TOL)
-            {
-                break;
-            }
-            
-            if (p < 0.0)
+            NekDouble rhoL = Fwd[0][i], rhoR = Bwd[0][i];
+            NekDouble uL   = uLs[i],    uR   = uRs[i];
+            NekDouble vL   = vLs[i],    vR   = vRs[i];
+            NekDouble wL   = wLs[i],    wR   = wRs[i];
+            NekDouble pL   = pLs[i],    pR   = pRs[i];
+            NekDouble cL   = cLs[i],    cR   = cRs[i];
+
+            ASSERTL0(g[4]*(cL+cR) > (uR-uL),
+                     "Vacuum is generated by given data.");
+
+            // Guess initial pressure.
+            NekDouble pOld  = guessp(g, rhoL, uL, pL, cL, rhoR, uR, pR, cR);
+            NekDouble uDiff = uR - uL;
+            NekDouble p, fL, fR, fLd, fRd, change;
+            int k;
+
+            // Newton-Raphson iteration for pressure in star region.
+            for (k = 0; k < NRITER; ++k)
             {
-                p = TOL;
+                prefun(g, pOld, rhoL, pL, cL, fL, fLd);
+                prefun(g, pOld, rhoR, pR, cR, fR, fRd);
+                p = pOld - (fL+fR+uDiff) / (fLd+fRd);
+                change = 2 * fabs((p-pOld)/(p+pOld));
+
+                if (change <= TOL)
+                {
+                    break;
+                }
+
+                if (p < 0.0)
+                {
+                    p = TOL;
+                }
+
+                pOld = p;
             }
-            
-            pOld = p;
-        }
-        
-        ASSERTL0(k < NRITER, "Divergence in Newton-Raphson scheme");
 
-        // Compute velocity in star region.
-        NekDouble u = 0.5*(uL+uR+fR-fL);
-        
-        // -- SAMPLE ROUTINE --
-        // The variable S aligns with the Fortran parameter S of the SAMPLE
-        // routine, but is hard-coded as 0 (and should be optimised out by the
-        // compiler). Since we are using a Godunov scheme we pick this as 0 (see
-        // chapter 6 of Toro 2009).
-        const NekDouble S = 0.0;
+            ASSERTL0(k < NRITER, "Divergence in Newton-Raphson scheme");
 
-        // Computed primitive variables.
-        NekDouble outRho, outU, outV, outW, outP;
-        
-        if (S <= u)
-        {
-            if (p <= pL)
+            // Compute velocity in star region.
+            NekDouble u = 0.5*(uL+uR+fR-fL);
+
+            // -- SAMPLE ROUTINE --
+            // The variable S aligns with the Fortran parameter S of the SAMPLE
+            // routine, but is hard-coded as 0 (and should be optimised out by the
+            // compiler). Since we are using a Godunov scheme we pick this as 0 (see
+            // chapter 6 of Toro 2009).
+            const NekDouble S = 0.0;
+
+            // Computed primitive variables.
+            NekDouble outRho, outU, outV, outW, outP;
+
+            if (S <= u)
             {
-                // Left rarefaction
-                NekDouble shL = uL - cL;
-                if (S <= shL)
+                if (p <= pL)
                 {
-                    // Sampled point is left data state.
-                    outRho = rhoL;
-                    outU   = uL;
-                    outV   = vL;
-                    outW   = wL;
-                    outP   = pL;
+                    // Left rarefaction
+                    NekDouble shL = uL - cL;
+                    if (S <= shL)
+                    {
+                        // Sampled point is left data state.
+                        outRho = rhoL;
+                        outU   = uL;
+                        outV   = vL;
+                        outW   = wL;
+                        outP   = pL;
+                    }
+                    else
+                    {
+                        NekDouble cmL = cL*pow(p/pL, g[1]);
+                        NekDouble stL = u - cmL;
+
+                        if (S > stL)
+                        {
+                            // Sampled point is star left state
+                            outRho = rhoL*pow(p/pL, 1.0/gamma);
+                            outU   = u;
+                            outV   = vL;
+                            outW   = wL;
+                            outP   = p;
+                        }
+                        else
+                        {
+                            // Sampled point is inside left fan
+                            NekDouble c = g[5]*(cL + g[7]*(uL - S));
+                            outRho = rhoL*pow(c/cL, g[4]);
+                            outU   = g[5]*(cL + g[7]*uL + S);
+                            outV   = vL;
+                            outW   = wL;
+                            outP   = pL*pow(c/cL, g[3]);
+                        }
+                    }
                 }
                 else
                 {
-                    NekDouble cmL = cL*pow(p/pL, g[1]);
-                    NekDouble stL = u - cmL;
-                    
-                    if (S > stL)
+                    // Left shock
+                    NekDouble pmL = p / pL;
+                    NekDouble SL  = uL - cL*sqrt(g[2]*pmL + g[1]);
+                    if (S <= SL)
                     {
-                        // Sampled point is star left state
-                        outRho = rhoL*pow(p/pL, 1.0/gamma);
-                        outU   = u;
+                        // Sampled point is left data state
+                        outRho = rhoL;
+                        outU   = uL;
                         outV   = vL;
                         outW   = wL;
-                        outP   = p;
+                        outP   = pL;
                     }
                     else
                     {
-                        // Sampled point is inside left fan
-                        NekDouble c = g[5]*(cL + g[7]*(uL - S));
-                        outRho = rhoL*pow(c/cL, g[4]);
-                        outU   = g[5]*(cL + g[7]*uL + S);
+                        // Sampled point is star left state
+                        outRho = rhoL*(pmL + g[6])/(pmL*g[6] + 1.0);
+                        outU   = u;
                         outV   = vL;
                         outW   = wL;
-                        outP   = pL*pow(c/cL, g[3]);
+                        outP   = p;
                     }
                 }
             }
             else
             {
-                // Left shock
-                NekDouble pmL = p / pL;
-                NekDouble SL  = uL - cL*sqrt(g[2]*pmL + g[1]);
-                if (S <= SL)
-                {
-                    // Sampled point is left data state
-                    outRho = rhoL;
-                    outU   = uL;
-                    outV   = vL;
-                    outW   = wL;
-                    outP   = pL;
-                }
-                else
-                {
-                    // Sampled point is star left state
-                    outRho = rhoL*(pmL + g[6])/(pmL*g[6] + 1.0);
-                    outU   = u;
-                    outV   = vL;
-                    outW   = wL;
-                    outP   = p;
-                }
-            }
-        }
-        else
-        {
-            if (p > pR)
-            {
-                // Right shock
-                NekDouble pmR = p/pR;
-                NekDouble SR = uR + cR*sqrt(g[2]*pmR + g[1]);
-                if (S >= SR)
-                {
-                    // Sampled point is right data state
-                    outRho = rhoR;
-                    outU   = uR;
-                    outV   = vR;
-                    outW   = wR;
-                    outP   = pR;
-                }
-                else
-                {
-                    // Sampled point is star right state
-                    outRho = rhoR*(pmR + g[6])/(pmR*g[6] + 1.0);
-                    outU   = u;
-                    outV   = vR;
-                    outW   = wR;
-                    outP   = p;
-                }
-            }
-            else
-            {
-                // Right rarefaction
-                NekDouble shR = uR + cR;
-                
-                if (S >= shR)
-                {
-                    // Sampled point is right data state
-                    outRho = rhoR;
-                    outU   = uR;
-                    outV   = vR;
-                    outW   = wR;
-                    outP   = pR;
-                }
-                else
+                if (p > pR)
                 {
-                    NekDouble cmR = cR*pow(p/pR, g[1]);
-                    NekDouble stR = u + cmR;
-                    
-                    if (S <= stR)
+                    // Right shock
+                    NekDouble pmR = p/pR;
+                    NekDouble SR = uR + cR*sqrt(g[2]*pmR + g[1]);
+                    if (S >= SR)
+                    {
+                        // Sampled point is right data state
+                        outRho = rhoR;
+                        outU   = uR;
+                        outV   = vR;
+                        outW   = wR;
+                        outP   = pR;
+                    }
+                    else
                     {
                         // Sampled point is star right state
-                        outRho = rhoR*pow(p/pR, 1.0/gamma);
+                        outRho = rhoR*(pmR + g[6])/(pmR*g[6] + 1.0);
                         outU   = u;
                         outV   = vR;
                         outW   = wR;
                         outP   = p;
                     }
-                    else
+                }
+                else
+                {
+                    // Right rarefaction
+                    NekDouble shR = uR + cR;
+
+                    if (S >= shR)
                     {
-                        // Sampled point is inside left fan
-                        NekDouble c = g[5]*(cR - g[7]*(uR-S));
-                        outRho = rhoR*pow(c/cR, g[4]);
-                        outU   = g[5]*(-cR + g[7]*uR + S);
+                        // Sampled point is right data state
+                        outRho = rhoR;
+                        outU   = uR;
                         outV   = vR;
                         outW   = wR;
-                        outP   = pR*pow(c/cR, g[3]);
+                        outP   = pR;
+                    }
+                    else
+                    {
+                        NekDouble cmR = cR*pow(p/pR, g[1]);
+                        NekDouble stR = u + cmR;
+
+                        if (S <= stR)
+                        {
+                            // Sampled point is star right state
+                            outRho = rhoR*pow(p/pR, 1.0/gamma);
+                            outU   = u;
+                            outV   = vR;
+                            outW   = wR;
+                            outP   = p;
+                        }
+                        else
+                        {
+                            // Sampled point is inside left fan
+                            NekDouble c = g[5]*(cR - g[7]*(uR-S));
+                            outRho = rhoR*pow(c/cR, g[4]);
+                            outU   = g[5]*(-cR + g[7]*uR + S);
+                            outV   = vR;
+                            outW   = wR;
+                            outP   = pR*pow(c/cR, g[3]);
+                        }
                     }
                 }
             }
+
+            // Transform computed primitive variables to fluxes.
+            flux[0][i] = outRho * outU;
+            flux[1][i] = outP + outRho*outU*outU;
+            flux[2][i] = outRho * outU * outV;
+            flux[3][i] = outRho * outU * outW;
+            flux[4][i] = outU*(outP/(gamma-1.0) + 0.5*outRho*
+                               (outU*outU + outV*outV + outW*outW) + outP);
         }
-        
-        // Transform computed primitive variables to fluxes.
-        rhof  = outRho * outU;
-        rhouf = outP + outRho*outU*outU;
-        rhovf = outRho * outU * outV;
-        rhowf = outRho * outU * outW;
-        Ef    = outU*(outP/(gamma-1.0) + 0.5*outRho*
-                      (outU*outU + outV*outV + outW*outW) + outP);
     }
 }
@@ -59,6 +59,12 @@ namespace Nektar
             NekDouble  rhoL, NekDouble  rhouL, NekDouble  rhovL, NekDouble  rhowL, NekDouble  EL,
             NekDouble  rhoR, NekDouble  rhouR, NekDouble  rhovR, NekDouble  rhowR, NekDouble  ER,
             NekDouble &rhof, NekDouble &rhouf, NekDouble &rhovf, NekDouble &rhowf, NekDouble &Ef);
+
+        virtual void v_BatchSolve(
+            const int               n,
+            const NekDouble *const *Fwd,
+            const NekDouble *const *Bwd,
+                  NekDouble *const *flux);
     };
 }
 
@@ -70,104 +70,145 @@ namespace Nektar
         NekDouble  rhoR, NekDouble  rhouR, NekDouble  rhovR, NekDouble  rhowR, NekDouble  ER,
         NekDouble &rhof, NekDouble &rhouf, NekDouble &rhovf, NekDouble &rhowf, NekDouble &Ef)
     {
-        // Left and Right velocities
-        NekDouble uL = rhouL / rhoL;
-        NekDouble vL = rhovL / rhoL;
-        NekDouble wL = rhowL / rhoL;
-        NekDouble uR = rhouR / rhoR;
-        NekDouble vR = rhovR / rhoR;
-        NekDouble wR = rhowR / rhoR;
-        
-        // Internal energy (per unit mass)
-        NekDouble eL =
-                (EL - 0.5 * (rhouL * uL + rhovL * vL + rhowL * wL)) / rhoL;
-        NekDouble eR =
-                (ER - 0.5 * (rhouR * uR + rhovR * vR + rhowR * wR)) / rhoR;
-        // Pressure
-        NekDouble pL = m_eos->GetPressure(rhoL, eL);
-        NekDouble pR = m_eos->GetPressure(rhoR, eR);
-        // Speed of sound
-        NekDouble cL = m_eos->GetSoundSpeed(rhoL, eL);
-        NekDouble cR = m_eos->GetSoundSpeed(rhoR, eR);
+        const NekDouble *Fwd [5] = {&rhoL, &rhouL, &rhovL, &rhowL, &EL};
+        const NekDouble *Bwd [5] = {&rhoR, &rhouR, &rhovR, &rhowR, &ER};
+        NekDouble       *flux[5] = {&rhof, &rhouf, &rhovf, &rhowf, &Ef};
 
-        // Left and right total enthalpy
-        NekDouble HL = (EL + pL) / rhoL;
-        NekDouble HR = (ER + pR) / rhoR;
+        HLLCSolver::v_BatchSolve(1, Fwd, Bwd, flux);
+    }
 
-        // Square root of rhoL and rhoR.
-        NekDouble srL  = sqrt(rhoL);
-        NekDouble srR  = sqrt(rhoR);
-        NekDouble srLR = srL + srR;
-        
-        // Roe average state
-        NekDouble uRoe   = (srL * uL + srR * uR) / srLR;
-        NekDouble vRoe   = (srL * vL + srR * vR) / srLR;
-        NekDouble wRoe   = (srL * wL + srR * wR) / srLR;
-        NekDouble URoe2  = uRoe*uRoe + vRoe*vRoe + wRoe*wRoe;
-        NekDouble HRoe   = (srL * HL + srR * HR) / srLR;
-        NekDouble cRoe   = GetRoeSoundSpeed(
-                                rhoL, pL, eL, HL, srL,
-                                rhoR, pR, eR, HR, srR,
-                                HRoe, URoe2, srLR);
+    /**
+     * @brief HLLC Riemann solver at @p n trace points, see v_PointSolve.
+     *
+     * The choice between the supersonic and star state fluxes is made
+     * without branching so that the loops can be vectorised.
+     */
+    void HLLCSolver::v_BatchSolve(
+        const int               n,
+        const NekDouble *const *Fwd,
+        const NekDouble *const *Bwd,
+              NekDouble *const *flux)
+    {
+        NekDouble uL[kBatchSize], vL[kBatchSize], wL[kBatchSize];
+        NekDouble eL[kBatchSize], pL[kBatchSize], cL[kBatchSize];
+        NekDouble uR[kBatchSize], vR[kBatchSize], wR[kBatchSize];
+        NekDouble eR[kBatchSize], pR[kBatchSize], cR[kBatchSize];
+        NekDouble uRoe[kBatchSize], URoe2[kBatchSize];
+        NekDouble HRoe[kBatchSize], cRoe[kBatchSize];
 
-        // Maximum wave speeds
-        NekDouble SL = std::min(uL-cL, uRoe-cRoe);
-        NekDouble SR = std::max(uR+cR, uRoe+cRoe);
-        
-        // HLLC Riemann fluxes (positive case)
-        if (SL >= 0)
+        const NekDouble *rhoL  = Fwd[0], *rhoR  = Bwd[0];
+        const NekDouble *rhouL = Fwd[1], *rhouR = Bwd[1];
+        const NekDouble *rhovL = Fwd[2], *rhovR = Bwd[2];
+        const NekDouble *rhowL = Fwd[3], *rhowR = Bwd[3];
+        const NekDouble *EL    = Fwd[4], *ER    = Bwd[4];
+
+        // Velocities, internal energy (per unit mass), pressure and speed of
+        // sound
+        GetPrimitiveBatch(n, Fwd, uL, vL, wL, eL, pL, cL);
+        GetPrimitiveBatch(n, Bwd, uR, vR, wR, eR, pR, cR);
+
+        // Roe average state
+        for (int i = 0; i < n; ++i)
         {
-            rhof  = rhouL;
-            rhouf = rhouL * uL + pL;
-            rhovf = rhouL * vL;
-            rhowf = rhouL * wL;
-            Ef    = uL * (EL + pL);
+            // Left and right total enthalpy
+            NekDouble HL = (EL[i] + pL[i]) / rhoL[i];
+            NekDouble HR = (ER[i] + pR[i]) / rhoR[i];
+
+            // Square root of rhoL and rhoR.
+            NekDouble srL  = sqrt(rhoL[i]);
+            NekDouble srR  = sqrt(rhoR[i]);
+            NekDouble srLR = srL + srR;
+
+            uRoe[i]        = (srL * uL[i] + srR * uR[i]) / srLR;
+            NekDouble vRoe = (srL * vL[i] + srR * vR[i]) / srLR;
+            NekDouble wRoe = (srL * wL[i] + srR * wR[i]) / srLR;
+            URoe2[i]       = uRoe[i]*uRoe[i] + vRoe*vRoe + wRoe*wRoe;
+            HRoe[i]        = (srL * HL + srR * HR) / srLR;
         }
-        // HLLC Riemann fluxes (negative case)
-        else if (SR <= 0)
+
+        if (m_idealGas)
         {
-            rhof  = rhouR;
-            rhouf = rhouR * uR + pR;
-            rhovf = rhouR * vR;
-            rhowf = rhouR * wR;
-            Ef    = uR * (ER + pR);
+            static NekDouble gamma = m_params["gamma"]();
+            for (int i = 0; i < n; ++i)
+            {
+                cRoe[i] = sqrt((gamma - 1.0)*(HRoe[i] - 0.5 * URoe2[i]));
+            }
         }
-        // HLLC Riemann fluxes (general case (SL < 0 | SR > 0)
         else
         {
-            NekDouble SM = (pR - pL + rhouL * (SL - uL) - rhouR * (SR - uR)) /
-            (rhoL * (SL - uL) - rhoR * (SR - uR));
-            NekDouble rhoML  = rhoL * (SL - uL) / (SL - SM);
-            NekDouble rhouML = rhoML * SM;
-            NekDouble rhovML = rhoML * vL;
-            NekDouble rhowML = rhoML * wL;
-            NekDouble EML    = rhoML * (EL / rhoL +
-                                        (SM - uL) * (SM + pL / (rhoL * (SL - uL))));
-            
-            NekDouble rhoMR  = rhoR * (SR - uR) / (SR - SM);
-            NekDouble rhouMR = rhoMR * SM;
-            NekDouble rhovMR = rhoMR * vR;
-            NekDouble rhowMR = rhoMR * wR;
-            NekDouble EMR    = rhoMR * (ER / rhoR +
-                                        (SM - uR) * (SM + pR / (rhoR * (SR - uR))));
-            
-            if (SL < 0.0 && SM >= 0.0)
+            for (int i = 0; i < n; ++i)
             {
-                rhof  = rhouL + SL * (rhoML - rhoL);
-                rhouf = rhouL * uL + pL + SL * (rhouML - rhouL);
-                rhovf = rhouL * vL + SL * (rhovML - rhovL);
-                rhowf = rhouL * wL + SL * (rhowML - rhowL);
-                Ef    = uL * (EL + pL) + SL * (EML - EL);
-            }
-            else if(SM < 0.0 && SR > 0.0)
-            {
-                rhof  = rhouR + SR * (rhoMR - rhoR);
-                rhouf = rhouR * uR + pR + SR * (rhouMR - rhouR);
-                rhovf = rhouR * vR + SR * (rhovMR - rhovR);
-                rhowf = rhouR * wR + SR * (rhowMR - rhowR);
-                Ef    = uR * (ER + pR) + SR * (EMR - ER);
+                NekDouble HL  = (EL[i] + pL[i]) / rhoL[i];
+                NekDouble HR  = (ER[i] + pR[i]) / rhoR[i];
+                NekDouble srL = sqrt(rhoL[i]);
+                NekDouble srR = sqrt(rhoR[i]);
+                cRoe[i] = GetRoeSoundSpeed(
+                    rhoL[i], pL[i], eL[i], HL, srL,
+                    rhoR[i], pR[i], eR[i], HR, srR,
+                    HRoe[i], URoe2[i], srL + srR);
             }
         }
+
+        for (int i = 0; i < n; ++i)
+        {
+            // Maximum wave speeds
+            NekDouble SL = std::min(uL[i]-cL[i], uRoe[i]-cRoe[i]);
+            NekDouble SR = std::max(uR[i]+cR[i], uRoe[i]+cRoe[i]);
+
+            // Supersonic fluxes of the left and right states
+            NekDouble rhofL  = rhouL[i];
+            NekDouble rhoufL = rhouL[i] * uL[i] + pL[i];
+            NekDouble rhovfL = rhouL[i] * vL[i];
+            NekDouble rhowfL = rhouL[i] * wL[i];
+            NekDouble EfL    = uL[i] * (EL[i] + pL[i]);
+
+            NekDouble rhofR  = rhouR[i];
+            NekDouble rhoufR = rhouR[i] * uR[i] + pR[i];
+            NekDouble rhovfR = rhouR[i] * vR[i];
+            NekDouble rhowfR = rhouR[i] * wR[i];
+            NekDouble EfR    = uR[i] * (ER[i] + pR[i]);
+
+            // Star states
+            NekDouble SM = (pR[i] - pL[i] + rhouL[i] * (SL - uL[i]) -
+                            rhouR[i] * (SR - uR[i])) /
+                (rhoL[i] * (SL - uL[i]) - rhoR[i] * (SR - uR[i]));
+            NekDouble rhoML  = rhoL[i] * (SL - uL[i]) / (SL - SM);
+            NekDouble rhouML = rhoML * SM;
+            NekDouble rhovML = rhoML * vL[i];
+            NekDouble rhowML = rhoML * wL[i];
+            NekDouble EML    = rhoML * (EL[i] / rhoL[i] +
+                (SM - uL[i]) * (SM + pL[i] / (rhoL[i] * (SL - uL[i]))));
+
+            NekDouble rhoMR  = rhoR[i] * (SR - uR[i]) / (SR - SM);
+            NekDouble rhouMR = rhoMR * SM;
+            NekDouble rhovMR = rhoMR * vR[i];
+            NekDouble rhowMR = rhoMR * wR[i];
+            NekDouble EMR    = rhoMR * (ER[i] / rhoR[i] +
+                (SM - uR[i]) * (SM + pR[i] / (rhoR[i] * (SR - uR[i]))));
+
+            // HLLC Riemann fluxes: positive case (SL >= 0), negative case
+            // (SR <= 0) and general case (SL < 0 < SR), where the sign of SM
+            // selects the left or right star state.
+            bool posCase = SL >= 0;
+            bool negCase = SR <= 0;
+            bool starL   = SM >= 0.0;
+
+            flux[0][i] = posCase ? rhofL : negCase ? rhofR : starL ?
+                rhofL  + SL * (rhoML  - rhoL[i])  :
+                rhofR  + SR * (rhoMR  - rhoR[i]);
+            flux[1][i] = posCase ? rhoufL : negCase ? rhoufR : starL ?
+                rhoufL + SL * (rhouML - rhouL[i]) :
+                rhoufR + SR * (rhouMR - rhouR[i]);
+            flux[2][i] = posCase ? rhovfL : negCase ? rhovfR : starL ?
+                rhovfL + SL * (rhovML - rhovL[i]) :
+                rhovfR + SR * (rhovMR - rhovR[i]);
+            flux[3][i] = posCase ? rhowfL : negCase ? rhowfR : starL ?
+                rhowfL + SL * (rhowML - rhowL[i]) :
+                rhowfR + SR * (rhowMR - rhowR[i]);
+            flux[4][i] = posCase ? EfL : negCase ? EfR : starL ?
+                EfL    + SL * (EML    - EL[i])    :
+                EfR    + SR * (EMR    - ER[i]);
+        }
     }
 
     void HLLCSolver::v_PointSolveVisc(
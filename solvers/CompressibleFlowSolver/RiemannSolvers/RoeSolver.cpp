@@ -78,98 +78,130 @@ namespace Nektar
         double  rhoL, double  rhouL, double  rhovL, double  rhowL, double  EL,
         double  rhoR, double  rhouR, double  rhovR, double  rhowR, double  ER,
         double &rhof, double &rhouf, double &rhovf, double &rhowf, double &Ef)
-    {        
+    {
+        const NekDouble *Fwd [5] = {&rhoL, &rhouL, &rhovL, &rhowL, &EL};
+        const NekDouble *Bwd [5] = {&rhoR, &rhouR, &rhovR, &rhowR, &ER};
+        NekDouble       *flux[5] = {&rhof, &rhouf, &rhovf, &rhowf, &Ef};
+
+        RoeSolver::v_BatchSolve(1, Fwd, Bwd, flux);
+    }
+
+    /**
+     * @brief Roe Riemann solver at @p n trace points, see v_PointSolve.
+     */
+    void RoeSolver::v_BatchSolve(
+        const int               n,
+        const NekDouble *const *Fwd,
+        const NekDouble *const *Bwd,
+              NekDouble *const *flux)
+    {
         static NekDouble gamma = m_params["gamma"]();
-        
-        // Left and right velocities
-        NekDouble uL = rhouL / rhoL;
-        NekDouble vL = rhovL / rhoL;
-        NekDouble wL = rhowL / rhoL;
-        NekDouble uR = rhouR / rhoR;
-        NekDouble vR = rhovR / rhoR;
-        NekDouble wR = rhowR / rhoR;
-
-        // Left and right pressures
-        NekDouble pL = (gamma - 1.0) *
-            (EL - 0.5 * (rhouL * uL + rhovL * vL + rhowL * wL));
-        NekDouble pR = (gamma - 1.0) *
-            (ER - 0.5 * (rhouR * uR + rhovR * vR + rhowR * wR));
-        
-        // Left and right enthalpy
-        NekDouble hL = (EL + pL) / rhoL;
-        NekDouble hR = (ER + pR) / rhoR;
-
-        // Square root of rhoL and rhoR.
-        NekDouble srL  = sqrt(rhoL);
-        NekDouble srR  = sqrt(rhoR);
-        NekDouble srLR = srL + srR;
-        
-        // Velocity, enthalpy and sound speed Roe averages (equation 11.60).
-        NekDouble uRoe   = (srL * uL + srR * uR) / srLR;
-        NekDouble vRoe   = (srL * vL + srR * vR) / srLR;
-        NekDouble wRoe   = (srL * wL + srR * wR) / srLR;
-        NekDouble hRoe   = (srL * hL + srR * hR) / srLR;
-        NekDouble URoe   = (uRoe * uRoe + vRoe * vRoe + wRoe * wRoe);
-        NekDouble cRoe   = sqrt((gamma - 1.0)*(hRoe - 0.5 * URoe));
-        
-        // Compute eigenvectors (equation 11.59).
-        NekDouble k[5][5] = {
-            {1, uRoe - cRoe, vRoe, wRoe, hRoe - uRoe * cRoe},
-            {1, uRoe,        vRoe, wRoe, 0.5 * URoe},
-            {0, 0,           1,    0,    vRoe},
-            {0, 0,           0,    1,    wRoe},
-            {1, uRoe+cRoe,  vRoe,  wRoe, hRoe + uRoe*cRoe}
-        };
-
-        // Calculate jumps \Delta u_i (defined preceding equation 11.67).
-        NekDouble jump[5] = {
-            rhoR  - rhoL,
-            rhouR - rhouL,
-            rhovR - rhovL,
-            rhowR - rhowL,
-            ER    - EL
-        };
-
-        // Define \Delta u_5 (equation 11.70).
-        NekDouble jumpbar = jump[4] - (jump[2]-vRoe*jump[0])*vRoe -
-            (jump[3]-wRoe*jump[0])*wRoe;
-        
-        // Compute wave amplitudes (equations 11.68, 11.69).
-        NekDouble alpha[5];
-        alpha[1] = (gamma-1.0)*(jump[0]*(hRoe - uRoe*uRoe) + uRoe*jump[1] -
-                                jumpbar)/(cRoe*cRoe);
-        alpha[0] = (jump[0]*(uRoe + cRoe) - jump[1] - cRoe*alpha[1])/(2.0*cRoe);
-        alpha[4] = jump[0] - (alpha[0] + alpha[1]);
-        alpha[2] = jump[2] - vRoe * jump[0];
-        alpha[3] = jump[3] - wRoe * jump[0];
-        
-        // Compute average of left and right fluxes needed for equation 11.29.
-        rhof  = 0.5*(rhoL*uL + rhoR*uR);
-        rhouf = 0.5*(pL + rhoL*uL*uL + pR + rhoR*uR*uR);
-        rhovf = 0.5*(rhoL*uL*vL + rhoR*uR*vR);
-        rhowf = 0.5*(rhoL*uL*wL + rhoR*uR*wR);
-        Ef    = 0.5*(uL*(EL + pL) + uR*(ER + pR));
-
-        // Compute eigenvalues \lambda_i (equation 11.58).
-        NekDouble uRoeAbs = fabs(uRoe);
-        NekDouble lambda[5] = { 
-            fabs(uRoe - cRoe),
-            uRoeAbs,
-            uRoeAbs,
-            uRoeAbs,
-            fabs(uRoe + cRoe)
-        };
-
-        // Finally perform summation (11.29).
-        for (int i = 0; i < 5; ++i)
+
+        for (int i = 0; i < n; ++i)
         {
-            uRoeAbs = 0.5*alpha[i]*lambda[i];
-			
-            rhof  -= uRoeAbs*k[i][0];
-            rhouf -= uRoeAbs*k[i][1];
-            rhovf -= uRoeAbs*k[i][2];
-            rhowf -= uRoeAbs*k[i][3];
-            Ef    -= uRoeAbs*k[i][4];
+            NekDouble rhoL  = Fwd[0][i], rhoR  = Bwd[0][i];
+            NekDouble rhouL = Fwd[1][i], rhouR = Bwd[1][i];
+            NekDouble rhovL = Fwd[2][i], rhovR = Bwd[2][i];
+            NekDouble rhowL = Fwd[3][i], rhowR = Bwd[3][i];
+            NekDouble EL    = Fwd[4][i], ER    = Bwd[4][i];
+
+            // Left and right velocities
+            NekDouble uL = rhouL / rhoL;
+            NekDouble vL = rhovL / rhoL;
+            NekDouble wL = rhowL / rhoL;
+            NekDouble uR = rhouR / rhoR;
+            NekDouble vR = rhovR / rhoR;
+            NekDouble wR = rhowR / rhoR;
+
+            // Left and right pressures
+            NekDouble pL = (gamma - 1.0) *
+                (EL - 0.5 * (rhouL * uL + rhovL * vL + rhowL * wL));
+            NekDouble pR = (gamma - 1.0) *
+                (ER - 0.5 * (rhouR * uR + rhovR * vR + rhowR * wR));
+
+            // Left and right enthalpy
+            NekDouble hL = (EL + pL) / rhoL;
+            NekDouble hR = (ER + pR) / rhoR;
+
+            // Square root of rhoL and rhoR.
+            NekDouble srL  = sqrt(rhoL);
+            NekDouble srR  = sqrt(rhoR);
+            NekDouble srLR = srL + srR;
+
+            // Velocity, enthalpy and sound speed Roe averages (eq. 11.60).
+            NekDouble uRoe   = (srL * uL + srR * uR) / srLR;
+            NekDouble vRoe   = (srL * vL + srR * vR) / srLR;
+            NekDouble wRoe   = (srL * wL + srR * wR) / srLR;
+            NekDouble hRoe   = (srL * hL + srR * hR) / srLR;
+            NekDouble URoe   = (uRoe * uRoe + vRoe * vRoe + wRoe * wRoe);
+            NekDouble cRoe   = sqrt((gamma - 1.0)*(hRoe - 0.5 * URoe));
+
+            // Compute eigenvectors (equation 11.59).
+            NekDouble k[5][5] = {
+                {1, uRoe - cRoe, vRoe, wRoe, hRoe - uRoe * cRoe},
+                {1, uRoe,        vRoe, wRoe, 0.5 * URoe},
+                {0, 0,           1,    0,    vRoe},
+                {0, 0,           0,    1,    wRoe},
+                {1, uRoe+cRoe,  vRoe,  wRoe, hRoe + uRoe*cRoe}
+            };
+
+            // Calculate jumps \Delta u_i (defined preceding equation 11.67).
+            NekDouble jump[5] = {
+                rhoR  - rhoL,
+                rhouR - rhouL,
+                rhovR - rhovL,
+                rhowR - rhowL,
+                ER    - EL
+            };
+
+            // Define \Delta u_5 (equation 11.70).
+            NekDouble jumpbar = jump[4] - (jump[2]-vRoe*jump[0])*vRoe -
+                (jump[3]-wRoe*jump[0])*wRoe;
+
+            // Compute wave amplitudes (equations 11.68, 11.69).
+            NekDouble alpha[5];
+            alpha[1] = (gamma-1.0)*(jump[0]*(hRoe - uRoe*uRoe) +
+                                    uRoe*jump[1] - jumpbar)/(cRoe*cRoe);
+            alpha[0] = (jump[0]*(uRoe + cRoe) - jump[1] - cRoe*alpha[1]) /
+                (2.0*cRoe);
+            alpha[4] = jump[0] - (alpha[0] + alpha[1]);
+            alpha[2] = jump[2] - vRoe * jump[0];
+            alpha[3] = jump[3] - wRoe * jump[0];
+
+            // Compute average of left and right fluxes needed for eq. 11.29.
+            NekDouble rhof  = 0.5*(rhoL*uL + rhoR*uR);
+            NekDouble rhouf = 0.5*(pL + rhoL*uL*uL + pR + rhoR*uR*uR);
+            NekDouble rhovf = 0.5*(rhoL*uL*vL + rhoR*uR*vR);
+            NekDouble rhowf = 0.5*(rhoL*uL*wL + rhoR*uR*wR);
+            NekDouble Ef    = 0.5*(uL*(EL + pL) + uR*(ER + pR));
+
+            // Compute eigenvalues \lambda_i (equation 11.58).
+            NekDouble uRoeAbs = fabs(uRoe);
+            NekDouble lambda[5] = {
+                fabs(uRoe - cRoe),
+                uRoeAbs,
+                uRoeAbs,
+                uRoeAbs,
+                fabs(uRoe + cRoe)
+            };
+
+            // Finally perform summation (11.29).
+            for (int j = 0; j < 5; ++j)
+            {
+                uRoeAbs = 0.5*alpha[j]*lambda[j];
+
+                rhof  -= uRoeAbs*k[j][0];
+                rhouf -= uRoeAbs*k[j][1];
+                rhovf -= uRoeAbs*k[j][2];
+                rhowf -= uRoeAbs*k[j][3];
+                Ef    -= uRoeAbs*k[j][4];
+            }
+
+            flux[0][i] = rhof;
+            flux[1][i] = rhouf;
+            flux[2][i] = rhovf;
+            flux[3][i] = rhowf;
+            flux[4][i] = Ef;
         }
     }
 }
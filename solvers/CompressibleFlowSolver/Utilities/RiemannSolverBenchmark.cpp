@@ -0,0 +1,233 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: RiemannSolverBenchmark.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Throughput benchmark of the compressible Riemann solvers,
+// comparing the batched and pointwise solution paths.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/BasicUtils/Timer.h>
+#include <LibUtilities/BasicUtils/Vmath.hpp>
+
+#include <CompressibleFlowSolver/RiemannSolvers/CompressibleSolver.h>
+
+using namespace std;
+using namespace Nektar;
+
+typedef Array<OneD, Array<OneD, NekDouble> > TraceField;
+
+// Parameters queried by the Riemann solvers.
+struct BenchmarkData
+{
+    NekDouble                                  gamma;
+    Array<OneD, const Array<OneD, NekDouble> > vecLocs;
+    Array<OneD, const Array<OneD, NekDouble> > normals;
+
+    NekDouble GetGamma()
+    {
+        return gamma;
+    }
+
+    const Array<OneD, const Array<OneD, NekDouble> > &GetVecLocs()
+    {
+        return vecLocs;
+    }
+
+    const Array<OneD, const Array<OneD, NekDouble> > &GetNormals()
+    {
+        return normals;
+    }
+};
+
+// Random subsonic states in conserved variables (rho, rhou, rhov, rhow, E).
+TraceField RandomStates(int npts, NekDouble gamma, std::mt19937 &gen)
+{
+    std::uniform_real_distribution<NekDouble> rhoDist(0.5, 1.5);
+    std::uniform_real_distribution<NekDouble> velDist(-0.5, 0.5);
+    std::uniform_real_distribution<NekDouble> pDist  (0.5, 1.5);
+
+    TraceField u(5);
+    for (int i = 0; i < 5; ++i)
+    {
+        u[i] = Array<OneD, NekDouble>(npts);
+    }
+
+    for (int i = 0; i < npts; ++i)
+    {
+        NekDouble rho = rhoDist(gen), p = pDist(gen), ke = 0.0;
+        u[0][i] = rho;
+        for (int j = 1; j < 4; ++j)
+        {
+            NekDouble vel = velDist(gen);
+            u[j][i] = rho * vel;
+            ke     += 0.5 * rho * vel * vel;
+        }
+        u[4][i] = p / (gamma - 1.0) + ke;
+    }
+
+    return u;
+}
+
+NekDouble TimeSolve(SolverUtils::RiemannSolverSharedPtr solver, int ntest,
+                    const TraceField &Fwd, const TraceField &Bwd,
+                    TraceField &flux)
+{
+    LibUtilities::Timer timer;
+
+    // Warm up, which also sets up the rotation storage.
+    solver->Solve(3, Fwd, Bwd, flux);
+
+    timer.Start();
+    for (int n = 0; n < ntest; ++n)
+    {
+        solver->Solve(3, Fwd, Bwd, flux);
+    }
+    timer.Stop();
+
+    return timer.TimePerTest(ntest);
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2 || argc > 4)
+    {
+        fprintf(stderr, "Usage: RiemannSolverBenchmark session.xml "
+                        "[npts] [ntest]\n");
+        exit(1);
+    }
+
+    LibUtilities::SessionReaderSharedPtr session =
+        LibUtilities::SessionReader::CreateInstance(2, argv);
+
+    int npts  = argc > 2 ? atoi(argv[2]) : 100000;
+    int ntest = argc > 3 ? atoi(argv[3]) : 100;
+
+    BenchmarkData data;
+    session->LoadParameter("Gamma", data.gamma, 1.4);
+
+    std::mt19937 gen(1);
+    TraceField Fwd = RandomStates(npts, data.gamma, gen);
+    TraceField Bwd = RandomStates(npts, data.gamma, gen);
+
+    // Random unit normals.
+    std::normal_distribution<NekDouble> normDist;
+    Array<OneD, Array<OneD, NekDouble> > normals(3);
+    for (int j = 0; j < 3; ++j)
+    {
+        normals[j] = Array<OneD, NekDouble>(npts);
+    }
+    for (int i = 0; i < npts; ++i)
+    {
+        NekDouble n[3], mag = 0.0;
+        for (int j = 0; j < 3; ++j)
+        {
+            n[j] = normDist(gen);
+            mag += n[j] * n[j];
+        }
+        for (int j = 0; j < 3; ++j)
+        {
+            normals[j][i] = n[j] / sqrt(mag);
+        }
+    }
+    data.normals = normals;
+
+    Array<OneD, Array<OneD, NekDouble> > vecLocs(1);
+    vecLocs[0] = Array<OneD, NekDouble>(3);
+    for (int j = 0; j < 3; ++j)
+    {
+        vecLocs[0][j] = j + 1;
+    }
+    data.vecLocs = vecLocs;
+
+    TraceField fluxPoint(5), fluxBatch(5);
+    for (int i = 0; i < 5; ++i)
+    {
+        fluxPoint[i] = Array<OneD, NekDouble>(npts, 0.0);
+        fluxBatch[i] = Array<OneD, NekDouble>(npts, 0.0);
+    }
+
+    const char *solvers[] = {"Roe", "HLLC", "HLL", "LaxFriedrichs",
+                             "AUSM0", "AUSM1", "AUSM2", "AUSM3",
+                             "ExactToro"};
+
+    cout << "Riemann solvers, npts = " << npts << ", ntest = " << ntest
+         << endl;
+    cout << setw(15) << "Solver"
+         << setw(15) << "Point (Mpt/s)"
+         << setw(15) << "Batch (Mpt/s)"
+         << setw(10) << "Speedup"
+         << setw(12) << "Max diff" << endl;
+
+    for (auto &name : solvers)
+    {
+        SolverUtils::RiemannSolverSharedPtr solver =
+            SolverUtils::GetRiemannSolverFactory().CreateInstance(
+                name, session);
+        solver->SetParam ("gamma",   &BenchmarkData::GetGamma,   &data);
+        solver->SetAuxVec("vecLocs", &BenchmarkData::GetVecLocs, &data);
+        solver->SetVector("N",       &BenchmarkData::GetNormals, &data);
+
+        std::shared_ptr<CompressibleSolver> compSolver =
+            std::dynamic_pointer_cast<CompressibleSolver>(solver);
+        ASSERTL0(compSolver, "Not a compressible Riemann solver.");
+
+        compSolver->SetBatchSolve(false);
+        NekDouble tPoint = TimeSolve(solver, ntest, Fwd, Bwd, fluxPoint);
+
+        compSolver->SetBatchSolve(true);
+        NekDouble tBatch = TimeSolve(solver, ntest, Fwd, Bwd, fluxBatch);
+
+        NekDouble maxErr = 0.0;
+        for (int i = 0; i < 5; ++i)
+        {
+            Vmath::Vsub(npts, fluxBatch[i], 1, fluxPoint[i], 1,
+                        fluxPoint[i], 1);
+            maxErr = max(maxErr, Vmath::Vamax(npts, fluxPoint[i], 1));
+        }
+
+        cout << setw(15) << name
+             << setw(15) << 1e-6 * npts / tPoint
+             << setw(15) << 1e-6 * npts / tBatch
+             << setw(10) << tPoint / tBatch
+             << setw(12) << maxErr << endl;
+    }
+
+    session->Finalise();
+
+    return 0;
+}
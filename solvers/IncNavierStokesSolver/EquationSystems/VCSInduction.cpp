@@ -0,0 +1,344 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File VCSInduction.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Velocity correction scheme coupled to the magnetic induction
+// equation (finite magnetic Reynolds number MHD)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <IncNavierStokesSolver/EquationSystems/VCSInduction.h>
+
+#include <boost/algorithm/string.hpp>
+
+using namespace std;
+
+namespace Nektar
+{
+    using namespace MultiRegions;
+
+    string VCSInduction::className =
+        SolverUtils::GetEquationSystemFactory().RegisterCreatorFunction(
+            "VCSInduction",
+            VCSInduction::create);
+
+    static const std::string kMagVarStr[] = {"Bx", "By", "Bz"};
+
+    /**
+     * Constructor. Creates ...
+     *
+     * \param
+     * \param
+     */
+    VCSInduction::VCSInduction(
+        const LibUtilities::SessionReaderSharedPtr& pSession,
+        const SpatialDomains::MeshGraphSharedPtr &pGraph)
+        : UnsteadySystem(pSession, pGraph),
+          VelocityCorrectionScheme(pSession, pGraph),
+          m_lorentzCoeff(1.0)
+    {
+
+    }
+
+    /**
+     * Destructor
+     */
+    VCSInduction::~VCSInduction(void)
+    {
+    }
+
+    /**
+     * The magnetic field components are convective fields, so that they
+     * must be listed after the velocity and have a DiffusionCoefficient
+     * (the magnetic diffusivity) defined. An auxiliary field 'psi', with
+     * homogeneous Neumann conditions, is used to project B onto a
+     * divergence-free field after each step.
+     */
+    void VCSInduction::v_InitObject()
+    {
+        VelocityCorrectionScheme::v_InitObject();
+
+        ASSERTL0(m_HomogeneousType == eNotHomogeneous,
+                 "VCSInduction does not support homogeneous expansions.");
+
+        int nvel    = m_velocity.num_elements();
+        int nfields = m_fields.num_elements();
+        int phystot = m_fields[0]->GetTotPoints();
+
+        m_magnetic = Array<OneD, int>(nvel, -1);
+        for (int i = 0; i < nvel; ++i)
+        {
+            for (int j = 0; j < nfields; ++j)
+            {
+                if (boost::iequals(m_session->GetVariable(j), kMagVarStr[i]))
+                {
+                    m_magnetic[i] = j;
+                    break;
+                }
+            }
+
+            ASSERTL0(m_magnetic[i] >= 0,
+                     "Variable '" + kMagVarStr[i] + "' must be defined.");
+            ASSERTL0(m_magnetic[i] < m_nConvectiveFields,
+                     "Variable '" + kMagVarStr[i] + "' requires a "
+                     "DiffusionCoefficient (magnetic diffusivity).");
+        }
+
+        for (int j = 0; j < nfields; ++j)
+        {
+            if (boost::iequals(m_session->GetVariable(j), "psi"))
+            {
+                m_psi = m_fields[j];
+            }
+        }
+        ASSERTL0(m_psi, "Variable 'psi' must be defined.");
+
+        m_session->LoadParameter("LorentzCoeff", m_lorentzCoeff, 1.0);
+
+        m_grad = Array<OneD, Array<OneD, NekDouble> >(nvel);
+        for (int i = 0; i < nvel; ++i)
+        {
+            m_grad[i] = Array<OneD, NekDouble>(phystot, 0.0);
+        }
+        m_divB = Array<OneD, NekDouble>(phystot, 0.0);
+    }
+
+    /**
+     *
+     */
+    void VCSInduction::v_GenerateSummary(SolverUtils::SummaryList& s)
+    {
+        VelocityCorrectionScheme::v_GenerateSummary(s);
+
+        SolverUtils::AddSummaryItem(s, "MHD",
+            "Induction equation (Lorentz coeff = "
+            + boost::lexical_cast<string>(m_lorentzCoeff) + ")");
+    }
+
+    /**
+     * Both the pressure and the divergence cleaning potential are only
+     * defined up to a constant.
+     */
+    Array<OneD, bool> VCSInduction::v_GetSystemSingularChecks()
+    {
+        Array<OneD, bool> vChecks =
+            VelocityCorrectionScheme::v_GetSystemSingularChecks();
+
+        for (int i = 0; i < vChecks.num_elements(); ++i)
+        {
+            if (boost::iequals(m_session->GetVariable(i), "psi"))
+            {
+                vChecks[i] = true;
+            }
+        }
+        return vChecks;
+    }
+
+    /**
+     * Reports the L2 norm of the divergence of the magnetic field every
+     * IO_InfoSteps steps.
+     */
+    bool VCSInduction::v_PostIntegrate(int step)
+    {
+        if (m_infosteps && !((step + 1) % m_infosteps))
+        {
+            int nvel    = m_velocity.num_elements();
+            int phystot = m_fields[0]->GetTotPoints();
+
+            m_fields[0]->PhysDeriv(eX, m_fields[m_magnetic[0]]->GetPhys(),
+                                   m_divB);
+            for (int i = 1; i < nvel; ++i)
+            {
+                m_fields[0]->PhysDeriv(DirCartesianMap[i],
+                                       m_fields[m_magnetic[i]]->GetPhys(),
+                                       m_grad[0]);
+                Vmath::Vadd(phystot, m_grad[0], 1, m_divB, 1, m_divB, 1);
+            }
+
+            NekDouble divB = m_fields[0]->L2(m_divB);
+            if (m_comm->GetRank() == 0)
+            {
+                cout << "L2 norm of div(B): " << divB << endl;
+            }
+        }
+
+        return VelocityCorrectionScheme::v_PostIntegrate(step);
+    }
+
+    /**
+     * Explicit part of the method - Advection, induction, Lorentz force,
+     * Forcing + HOPBCs
+     */
+    void VCSInduction::v_EvaluateAdvection_SetPressureBCs(
+        const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+        Array<OneD, Array<OneD, NekDouble> > &outarray,
+        const NekDouble time)
+    {
+        EvaluateAdvectionTerms(inarray, outarray);
+
+        // Smooth advection
+        if(m_SmoothAdvection)
+        {
+            for(int i = 0; i < m_nConvectiveFields; ++i)
+            {
+                m_pressure->SmoothField(outarray[i]);
+            }
+        }
+
+        // Add stretching and Lorentz terms before the pressure boundary
+        // conditions are evaluated from the explicit terms
+        AddInductionTerms(inarray, outarray);
+
+        // Add forcing terms
+        for (auto &x : m_forcing)
+        {
+            x->Apply(m_fields, inarray, outarray, time);
+        }
+
+        // Calculate High-Order pressure boundary conditions
+        m_extrapolation->EvaluatePressureBCs(inarray,outarray,m_kinvis);
+    }
+
+    /**
+     * Adds \f$ (\boldsymbol{B}\cdot\nabla)\boldsymbol{u} \f$ to the induction
+     * equation and \f$ S (\boldsymbol{B}\cdot\nabla)\boldsymbol{B} \f$ to the
+     * momentum equation.
+     */
+    void VCSInduction::AddInductionTerms(
+        const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+        Array<OneD, Array<OneD, NekDouble> > &outarray)
+    {
+        int nvel    = m_velocity.num_elements();
+        int phystot = m_fields[0]->GetTotPoints();
+
+        for (int i = 0; i < nvel; ++i)
+        {
+            // Stretching term for B_i
+            if (nvel == 2)
+            {
+                m_fields[0]->PhysDeriv(inarray[m_velocity[i]],
+                                       m_grad[0], m_grad[1]);
+            }
+            else
+            {
+                m_fields[0]->PhysDeriv(inarray[m_velocity[i]],
+                                       m_grad[0], m_grad[1], m_grad[2]);
+            }
+
+            for (int j = 0; j < nvel; ++j)
+            {
+                Vmath::Vvtvp(phystot, inarray[m_magnetic[j]], 1,
+                             m_grad[j], 1, outarray[m_magnetic[i]], 1,
+                             outarray[m_magnetic[i]], 1);
+            }
+
+            // Lorentz force on u_i
+            if (nvel == 2)
+            {
+                m_fields[0]->PhysDeriv(inarray[m_magnetic[i]],
+                                       m_grad[0], m_grad[1]);
+            }
+            else
+            {
+                m_fields[0]->PhysDeriv(inarray[m_magnetic[i]],
+                                       m_grad[0], m_grad[1], m_grad[2]);
+            }
+
+            Vmath::Vmul(phystot, inarray[m_magnetic[0]], 1, m_grad[0], 1,
+                        m_divB, 1);
+            for (int j = 1; j < nvel; ++j)
+            {
+                Vmath::Vvtvp(phystot, inarray[m_magnetic[j]], 1,
+                             m_grad[j], 1, m_divB, 1, m_divB, 1);
+            }
+            Vmath::Svtvp(phystot, m_lorentzCoeff, m_divB, 1,
+                         outarray[m_velocity[i]], 1,
+                         outarray[m_velocity[i]], 1);
+        }
+    }
+
+    /**
+     * Solve the velocity and magnetic diffusion systems with the viscous
+     * step of the velocity correction scheme, then project the magnetic
+     * field onto a divergence-free field.
+     */
+    void VCSInduction::v_SolveViscous(
+        const Array<OneD, const Array<OneD, NekDouble> > &Forcing,
+        Array<OneD, Array<OneD, NekDouble> > &outarray,
+        const NekDouble aii_Dt)
+    {
+        VelocityCorrectionScheme::v_SolveViscous(Forcing, outarray, aii_Dt);
+
+        CleanDivergence(outarray);
+    }
+
+    /**
+     * Projects the magnetic field onto a divergence-free field by solving
+     * \f$ \nabla^2 \psi = \nabla\cdot\boldsymbol{B} \f$ and subtracting
+     * \f$ \nabla\psi \f$ from \f$ \boldsymbol{B} \f$.
+     */
+    void VCSInduction::CleanDivergence(
+        Array<OneD, Array<OneD, NekDouble> > &outarray)
+    {
+        int nvel    = m_velocity.num_elements();
+        int phystot = m_fields[0]->GetTotPoints();
+
+        m_fields[0]->PhysDeriv(eX, outarray[m_magnetic[0]], m_divB);
+        for (int i = 1; i < nvel; ++i)
+        {
+            // Use m_grad[0] as storage since it is overwritten below
+            m_fields[0]->PhysDeriv(DirCartesianMap[i], outarray[m_magnetic[i]],
+                                   m_grad[0]);
+            Vmath::Vadd(phystot, m_grad[0], 1, m_divB, 1, m_divB, 1);
+        }
+
+        StdRegions::ConstFactorMap factors;
+        factors[StdRegions::eFactorLambda] = 0.0;
+
+        m_psi->HelmSolve(m_divB, m_psi->UpdateCoeffs(), NullFlagList, factors);
+        m_psi->BwdTrans(m_psi->GetCoeffs(), m_psi->UpdatePhys());
+
+        if (nvel == 2)
+        {
+            m_psi->PhysDeriv(m_psi->GetPhys(), m_grad[0], m_grad[1]);
+        }
+        else
+        {
+            m_psi->PhysDeriv(m_psi->GetPhys(), m_grad[0], m_grad[1], m_grad[2]);
+        }
+
+        for (int i = 0; i < nvel; ++i)
+        {
+            Vmath::Vsub(phystot, outarray[m_magnetic[i]], 1, m_grad[i], 1,
+                        outarray[m_magnetic[i]], 1);
+        }
+    }
+
+} //end of namespace
@@ -0,0 +1,126 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File VCSInduction.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Velocity correction scheme coupled to the magnetic induction
+// equation (finite magnetic Reynolds number MHD)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef NEKTAR_SOLVERS_VCSINDUCTION_H
+#define NEKTAR_SOLVERS_VCSINDUCTION_H
+
+#include <IncNavierStokesSolver/EquationSystems/VelocityCorrectionScheme.h>
+
+namespace Nektar
+{
+    /**
+     * Velocity correction scheme for incompressible MHD at finite magnetic
+     * Reynolds number. The magnetic field components Bx, By (and Bz) are
+     * advanced as convective fields alongside the velocity: the advection
+     * term \f$ -(\boldsymbol{u}\cdot\nabla)\boldsymbol{B} \f$ is computed by
+     * the advection object, the stretching term
+     * \f$ (\boldsymbol{B}\cdot\nabla)\boldsymbol{u} \f$ and the Lorentz force
+     * \f$ S (\boldsymbol{B}\cdot\nabla)\boldsymbol{B} \f$ are added
+     * explicitly, and the magnetic diffusion uses the same Helmholtz solves
+     * as the viscous step. The magnetic pressure is absorbed into p.
+     */
+    class VCSInduction: public VelocityCorrectionScheme
+    {
+    public:
+
+        /// Creates an instance of this class
+        static SolverUtils::EquationSystemSharedPtr create(
+            const LibUtilities::SessionReaderSharedPtr& pSession,
+            const SpatialDomains::MeshGraphSharedPtr &pGraph)
+        {
+            SolverUtils::EquationSystemSharedPtr p =
+                MemoryManager<VCSInduction>::AllocateSharedPtr(
+                    pSession, pGraph);
+            p->InitObject();
+            return p;
+        }
+
+        /// Name of class
+        static std::string className;
+
+        /// Constructor.
+        VCSInduction(const LibUtilities::SessionReaderSharedPtr& pSession,
+                     const SpatialDomains::MeshGraphSharedPtr &pGraph);
+
+        virtual ~VCSInduction();
+
+        virtual void v_InitObject();
+
+    protected:
+        /// Indices of the magnetic field components in m_fields
+        Array<OneD, int> m_magnetic;
+        /// Auxiliary field used for the divergence cleaning of B
+        MultiRegions::ExpListSharedPtr m_psi;
+        /// Coefficient of the Lorentz force in the momentum equation
+        NekDouble m_lorentzCoeff;
+        /// Workspace holding the gradient of one field component
+        Array<OneD, Array<OneD, NekDouble> > m_grad;
+        /// Workspace for the divergence cleaning
+        Array<OneD, NekDouble> m_divB;
+
+        void AddInductionTerms(
+                    const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                    Array<OneD, Array<OneD, NekDouble> > &outarray);
+
+        void CleanDivergence(Array<OneD, Array<OneD, NekDouble> > &outarray);
+
+        // Virtual functions
+        virtual void v_GenerateSummary(SolverUtils::SummaryList& s);
+
+        virtual Array<OneD, bool> v_GetSystemSingularChecks();
+
+        virtual bool v_PostIntegrate(int step);
+
+        virtual void v_EvaluateAdvection_SetPressureBCs(
+                    const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                    Array<OneD, Array<OneD, NekDouble> > &outarray,
+                    const NekDouble time);
+
+        virtual void v_SolveViscous(
+                    const Array<OneD, const Array<OneD, NekDouble> > &Forcing,
+                    Array<OneD, Array<OneD, NekDouble> > &outarray,
+                    const NekDouble aii_Dt);
+
+    private:
+
+    };
+
+    typedef std::shared_ptr<VCSInduction> VCSInductionSharedPtr;
+
+} //end of namespace
+
+
+#endif //NEKTAR_SOLVERS_VCSINDUCTION_H
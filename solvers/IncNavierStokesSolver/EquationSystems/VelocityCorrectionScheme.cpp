@@ -673,13 +673,19 @@ namespace Nektar
         SetUpPressureForcing(inarray, m_F, aii_Dt);
 
         // Solve Pressure System
-        SolvePressure (m_F[0]);
+        {
+            LibUtilities::TimerRegion region("SolvePressure");
+            SolvePressure (m_F[0]);
+        }
 
         // Set up forcing term for Helmholtz problems
         SetUpViscousForcing(inarray, m_F, aii_Dt);
 
         // Solve velocity system
-        SolveViscous( m_F, outarray, aii_Dt);
+        {
+            LibUtilities::TimerRegion region("SolveViscous");
+            SolveViscous( m_F, outarray, aii_Dt);
+        }
 
         // Apply flowrate correction
         if (m_flowrate > 0.0 && m_greenFlux != numeric_limits<NekDouble>::max())
@@ -33,8 +33,13 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <boost/core/ignore_unused.hpp>
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/regex.hpp>
 
 #include <IncNavierStokesSolver/Forcing/ForcingMagnetic.h>
+#include <LibUtilities/BasicUtils/Timer.h>
 
 namespace Nektar
 {
@@ -49,7 +54,12 @@ namespace SolverUtils
     ForcingMagnetic::ForcingMagnetic(
             const LibUtilities::SessionReaderSharedPtr &pSession,
             const std::weak_ptr<EquationSystem>      &pEquation)
-        : Forcing(pSession, pEquation)
+        : Forcing(pSession, pEquation),
+          m_magneticFieldTimeDependent(false),
+          m_magneticFieldUpdateInterval(0.0),
+          m_magneticFieldLastUpdate(0.0),
+          m_phiUpdateFreq(1),
+          m_index(0)
     {
     }
 
@@ -122,11 +132,45 @@ namespace SolverUtils
         m_magneticField = Array<OneD, Array<OneD, NekDouble> > (magdim);
         for (int i = 0; i < magdim; ++i)
         {
-//             std::string s_FieldStr = kMagFieldStr[i];
             m_magneticField[i] = Array<OneD, NekDouble> (phystot, 0.0);
-//             GetFunction(pFields, m_session, m_magneticFieldFuncName)->Evaluate(s_FieldStr, m_magneticField[i]);
         }
-        updateMagneticField(pFields,0.0);
+
+//         By default the magnetic field is re-evaluated only if one of its
+//         components depends on time. This may be overridden explicitly
+//         with the MAGNETICFIELDTIMEDEPENDENT tag.
+        const TiXmlElement* timeDepElmt =
+            pForce->FirstChildElement("MAGNETICFIELDTIMEDEPENDENT");
+        if (timeDepElmt)
+        {
+            std::string timeDepValue = timeDepElmt->GetText();
+            boost::algorithm::trim(timeDepValue);
+            m_magneticFieldTimeDependent =
+                boost::iequals(timeDepValue, "true") || timeDepValue == "1";
+        }
+        else
+        {
+            m_magneticFieldTimeDependent = isMagneticFieldTimeDependent();
+        }
+
+//         Optional minimum time interval between two evaluations of a
+//         time-dependent field. Default is 0 (evaluate at every call).
+        const TiXmlElement* intervalElmt =
+            pForce->FirstChildElement("MAGNETICFIELDUPDATEINTERVAL");
+        if (intervalElmt)
+        {
+            std::string intervalValue = intervalElmt->GetText();
+            boost::algorithm::trim(intervalValue);
+            m_magneticFieldUpdateInterval =
+                boost::lexical_cast<NekDouble>(intervalValue);
+        }
+
+//         Evaluate the field once; a steady field is never evaluated again.
+        for (int i = 0; i < magdim; ++i)
+        {
+            GetFunction(pFields, m_session, m_magneticFieldFuncName, true)->
+                Evaluate(kMagFieldStr[i], m_magneticField[i], 0.0);
+        }
+        m_magneticFieldLastUpdate = 0.0;
         
         if(!m_2D){
             int numfields = m_equ.lock()->UpdateFields().num_elements();
@@ -142,12 +186,40 @@ namespace SolverUtils
             }
             ASSERTL0(findphi,"Variable 'phi' must be defined.");
         }
+
+//         Optional number of forcing evaluations between two solves of the
+//         electric potential. The potential and its gradient are frozen in
+//         between, which is acceptable when the Stuart number is small.
+//         Default is 1 (solve at every evaluation).
+        const TiXmlElement* phiFreqElmt =
+            pForce->FirstChildElement("PHIUPDATEFREQ");
+        if (phiFreqElmt)
+        {
+            std::string phiFreqValue = phiFreqElmt->GetText();
+            boost::algorithm::trim(phiFreqValue);
+            m_phiUpdateFreq = boost::lexical_cast<int>(phiFreqValue);
+            ASSERTL0(m_phiUpdateFreq > 0,
+                     "PHIUPDATEFREQ must be a positive integer.");
+        }
         
         m_Forcing = Array<OneD, Array<OneD, NekDouble> > (m_NumVariable);
         for (int i = 0; i < m_NumVariable; ++i)
         {
             m_Forcing[i] = Array<OneD, NekDouble> (phystot, 0.0);
         }
+
+        if (!m_2D)
+        {
+            int dim = 3;
+            m_productVB = Array<OneD, Array<OneD, NekDouble> > (dim);
+            m_gradPhi   = Array<OneD, Array<OneD, NekDouble> > (dim);
+            for (int i = 0; i < dim; ++i)
+            {
+                m_productVB[i] = Array<OneD, NekDouble> (phystot, 0.0);
+                m_gradPhi[i]   = Array<OneD, NekDouble> (phystot, 0.0);
+            }
+            m_rhs = Array<OneD, NekDouble> (phystot, 0.0);
+        }
         
         Array<OneD, Array<OneD, NekDouble> > tempfields(pFields.num_elements());
         for (int i = 0; i < m_NumVariable; ++i)
@@ -159,15 +231,57 @@ namespace SolverUtils
         
     }
     
+    /**
+     * @brief Determine whether any component of the magnetic field function
+     * has to be re-evaluated in time.
+     *
+     * Fields read from .fld/.pts files are steady, transient files are not.
+     * Expressions are time-dependent if they reference the variable \a t.
+     */
+    bool ForcingMagnetic::isMagneticFieldTimeDependent()
+    {
+        static const boost::regex timeVar("(^|[^A-Za-z0-9_])t([^A-Za-z0-9_]|$)");
+
+        for (int i = 0; i < m_magneticField.num_elements(); ++i)
+        {
+            LibUtilities::FunctionType vType = m_session->GetFunctionType(
+                m_magneticFieldFuncName, kMagFieldStr[i]);
+
+            if (vType == LibUtilities::eFunctionTypeTransientFile)
+            {
+                return true;
+            }
+            else if (vType == LibUtilities::eFunctionTypeExpression)
+            {
+                std::string expr = m_session->GetFunction(
+                    m_magneticFieldFuncName, kMagFieldStr[i])->GetExpression();
+                if (boost::regex_search(expr, timeVar))
+                {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
     void ForcingMagnetic::updateMagneticField(
             const Array< OneD, MultiRegions::ExpListSharedPtr > &pFields,
             const NekDouble &time)
     {
+//         Steady fields are evaluated once in v_InitObject.
+        if (!m_magneticFieldTimeDependent ||
+            time - m_magneticFieldLastUpdate < m_magneticFieldUpdateInterval)
+        {
+            return;
+        }
+
         for (int i = 0; i < m_magneticField.num_elements(); ++i)
         {
-            std::string s_FieldStr = kMagFieldStr[i]; 
-            GetFunction(pFields, m_session, m_magneticFieldFuncName)->Evaluate(s_FieldStr, m_magneticField[i],time);
+            GetFunction(pFields, m_session, m_magneticFieldFuncName, true)->
+                Evaluate(kMagFieldStr[i], m_magneticField[i], time);
         }
+        m_magneticFieldLastUpdate = time;
     }
 
     void ForcingMagnetic::v_Apply(
@@ -193,71 +307,48 @@ namespace SolverUtils
             const NekDouble &time)
     {
         int phystot = pFields[0]->GetTotPoints();
-        int i,j;
-        
+
         updateMagneticField(pFields,time);
-        
+
         if(m_2D)
         {
 //             Calculates $\sigma(\boldsymbol{v} \times \boldsymbol{B}_0)\times \boldsymbol{B}_0$
 //             in the case $\boldsymbol{B}_0 = (B_x,B_y,0)$ and $\boldsymbol{v} = (u,v,0)$
-            Array<OneD, NekDouble> tempvalue = Array<OneD, NekDouble>(phystot, 0.0);
-//             $F_x = - B_{y} \left(- B_{x} v + B_{y} u\right)$
-            Vmath::Vmul(phystot,m_magneticField[0],1,inarray[1],1,tempvalue,1);
-            Vmath::Vvtvm(phystot,m_magneticField[1],1,inarray[0],1,tempvalue,1,tempvalue,1);
-            Vmath::Vmul(phystot,m_magneticField[1],1,tempvalue,1,tempvalue,1);
-            Vmath::Smul(phystot,-1.0*m_conductivity,tempvalue,1,m_Forcing[0],1);
-//             $F_y = B_{x} \left(- B_{x} v + B_{y} u\right)$
-            Vmath::Vmul(phystot,m_magneticField[0],1,inarray[1],1,tempvalue,1);
-            Vmath::Vvtvm(phystot,m_magneticField[1],1,inarray[0],1,tempvalue,1,tempvalue,1);
-            Vmath::Vmul(phystot,m_magneticField[0],1,tempvalue,1,tempvalue,1);
-            Vmath::Smul(phystot,m_conductivity,tempvalue,1,m_Forcing[1],1);
-
+            LorentzForce2D(phystot, m_conductivity,
+                           inarray[0].get(), inarray[1].get(),
+                           m_magneticField[0].get(), m_magneticField[1].get(),
+                           m_Forcing[0].get(), m_Forcing[1].get());
             return;
         }
-        
-        updatePhi(pFields,inarray,time);
-        
-        int dim = 3;
-        Array<OneD, Array<OneD, NekDouble> > tempvalue(dim),tempvalue2(dim);
-        for(int i = 0; i < dim; i++)
+
+        // Sub-cycling: the potential and its gradient from the last solve
+        // are reused in between updates.
+        if (m_index++ % m_phiUpdateFreq == 0)
         {
-            tempvalue[i] = Array<OneD, NekDouble>(phystot, 0.0);
-            tempvalue2[i] = Array<OneD, NekDouble>(phystot, 0.0);
+            updatePhi(pFields,inarray,time);
+
+            m_phi->PhysDeriv(m_phi->GetPhys(),
+                             m_gradPhi[0], m_gradPhi[1], m_gradPhi[2]);
         }
-        
-        VectorProduct(inarray, m_magneticField,tempvalue);
-        
+
         NekDouble gradsign = -1.0;
         if(m_adjoint)
         {
             gradsign = 1.0;
         }
-        
-        Array<OneD, NekDouble> gradphi_i = Array<OneD, NekDouble>(phystot, 0.0);
-        for(int i = 0; i < dim; i++)
-        {
-            m_phi->PhysDeriv(i, m_phi->GetPhys(), gradphi_i);
-            Vmath::Svtvp(phystot,gradsign,gradphi_i,1,tempvalue[i],1,tempvalue[i],1);
-        }
-         
-        VectorProduct(tempvalue, m_magneticField,tempvalue2);
-        
-        for(int i = 0; i < dim; i++)
-        {
-            Vmath::Smul(phystot,m_conductivity,tempvalue2[i],1,m_Forcing[i],1);
-        }
-        
-        return;
-        
+
+        LorentzForce3D(phystot, m_conductivity, gradsign, inarray,
+                       m_magneticField, m_gradPhi, m_Forcing);
     }
-    
-    
+
+
     void ForcingMagnetic::updatePhi(
             const Array< OneD, MultiRegions::ExpListSharedPtr > &pFields,
             const Array<OneD, Array<OneD, NekDouble> > &inarray,
             const NekDouble &time)
     {
+        boost::ignore_unused(time);
+
         StdRegions::ConstFactorMap factors;
         // Setup coefficient for equation
         factors[StdRegions::eFactorLambda] = 0.0;
@@ -265,47 +356,103 @@ namespace SolverUtils
         int phystot = pFields[0]->GetTotPoints();
         int dim = 3;
 
-        Array<OneD, Array<OneD, NekDouble> > productVB(dim);
-        for(int i = 0; i < dim; i++){
-           productVB[i] = Array<OneD, NekDouble>(phystot, 0.0);
-        }
-
 //      Calculate $\nabla \cdot \left( \boldsymbol{v} \times \boldsymbol{B}_0 \right)$
-        VectorProduct(inarray, m_magneticField, productVB);
-        Array<OneD, NekDouble> rhs(phystot, 0.0), div_i(phystot, 0.0);
-        for(int i = 0; i < dim; i++){
-           pFields[0]->PhysDeriv(i, productVB[i], div_i);
-           Vmath::Vadd(phystot, rhs, 1, div_i, 1, rhs, 1);
+        VectorProduct(phystot, inarray, m_magneticField, m_productVB);
+
+        // m_gradPhi is only used as scratch space here; it is overwritten
+        // with the gradient of the new potential in Update.
+        pFields[0]->PhysDeriv(0, m_productVB[0], m_rhs);
+        for(int i = 1; i < dim; i++){
+           pFields[0]->PhysDeriv(i, m_productVB[i], m_gradPhi[0]);
+           Vmath::Vadd(phystot, m_rhs, 1, m_gradPhi[0], 1, m_rhs, 1);
         }
-        
+
         if(m_adjoint)
         {
-            Vmath::Neg(phystot, rhs, 1);
+            Vmath::Neg(phystot, m_rhs, 1);
         }
-                
-        m_phi->HelmSolve(rhs, m_phi->UpdateCoeffs(), NullFlagList, factors);
+
+        // The coefficients of m_phi still hold the previous potential. They
+        // are passed in as the initial guess of the solve, so that the
+        // iterative static condensation solvers only solve for the
+        // correction to the previous potential. Successive RHS
+        // projection may be enabled for 'phi' alone through the SuccessiveRHS
+        // property of GLOBALSYSSOLNINFO.
+        LibUtilities::TimerRegion region("SolvePhi");
+        m_phi->HelmSolve(m_rhs, m_phi->UpdateCoeffs(), NullFlagList, factors);
         m_phi->BwdTrans(m_phi->GetCoeffs(), m_phi->UpdatePhys());
     }
 
-// Calculate the vector product of inarray1 and inarray2  
-    void ForcingMagnetic::VectorProduct(
-        const Array<OneD,const Array<OneD, NekDouble> > &inarray1,
-        const Array<OneD,const Array<OneD, NekDouble> > &inarray2,
-        Array<OneD, Array<OneD, NekDouble> > &outarray)
+    void ForcingMagnetic::LorentzForce2D(
+            const int        npts,
+            const NekDouble  sigma,
+            const NekDouble *u,
+            const NekDouble *v,
+            const NekDouble *bx,
+            const NekDouble *by,
+                  NekDouble *fx,
+                  NekDouble *fy)
     {
+        for (int i = 0; i < npts; ++i)
+        {
+//             $(\boldsymbol{v} \times \boldsymbol{B}_0)_z = u B_y - v B_x$
+            NekDouble vbz = u[i] * by[i] - v[i] * bx[i];
+            fx[i] = -sigma * by[i] * vbz;
+            fy[i] =  sigma * bx[i] * vbz;
+        }
+    }
 
-        unsigned int np = inarray1[0].num_elements();
-        Array<OneD, NekDouble> temp(np, 0.0);
+    void ForcingMagnetic::LorentzForce3D(
+            const int                                     npts,
+            const NekDouble                               sigma,
+            const NekDouble                               gradsign,
+            const Array<OneD, const Array<OneD, NekDouble> > &vel,
+            const Array<OneD, const Array<OneD, NekDouble> > &mag,
+            const Array<OneD, const Array<OneD, NekDouble> > &gradphi,
+                  Array<OneD, Array<OneD, NekDouble> >       &force)
+    {
+        const NekDouble *u  = vel[0].get(),     *v  = vel[1].get(),
+                        *w  = vel[2].get();
+        const NekDouble *bx = mag[0].get(),     *by = mag[1].get(),
+                        *bz = mag[2].get();
+        const NekDouble *gx = gradphi[0].get(), *gy = gradphi[1].get(),
+                        *gz = gradphi[2].get();
+        NekDouble *fx = force[0].get(), *fy = force[1].get(),
+                  *fz = force[2].get();
 
-        Vmath::Vmul(np, inarray1[2], 1, inarray2[1], 1, temp, 1);
-        Vmath::Vvtvm(np, inarray1[1], 1, inarray2[2], 1, temp, 1, outarray[0], 1);
+        for (int i = 0; i < npts; ++i)
+        {
+            // Electric field $\boldsymbol{v} \times \boldsymbol{B} + s \nabla \varphi$
+            NekDouble ex = v[i] * bz[i] - w[i] * by[i] + gradsign * gx[i];
+            NekDouble ey = w[i] * bx[i] - u[i] * bz[i] + gradsign * gy[i];
+            NekDouble ez = u[i] * by[i] - v[i] * bx[i] + gradsign * gz[i];
 
-        Vmath::Vmul(np, inarray1[0], 1, inarray2[2], 1, temp, 1);
-        Vmath::Vvtvm(np, inarray1[2], 1, inarray2[0], 1, temp, 1, outarray[1], 1);
+            fx[i] = sigma * (ey * bz[i] - ez * by[i]);
+            fy[i] = sigma * (ez * bx[i] - ex * bz[i]);
+            fz[i] = sigma * (ex * by[i] - ey * bx[i]);
+        }
+    }
 
-        Vmath::Vmul(np, inarray1[1], 1, inarray2[0], 1, temp, 1);
-        Vmath::Vvtvm(np, inarray1[0], 1, inarray2[1], 1, temp, 1, outarray[2], 1);
+// Calculate the vector product of inarray1 and inarray2
+    void ForcingMagnetic::VectorProduct(
+            const int                                     npts,
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray1,
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray2,
+                  Array<OneD, Array<OneD, NekDouble> >       &outarray)
+    {
+        const NekDouble *a0 = inarray1[0].get(), *a1 = inarray1[1].get(),
+                        *a2 = inarray1[2].get();
+        const NekDouble *b0 = inarray2[0].get(), *b1 = inarray2[1].get(),
+                        *b2 = inarray2[2].get();
+        NekDouble *c0 = outarray[0].get(), *c1 = outarray[1].get(),
+                  *c2 = outarray[2].get();
 
+        for (int i = 0; i < npts; ++i)
+        {
+            c0[i] = a1[i] * b2[i] - a2[i] * b1[i];
+            c1[i] = a2[i] * b0[i] - a0[i] * b2[i];
+            c2[i] = a0[i] * b1[i] - a1[i] * b0[i];
+        }
     }
 }
 }
@@ -88,6 +88,38 @@ namespace SolverUtils
             SOLVER_UTILS_EXPORT Array<OneD, Array<OneD, NekDouble> >&
                         UpdateForces();
 
+            /// Lorentz force \f$ \sigma (\boldsymbol{v} \times
+            /// \boldsymbol{B}) \times \boldsymbol{B} \f$ for an in-plane
+            /// 2D velocity and magnetic field, in a single sweep.
+            SOLVER_UTILS_EXPORT static void LorentzForce2D(
+                    const int        npts,
+                    const NekDouble  sigma,
+                    const NekDouble *u,
+                    const NekDouble *v,
+                    const NekDouble *bx,
+                    const NekDouble *by,
+                          NekDouble *fx,
+                          NekDouble *fy);
+
+            /// Lorentz force \f$ \sigma (\boldsymbol{v} \times
+            /// \boldsymbol{B} + s \nabla \varphi) \times \boldsymbol{B}
+            /// \f$ in a single sweep.
+            SOLVER_UTILS_EXPORT static void LorentzForce3D(
+                    const int                                     npts,
+                    const NekDouble                               sigma,
+                    const NekDouble                               gradsign,
+                    const Array<OneD, const Array<OneD, NekDouble> > &vel,
+                    const Array<OneD, const Array<OneD, NekDouble> > &mag,
+                    const Array<OneD, const Array<OneD, NekDouble> > &gradphi,
+                          Array<OneD, Array<OneD, NekDouble> >       &force);
+
+            /// Pointwise vector product of inarray1 and inarray2.
+            SOLVER_UTILS_EXPORT static void VectorProduct(
+                    const int                                     npts,
+                    const Array<OneD, const Array<OneD, NekDouble> > &inarray1,
+                    const Array<OneD, const Array<OneD, NekDouble> > &inarray2,
+                          Array<OneD, Array<OneD, NekDouble> >       &outarray);
+
         protected:
             SOLVER_UTILS_EXPORT virtual void v_InitObject(
                     const Array<OneD, MultiRegions::ExpListSharedPtr>& pFields,
@@ -111,7 +143,25 @@ namespace SolverUtils
             Array<OneD, Array<OneD, NekDouble> > m_magneticField;
             MultiRegions::ExpListSharedPtr m_phi;
             bool m_2D, m_adjoint;
-            
+            /// True if the magnetic field has to be re-evaluated in time
+            bool            m_magneticFieldTimeDependent;
+            /// Minimum time between two evaluations of a time-dependent field
+            NekDouble       m_magneticFieldUpdateInterval;
+            /// Time of the last evaluation of the magnetic field
+            NekDouble       m_magneticFieldLastUpdate;
+            /// Workspace holding \f$ \boldsymbol{v} \times \boldsymbol{B} \f$
+            Array<OneD, Array<OneD, NekDouble> > m_productVB;
+            /// Workspace holding \f$ \nabla \varphi \f$
+            Array<OneD, Array<OneD, NekDouble> > m_gradPhi;
+            /// Workspace for the right-hand side of the potential equation
+            Array<OneD, NekDouble> m_rhs;
+            /// Number of forcing evaluations between two potential solves
+            int             m_phiUpdateFreq;
+            /// Number of forcing evaluations since the start of the run
+            int             m_index;
+
+            bool isMagneticFieldTimeDependent();
+
             void updateMagneticField(
                     const Array< OneD, MultiRegions::ExpListSharedPtr > &pFields,
                     const NekDouble &time);
@@ -125,12 +175,6 @@ namespace SolverUtils
             const Array< OneD, MultiRegions::ExpListSharedPtr > &pFields,
             const Array<OneD, Array<OneD, NekDouble> > &inarray,
             const NekDouble &time);
-            
-            // Calculate the vector product of inarray1 and inarray2
-            void VectorProduct(
-                    const Array<OneD,const Array<OneD, NekDouble> > &inarray1,
-                    const Array<OneD,const Array<OneD, NekDouble> > &inarray2,
-                    Array<OneD, Array<OneD, NekDouble> > &outarray);
 
     };
 
@@ -0,0 +1,26 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Hartmann flow, Ha=2, VCSInduction against the analytic profile</description>
+    <executable>IncNavierStokesSolver</executable>
+    <parameters>HartmannFlow_VCSInduction.xml</parameters>
+    <files>
+        <file description="Session File">HartmannFlow_VCSInduction.xml</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="u" tolerance="1e-5">0</value>
+            <value variable="v" tolerance="1e-5">0</value>
+            <value variable="Bx" tolerance="1e-5">0</value>
+            <value variable="By" tolerance="1e-5">0</value>
+            <value variable="p" tolerance="1e-4">0</value>
+        </metric>
+        <metric type="regex" id="2">
+            <regex>^L2 norm of div\(B\): (.+)</regex>
+            <matches>
+                <match>
+                    <field id="0" tolerance="1e-6">0</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
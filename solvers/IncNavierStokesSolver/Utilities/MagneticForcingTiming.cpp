@@ -0,0 +1,168 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: MagneticForcingTiming.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Micro-benchmark of the pointwise Lorentz force kernels of
+// ForcingMagnetic against the equivalent sequence of Vmath calls.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/BasicUtils/Timer.h>
+#include <LibUtilities/BasicUtils/VmathArray.hpp>
+
+#include <IncNavierStokesSolver/Forcing/ForcingMagnetic.h>
+
+using namespace std;
+using namespace Nektar;
+using namespace Nektar::SolverUtils;
+
+typedef Array<OneD, Array<OneD, NekDouble> > VecField;
+
+// Vector product using one Vmath pass per operation, with a temporary.
+void VmathVectorProduct(
+    const Array<OneD, const Array<OneD, NekDouble> > &in1,
+    const Array<OneD, const Array<OneD, NekDouble> > &in2,
+    VecField                                         &out)
+{
+    unsigned int np = in1[0].num_elements();
+    Array<OneD, NekDouble> temp(np, 0.0);
+
+    Vmath::Vmul (np, in1[2], 1, in2[1], 1, temp, 1);
+    Vmath::Vvtvm(np, in1[1], 1, in2[2], 1, temp, 1, out[0], 1);
+
+    Vmath::Vmul (np, in1[0], 1, in2[2], 1, temp, 1);
+    Vmath::Vvtvm(np, in1[2], 1, in2[0], 1, temp, 1, out[1], 1);
+
+    Vmath::Vmul (np, in1[1], 1, in2[0], 1, temp, 1);
+    Vmath::Vvtvm(np, in1[0], 1, in2[1], 1, temp, 1, out[2], 1);
+}
+
+// Lorentz force built from separate Vmath passes and fresh temporaries.
+void VmathLorentzForce3D(
+    const int        npts,
+    const NekDouble  sigma,
+    const NekDouble  gradsign,
+    const VecField  &vel,
+    const VecField  &mag,
+    const VecField  &gradphi,
+    VecField        &force)
+{
+    VecField tempvalue(3), tempvalue2(3);
+    for (int i = 0; i < 3; ++i)
+    {
+        tempvalue[i]  = Array<OneD, NekDouble>(npts, 0.0);
+        tempvalue2[i] = Array<OneD, NekDouble>(npts, 0.0);
+    }
+
+    VmathVectorProduct(vel, mag, tempvalue);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        Vmath::Svtvp(npts, gradsign, gradphi[i], 1, tempvalue[i], 1,
+                     tempvalue[i], 1);
+    }
+
+    VmathVectorProduct(tempvalue, mag, tempvalue2);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        Vmath::Smul(npts, sigma, tempvalue2[i], 1, force[i], 1);
+    }
+}
+
+VecField RandomField(int npts, int seed)
+{
+    VecField f(3);
+    for (int i = 0; i < 3; ++i)
+    {
+        f[i] = Array<OneD, NekDouble>(npts, 0.0);
+        Vmath::FillWhiteNoise(npts, 1.0, f[i], 1, seed + i);
+    }
+    return f;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc > 3)
+    {
+        fprintf(stderr, "Usage: MagneticForcingTiming [npts] [ntest]\n");
+        exit(1);
+    }
+
+    int npts  = argc > 1 ? atoi(argv[1]) : 1000000;
+    int ntest = argc > 2 ? atoi(argv[2]) : 100;
+
+    NekDouble sigma = 2.0, gradsign = -1.0;
+
+    VecField vel     = RandomField(npts, 1);
+    VecField mag     = RandomField(npts, 4);
+    VecField gradphi = RandomField(npts, 7);
+    VecField fref    = RandomField(npts, 10);
+    VecField ffused  = RandomField(npts, 10);
+
+    LibUtilities::Timer timer;
+
+    timer.Start();
+    for (int n = 0; n < ntest; ++n)
+    {
+        VmathLorentzForce3D(npts, sigma, gradsign, vel, mag, gradphi, fref);
+    }
+    timer.Stop();
+    NekDouble tVmath = timer.TimePerTest(ntest);
+
+    timer.Start();
+    for (int n = 0; n < ntest; ++n)
+    {
+        ForcingMagnetic::LorentzForce3D(npts, sigma, gradsign, vel, mag,
+                                        gradphi, ffused);
+    }
+    timer.Stop();
+    NekDouble tFused = timer.TimePerTest(ntest);
+
+    NekDouble maxErr = 0.0;
+    for (int i = 0; i < 3; ++i)
+    {
+        Vmath::Vsub(npts, ffused[i], 1, fref[i], 1, fref[i], 1);
+        maxErr = max(maxErr, Vmath::Vamax(npts, fref[i], 1));
+    }
+
+    cout << "Lorentz force, npts = " << npts << ", ntest = " << ntest << endl;
+    cout << setw(10) << "Vmath: " << tVmath << " s" << endl;
+    cout << setw(10) << "Fused: " << tFused << " s" << endl;
+    cout << setw(10) << "Speedup: " << tVmath / tFused << endl;
+    cout << setw(10) << "Max diff: " << maxErr << endl;
+
+    return 0;
+}
@@ -61,6 +61,13 @@ namespace Nektar
             return;
         }
 
+        // The regex is matched against the standard output, or the lines of
+        // the given output file.
+        if (metric->Attribute("file"))
+        {
+            m_file = metric->Attribute("file");
+        }
+
         // Parse Regex expression
         TiXmlElement *regex = metric->FirstChildElement("regex");
         ASSERTL0(regex, "No Regex defined.");
@@ -113,6 +120,23 @@ namespace Nektar
         }
     }
 
+    /**
+     * @brief Return the output to match: the standard output @p pStdout, or
+     * the file given to the metric, opened in @p file.
+     */
+    std::istream &MetricRegex::GetOutput(std::istream  &pStdout,
+                                         std::ifstream &file)
+    {
+        if (m_file.empty())
+        {
+            return pStdout;
+        }
+
+        file.open(m_file.c_str(), std::ios::binary);
+        ASSERTL0(file.is_open(), "Unable to open file: " + m_file);
+        return file;
+    }
+
     /**
      * @brief Test output against a regex expression and set of matches.
      */
@@ -120,6 +144,9 @@ namespace Nektar
     {
         boost::ignore_unused(pStdout, pStderr);
 
+        std::ifstream file;
+        std::istream &output = GetOutput(pStdout, file);
+
         ASSERTL0(m_matches.size(), "No test conditions defined for Regex.");
 
         std::vector<MetricRegexFieldValue> &okValues = m_matches[0];
@@ -130,7 +157,7 @@ namespace Nektar
 
         // Process output file line by line searching for regex matches
         std::string line;
-        while (getline(pStdout, line) && m_matches.size() > 0)
+        while (getline(output, line) && m_matches.size() > 0)
         {
             matchedTol = true;
 
@@ -273,9 +300,12 @@ namespace Nektar
 
         boost::cmatch matches;
 
+        std::ifstream file;
+        std::istream &output = GetOutput(pStdout, file);
+
         // Process output file line by line searching for regex matches
         std::string line;
-        while (getline(pStdout, line))
+        while (getline(output, line))
         {
             // Test to see if we have a match on this line.
             if (boost::regex_match(line.c_str(), matches, m_regex))
@@ -37,6 +37,7 @@
 
 #include <Metric.h>
 #include <boost/regex.hpp>
+#include <fstream>
 #include <vector>
 
 namespace Nektar
@@ -79,9 +80,13 @@ namespace Nektar
         std::vector<std::vector<MetricRegexFieldValue> > m_matches;
         /// If true, regex matches may be in any order in output
         bool m_unordered;
+        /// File to match instead of the standard output, if any.
+        std::string m_file;
 
         MetricRegex(TiXmlElement *metric, bool generate);
 
+        std::istream &GetOutput(std::istream &pStdout, std::ifstream &file);
+
         virtual bool v_Test    (std::istream& pStdout, std::istream& pStderr);
         virtual void v_Generate(std::istream& pStdout, std::istream& pStderr);
     };
@@ -32,12 +32,23 @@
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <functional>
+#include <map>
 #include <string>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 #include <boost/algorithm/string.hpp>
+#include <boost/core/ignore_unused.hpp>
 #include <boost/program_options.hpp>
 #include <LibUtilities/BasicUtils/FileSystem.h>
 #include <LibUtilities/BasicUtils/Timer.h>
 #include <FieldUtils/Module.h>
+#include <SpatialDomains/MeshGraphXml.h>
 
 using namespace std;
 using namespace Nektar;
@@ -49,6 +60,12 @@ void PrintExecutionSequence(vector<ModuleSharedPtr> &modules);
 
 void RunModule(ModuleSharedPtr module, po::variables_map &vm, bool verbose);
 
+int RunPartitionWorkers(const vector<int> &parts, int nJobs,
+                        NekDouble memBudget,
+                        const std::function<void (int)> &process);
+
+void PartitionForStreaming(vector<string> &inout, int nChunks, bool root);
+
 int main(int argc, char* argv[])
 {
     LibUtilities::Timer    timer;
@@ -78,6 +95,15 @@ int main(int argc, char* argv[])
         ("nparts", po::value<int>(),
             "Define nparts if running serial problem to mimic "
             "parallel run with many partitions.")
+        ("nparts-jobs", po::value<int>(),
+            "Number of partitions processed concurrently by worker "
+            "processes when using nparts.")
+        ("nparts-memory", po::value<NekDouble>(),
+            "Memory budget in MB for the partitions processed "
+            "concurrently when using nparts-jobs.")
+        ("stream", po::value<int>(),
+            "Process the field in the specified number of chunks of "
+            "elements, one at a time, to bound the memory usage.")
         ("npz", po::value<int>(),
             "Used to define number of partitions in z for Homogeneous1D "
             "expansions for parallel runs.")
@@ -203,6 +229,16 @@ int main(int argc, char* argv[])
              "Must specify input(s) and/or output file.");
     vector<string> inout = vm["input-file"].as<vector<string> >();
 
+    // The stream option processes the chunks of elements as the partitions
+    // of the nparts option.
+    if (vm.count("stream"))
+    {
+        ASSERTL0(!vm.count("nparts"),
+                 "The stream and nparts options cannot be used together.");
+        vm.insert(std::make_pair("nparts", po::variable_value(
+                      boost::any(vm["stream"].as<int>()), false)));
+    }
+
 
     /*
      * Process list of modules. Each element of the vector of module
@@ -252,6 +288,15 @@ int main(int argc, char* argv[])
                                                     "Serial", argc, argv);
     }
 
+    if (vm.count("stream"))
+    {
+        PartitionForStreaming(inout, nParts, MPIrank == 0);
+        if (MPIComm)
+        {
+            MPIComm->Block();
+        }
+    }
+
     vector<ModuleSharedPtr> modules;
     vector<string>          modcmds;
     ModuleKey               module;
@@ -443,6 +488,16 @@ int main(int argc, char* argv[])
 
     // Check if modules provided are compatible
     CheckModules(modules);
+    // Streaming requires each chunk of elements to be processed on its own
+    if (vm.count("stream"))
+    {
+        for (auto &m : modules)
+        {
+            ASSERTL0(m->IsElementLocal(), "Module " + m->GetModuleName() +
+                     " requires data from the whole domain and cannot be "
+                     "used with the stream option.");
+        }
+    }
     // Can't have ContField with range option (because of boundaries)
     if (vm.count("range") && f->m_declareExpansionAsContField)
     {
@@ -459,11 +514,11 @@ int main(int argc, char* argv[])
 
     // Loop on partitions if required
     LibUtilities::CommSharedPtr defComm = f->m_comm;
-    LibUtilities::CommSharedPtr partComm;
-    for(int p = MPIrank; p < nParts; p += MPInprocs)
+    auto processPartition = [&](int p)
     {
         // write out which partition is being processed and defined a
         // new serial communicator
+        LibUtilities::CommSharedPtr partComm;
         if(nParts > 1)
         {
             cout << endl << "Processing partition: " << p << endl;
@@ -499,6 +554,44 @@ int main(int argc, char* argv[])
                 }
             }
         }
+    };
+
+    vector<int> parts;
+    for(int p = MPIrank; p < nParts; p += MPInprocs)
+    {
+        parts.push_back(p);
+    }
+
+    int nJobs = vm.count("nparts-jobs") ? vm["nparts-jobs"].as<int>() : 1;
+    if (nJobs > 1 && nParts > 1 && MPInprocs == 1)
+    {
+        // Forking an MPI process is not supported by MPI implementations,
+        // so MPI is finalised before starting the workers. The partitions
+        // only use serial communicators.
+        if (MPIComm)
+        {
+            MPIComm->Finalise();
+        }
+
+        NekDouble memBudget = vm.count("nparts-memory") ?
+            vm["nparts-memory"].as<NekDouble>() : 0.0;
+        int nFailed = RunPartitionWorkers(parts, nJobs, memBudget,
+                                          processPartition);
+        ASSERTL0(nFailed == 0, boost::lexical_cast<string>(nFailed) +
+                 " partition(s) failed to process.");
+    }
+    else
+    {
+        if (nJobs > 1 && MPInprocs > 1 && MPIrank == 0)
+        {
+            cout << "Warning: nparts-jobs is ignored when running with "
+                 << "more than one MPI process." << endl;
+        }
+
+        for (int p : parts)
+        {
+            processPartition(p);
+        }
     }
 
     // write out Info file if required.
@@ -756,3 +849,209 @@ void RunModule(ModuleSharedPtr module, po::variables_map &vm, bool verbose)
              << ss.str() << endl;
     }
 }
+
+/**
+ * Process the partitions @p parts by calling @p process in worker processes,
+ * of which up to @p nJobs run concurrently. The library state is global to a
+ * process, so that partitions cannot be processed by threads sharing it.
+ * The workers are forked from this process, which must therefore not hold an
+ * initialised MPI library.
+ *
+ * If @p memBudget is positive, the first partition is processed on its own
+ * to measure its peak memory usage, and the number of concurrent workers is
+ * reduced so that their estimated total usage stays within @p memBudget MB.
+ *
+ * @return Number of partitions which failed to process.
+ */
+int RunPartitionWorkers(const vector<int> &parts, int nJobs,
+                        NekDouble memBudget,
+                        const std::function<void (int)> &process)
+{
+#ifdef _WIN32
+    boost::ignore_unused(memBudget);
+    cout << "Warning: nparts-jobs is not supported on Windows, "
+         << "processing partitions serially." << endl;
+    for (int p : parts)
+    {
+        process(p);
+    }
+    return 0;
+#else
+    std::map<pid_t, int> running;
+    int nFailed = 0;
+    NekDouble peakMB = 0.0;
+
+    auto launch = [&](int p)
+    {
+        // Avoid duplicating buffered output in the worker.
+        cout.flush();
+        cerr.flush();
+
+        pid_t pid = fork();
+        ASSERTL0(pid >= 0, "Failed to start worker for partition " +
+                 boost::lexical_cast<string>(p));
+
+        if (pid == 0)
+        {
+            int status = 0;
+            try
+            {
+                process(p);
+            }
+            catch (std::exception &e)
+            {
+                cerr << "Error in partition " << p << ": " << e.what()
+                     << endl;
+                status = 1;
+            }
+            cout.flush();
+            cerr.flush();
+            _exit(status);
+        }
+
+        running[pid] = p;
+    };
+
+    auto reap = [&]()
+    {
+        int status;
+        struct rusage usage;
+        pid_t pid = wait4(-1, &status, 0, &usage);
+        ASSERTL0(pid > 0, "Failed to wait for partition workers");
+
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        {
+            cerr << "Partition " << running[pid] << " failed." << endl;
+            ++nFailed;
+        }
+        running.erase(pid);
+
+#ifdef __APPLE__
+        peakMB = max(peakMB, usage.ru_maxrss / (1024.0 * 1024.0));
+#else
+        peakMB = max(peakMB, usage.ru_maxrss / 1024.0);
+#endif
+    };
+
+    size_t next = 0;
+    if (memBudget > 0.0 && next < parts.size())
+    {
+        launch(parts[next++]);
+        reap();
+
+        if (peakMB > 0.0)
+        {
+            nJobs = max(1, min(nJobs,
+                               static_cast<int>(memBudget / peakMB)));
+        }
+        cout << "Processing " << nJobs << " partitions concurrently ("
+             << peakMB << " MB per partition)" << endl;
+    }
+
+    while (next < parts.size() || !running.empty())
+    {
+        while (static_cast<int>(running.size()) < nJobs &&
+               next < parts.size())
+        {
+            launch(parts[next++]);
+        }
+        reap();
+    }
+
+    return nFailed;
+#endif
+}
+
+/**
+ * Partition the xml mesh in @p inout into @p nChunks partitions for the
+ * stream option, and replace the xml files in @p inout by the directory
+ * holding the partitions. An existing partitioned mesh is reused.
+ *
+ * The mesh is partitioned by the @p root process only.
+ */
+void PartitionForStreaming(vector<string> &inout, int nChunks, bool root)
+{
+    vector<string> xmlFiles;
+    int            first = -1;
+    for (int i = 0; i < inout.size() - 1; ++i)
+    {
+        string file = inout[i].substr(0, inout[i].find(':'));
+        if (boost::ends_with(file, ".xml") || boost::ends_with(file, ".xml.gz"))
+        {
+            xmlFiles.push_back(file);
+            first = first < 0 ? i : first;
+        }
+        else if (boost::ends_with(file, "_xml"))
+        {
+            // Mesh has already been partitioned.
+            return;
+        }
+    }
+    ASSERTL0(xmlFiles.size(), "The stream option requires an xml mesh.");
+
+    // Partitions are written to a directory named after the session.
+    string dirname = xmlFiles[0].substr(0, xmlFiles[0].rfind(".xml")) + "_xml";
+
+    if (root && !fs::is_directory(dirname))
+    {
+        cout << "Partitioning mesh into " << nChunks << " chunks" << endl;
+
+        // Partition in this process with a serial communicator, rather than
+        // through the part-only option which ends by exiting the process.
+        vector<string> args = {"FieldConvert"};
+        vector<char *> argv;
+        for (auto &a : args)
+        {
+            argv.push_back(&a[0]);
+        }
+        int argc = argv.size();
+
+        LibUtilities::CommSharedPtr comm =
+            LibUtilities::GetCommFactory().CreateInstance(
+                "Serial", argc, argv.data());
+        LibUtilities::SessionReaderSharedPtr session =
+            LibUtilities::SessionReader::CreateInstance(
+                argc, argv.data(), xmlFiles, comm);
+        session->InitSession();
+
+        std::shared_ptr<SpatialDomains::MeshGraphXml> graph =
+            std::dynamic_pointer_cast<SpatialDomains::MeshGraphXml>(
+                SpatialDomains::GetMeshGraphFactory().CreateInstance(
+                    session->GetGeometryType()));
+        ASSERTL0(graph, "The stream option requires an xml mesh.");
+        graph->WritePartitions(session, nChunks);
+    }
+
+    // Check that an existing partitioned mesh matches the number of chunks.
+    if (root)
+    {
+        int nfiles = 0;
+        for (fs::directory_iterator it(dirname);
+             it != fs::directory_iterator(); ++it)
+        {
+            string name = it->path().filename().string();
+            nfiles += boost::starts_with(name, "P") &&
+                      boost::ends_with(name, ".xml");
+        }
+        ASSERTL0(nfiles == nChunks, "Directory " + dirname + " holds " +
+                 boost::lexical_cast<string>(nfiles) + " partitions instead "
+                 "of " + boost::lexical_cast<string>(nChunks) +
+                 "; remove it to partition the mesh again.");
+    }
+
+    vector<string> files;
+    for (int i = 0; i < inout.size(); ++i)
+    {
+        string file = inout[i].substr(0, inout[i].find(':'));
+        if (i == first)
+        {
+            files.push_back(dirname + ":xml");
+        }
+        else if (i == inout.size() - 1 ||
+                 find(xmlFiles.begin(), xmlFiles.end(), file) == xmlFiles.end())
+        {
+            files.push_back(inout[i]);
+        }
+    }
+    inout = files;
+}
@@ -0,0 +1,68 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description> Process 3DH1D vtu output in the compressed binary format </description>
+    <executable>FieldConvert</executable>
+    <parameters> -f -e chan3DH1D.xml chan3DH1D.fld chan3DH1D.vtu:vtu:format=binary:compress</parameters>
+    <files>
+        <file description="Session File">chan3DH1D.xml</file>
+        <file description="Session File">chan3DH1D.fld</file>
+    </files>
+     <metrics>
+        <metric type="L2" id="1">
+            <value variable="x" tolerance="1e-6">0.57735</value>
+            <value variable="y" tolerance="1e-6">0.57735</value>
+            <value variable="u" tolerance="1e-6">0.182574</value>
+            <value variable="v" tolerance="1e-6">0</value>
+            <value variable="w" tolerance="1e-6">0</value>
+            <value variable="p" tolerance="1e-6">1.1547</value>
+        </metric>
+        <metric type="regex" id="2" file="chan3DH1D.vtu">
+            <regex>^&lt;VTKFile type="UnstructuredGrid" version="1.0" byte_order="(\w+)" header_type="(\w+)" compressor="(\w+)"&gt;</regex>
+            <matches>
+                <match>
+                    <field id="0">LittleEndian</field>
+                    <field id="1">UInt64</field>
+                    <field id="2">vtkZLibDataCompressor</field>
+                </match>
+            </matches>
+        </metric>
+        <metric type="regex" id="3" file="chan3DH1D.vtu">
+            <regex>^\s*&lt;Piece NumberOfPoints="(\d+)" NumberOfCells="(\d+)"&gt;</regex>
+            <matches>
+                <match>
+                    <field id="0">576</field>
+                    <field id="1">288</field>
+                </match>
+            </matches>
+        </metric>
+        <metric type="regex" id="4" file="chan3DH1D.vtu">
+            <regex>^\s*([A-Za-z0-9+/]{32})[A-Za-z0-9+/]{11}=[A-Za-z0-9+/=]+</regex>
+            <matches>
+                <match>
+                    <field id="0">AQAAAAAAAAAAgAAAAAAAAAA2AAAAAAAA</field>
+                </match>
+                <match>
+                    <field id="0">AQAAAAAAAAAAgAAAAAAAAAAkAAAAAAAA</field>
+                </match>
+                <match>
+                    <field id="0">AQAAAAAAAAAAgAAAAAAAAIAEAAAAAAAA</field>
+                </match>
+                <match>
+                    <field id="0">AQAAAAAAAAAAgAAAAAAAACABAAAAAAAA</field>
+                </match>
+                <match>
+                    <field id="0">AQAAAAAAAAAAgAAAAAAAAAASAAAAAAAA</field>
+                </match>
+                <match>
+                    <field id="0">AQAAAAAAAAAAgAAAAAAAAAASAAAAAAAA</field>
+                </match>
+                <match>
+                    <field id="0">AQAAAAAAAAAAgAAAAAAAAAASAAAAAAAA</field>
+                </match>
+                <match>
+                    <field id="0">AQAAAAAAAAAAgAAAAAAAAAASAAAAAAAA</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
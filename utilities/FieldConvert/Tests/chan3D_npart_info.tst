@@ -0,0 +1,25 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description> Process npart to fld file and merge Info.xml </description>
+    <executable>FieldConvert</executable>
+    <parameters> -f -v --nparts 2 chan3D_xml:xml chan3D.fld chan3D_npart.fld </parameters>
+    <files>
+        <file description="Session File Directory">chan3D_xml</file>
+        <file description="Field File">chan3D.fld</file>
+    </files>
+    <metrics>
+        <metric type="regex" id="1">
+            <regex>^\s*OutputInfo: (P\d+\.fld) holds elements (\S+)</regex>
+            <matches>
+                <match>
+                    <field id="0">P0000000.fld</field>
+                    <field id="1">0-2</field>
+                </match>
+                <match>
+                    <field id="0">P0000001.fld</field>
+                    <field id="1">3-5</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
@@ -0,0 +1,33 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description> Process npart to fld file in worker processes and merge Info.xml </description>
+    <executable>FieldConvert</executable>
+    <parameters> -f -v --nparts 4 --nparts-jobs 2 chan3D_np4_xml:xml chan3D.fld chan3D_npart.fld </parameters>
+    <files>
+        <file description="Session File Directory">chan3D_np4_xml</file>
+        <file description="Field File">chan3D.fld</file>
+    </files>
+    <metrics>
+        <metric type="regex" id="1">
+            <regex>^\s*OutputInfo: (P\d+\.fld) holds elements (\S+)</regex>
+            <matches>
+                <match>
+                    <field id="0">P0000000.fld</field>
+                    <field id="1">0-1</field>
+                </match>
+                <match>
+                    <field id="0">P0000001.fld</field>
+                    <field id="1">2-3</field>
+                </match>
+                <match>
+                    <field id="0">P0000002.fld</field>
+                    <field id="1">4</field>
+                </match>
+                <match>
+                    <field id="0">P0000003.fld</field>
+                    <field id="1">5</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
@@ -0,0 +1,44 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description> Process npart to tecplot file in worker processes </description>
+    <executable>FieldConvert</executable>
+    <parameters> -f --nparts 4 --nparts-jobs 2 chan3D_np4_xml:xml chan3D.fld chan3D.dat </parameters>
+    <files>
+        <file description="Session File Directory">chan3D_np4_xml</file>
+        <file description="Field File">chan3D.fld</file>
+    </files>
+    <metrics>
+        <metric type="regex" id="1" file="chan3D_P0.dat">
+            <regex>^Variables = x, y, z, (\w+).*</regex>
+            <matches>
+                <match>
+                    <field id="0">u</field>
+                </match>
+            </matches>
+        </metric>
+        <metric type="regex" id="2" file="chan3D_P1.dat">
+            <regex>^Variables = x, y, z, (\w+).*</regex>
+            <matches>
+                <match>
+                    <field id="0">u</field>
+                </match>
+            </matches>
+        </metric>
+        <metric type="regex" id="3" file="chan3D_P2.dat">
+            <regex>^Variables = x, y, z, (\w+).*</regex>
+            <matches>
+                <match>
+                    <field id="0">u</field>
+                </match>
+            </matches>
+        </metric>
+        <metric type="regex" id="4" file="chan3D_P3.dat">
+            <regex>^Variables = x, y, z, (\w+).*</regex>
+            <matches>
+                <match>
+                    <field id="0">u</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
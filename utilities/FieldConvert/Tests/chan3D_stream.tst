@@ -0,0 +1,19 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description> Process a field with the stream option in a single chunk </description>
+    <executable>FieldConvert</executable>
+    <parameters> -f -e --stream 1 -m fieldfromstring:fieldstr="u":fieldname="v" chan3D.xml chan3D.fld chan3D.plt </parameters>
+    <files>
+        <file description="Session File">chan3D.xml</file>
+        <file description="Field File">chan3D.fld</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="x" tolerance="1e-6">1.69239</value>
+            <value variable="y" tolerance="1e-6">1.69239</value>
+            <value variable="z" tolerance="1e-6">1.69239</value>
+            <value variable="u" tolerance="1e-6">2.0864</value>
+            <value variable="v" tolerance="1e-6">2.0864</value>
+        </metric>
+    </metrics>
+</test>
@@ -0,0 +1,75 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description> Process 3D vtu output in the appended format </description>
+    <executable>FieldConvert</executable>
+    <parameters> -f -e chan3D.xml chan3D.fld chan3D_app.vtu:vtu:format=appended</parameters>
+    <files>
+        <file description="Session File">chan3D.xml</file>
+        <file description="Session File">chan3D.fld</file>
+    </files>
+     <metrics>
+        <metric type="L2" id="1">
+            <value variable="x" tolerance="1e-6">1.69239</value>
+            <value variable="y" tolerance="1e-6">1.69239</value>
+            <value variable="z" tolerance="1e-6">1.69239</value>
+            <value variable="u" tolerance="1e-6">2.0864</value>
+            <value variable="v" tolerance="1e-6">0</value>
+            <value variable="w" tolerance="1e-6">0</value>
+            <value variable="p" tolerance="1e-6">6.59218</value>
+        </metric>
+        <metric type="regex" id="2" file="chan3D_app.vtu">
+            <regex>^\s*&lt;Piece NumberOfPoints="(\d+)" NumberOfCells="(\d+)"&gt;</regex>
+            <matches>
+                <match>
+                    <field id="0">384</field>
+                    <field id="1">162</field>
+                </match>
+            </matches>
+        </metric>
+        <metric type="regex" id="3" file="chan3D_app.vtu">
+            <regex>^\s*&lt;DataArray type="(\w+)".* format="appended" offset="(\d+)"/&gt;</regex>
+            <matches>
+                <match>
+                    <field id="0">Float64</field>
+                    <field id="1">0</field>
+                </match>
+                <match>
+                    <field id="0">Int32</field>
+                    <field id="1">9224</field>
+                </match>
+                <match>
+                    <field id="0">Int32</field>
+                    <field id="1">14416</field>
+                </match>
+                <match>
+                    <field id="0">UInt8</field>
+                    <field id="1">15072</field>
+                </match>
+                <match>
+                    <field id="0">Float64</field>
+                    <field id="1">15242</field>
+                </match>
+                <match>
+                    <field id="0">Float64</field>
+                    <field id="1">18322</field>
+                </match>
+                <match>
+                    <field id="0">Float64</field>
+                    <field id="1">21402</field>
+                </match>
+                <match>
+                    <field id="0">Float64</field>
+                    <field id="1">24482</field>
+                </match>
+            </matches>
+        </metric>
+        <metric type="regex" id="4" file="chan3D_app.vtu">
+            <regex>^\s*&lt;AppendedData encoding="(\w+)"&gt;</regex>
+            <matches>
+                <match>
+                    <field id="0">raw</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
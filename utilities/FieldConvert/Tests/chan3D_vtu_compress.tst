@@ -0,0 +1,61 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description> Process 3D vtu output in the compressed appended format </description>
+    <executable>FieldConvert</executable>
+    <parameters> -f -e chan3D.xml chan3D.fld chan3D_comp.vtu:vtu:format=appended:compress</parameters>
+    <files>
+        <file description="Session File">chan3D.xml</file>
+        <file description="Session File">chan3D.fld</file>
+    </files>
+     <metrics>
+        <metric type="L2" id="1">
+            <value variable="x" tolerance="1e-6">1.69239</value>
+            <value variable="y" tolerance="1e-6">1.69239</value>
+            <value variable="z" tolerance="1e-6">1.69239</value>
+            <value variable="u" tolerance="1e-6">2.0864</value>
+            <value variable="v" tolerance="1e-6">0</value>
+            <value variable="w" tolerance="1e-6">0</value>
+            <value variable="p" tolerance="1e-6">6.59218</value>
+        </metric>
+        <metric type="regex" id="2" file="chan3D_comp.vtu">
+            <regex>^&lt;VTKFile type="UnstructuredGrid" version="1.0" byte_order="(\w+)" header_type="(\w+)" compressor="(\w+)"&gt;</regex>
+            <matches>
+                <match>
+                    <field id="0">LittleEndian</field>
+                    <field id="1">UInt64</field>
+                    <field id="2">vtkZLibDataCompressor</field>
+                </match>
+            </matches>
+        </metric>
+        <metric type="regex" id="3" file="chan3D_comp.vtu">
+            <regex>^\s*&lt;Piece NumberOfPoints="(\d+)" NumberOfCells="(\d+)"&gt;</regex>
+            <matches>
+                <match>
+                    <field id="0">384</field>
+                    <field id="1">162</field>
+                </match>
+            </matches>
+        </metric>
+        <metric type="regex" id="4" file="chan3D_comp.vtu">
+            <regex>^\s*&lt;DataArray type="Float64" Name="(\w+)" format="(\w+)" offset="\d+"/&gt;</regex>
+            <matches>
+                <match>
+                    <field id="0">u</field>
+                    <field id="1">appended</field>
+                </match>
+                <match>
+                    <field id="0">v</field>
+                    <field id="1">appended</field>
+                </match>
+                <match>
+                    <field id="0">w</field>
+                    <field id="1">appended</field>
+                </match>
+                <match>
+                    <field id="0">p</field>
+                    <field id="1">appended</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
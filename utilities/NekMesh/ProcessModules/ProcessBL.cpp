@@ -32,6 +32,7 @@
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <set>
 #include <string>
 
 #include <LibUtilities/BasicUtils/ParseUtils.h>
@@ -116,6 +117,21 @@ ProcessBL::ProcessBL(MeshSharedPtr m) : ProcessModule(m)
         ConfigOption(false, "", "Tag identifying surface connected to prism.");
     m_config["r"] =
         ConfigOption(false, "2.0", "Ratio to use in geometry progression.");
+    m_config["hartmann"] =
+        ConfigOption(false, "0.0", "Hartmann number used to size the layers "
+                                   "(0 to disable).");
+    m_config["bdir"] =
+        ConfigOption(false, "0,1,0", "Direction of the applied magnetic "
+                                     "field.");
+    m_config["lref"] =
+        ConfigOption(false, "1.0", "Reference length of the Hartmann "
+                                   "number.");
+    m_config["hlayers"] =
+        ConfigOption(false, "3", "Number of layers inside the Hartmann "
+                                 "layer thickness.");
+    m_config["rmax"] =
+        ConfigOption(false, "2.0", "Maximum ratio in geometric progression "
+                                   "when sizing from Hartmann number.");
 }
 
 ProcessBL::~ProcessBL()
@@ -156,6 +172,252 @@ void ProcessBL::Process()
     ProcessComposites();
 }
 
+/**
+ * @brief Size the boundary layer so that it resolves the Hartmann layers of
+ * a flow with a given Hartmann number.
+ *
+ * The Hartmann layer on a wall scales as \f$ L / (Ha |\hat{B}\cdot n|) \f$,
+ * where \f$ n \f$ is the wall normal and \f$ \hat{B} \f$ the direction of the
+ * applied field. On walls parallel to the field this thickness is bounded by
+ * the side layer scaling \f$ L / \sqrt{Ha} \f$. The first layer of each
+ * element is sized so that @c hlayers layers fit inside this thickness. The
+ * number of layers is then the smallest for which no element requires a
+ * ratio greater than @c rmax, and the ratio of each element is chosen so
+ * that its layers exactly fill the macro element.
+ *
+ * Elements which share a split edge must split it identically, so the
+ * largest of these ratios is used for all elements connected through split
+ * edges. The first layer of the other elements is then thinner than they
+ * require.
+ *
+ * @param el        List of elements of the mesh.
+ * @param splitEls  Map of element ID to the edge or face on the surface.
+ * @param ratio     On output, the ratio to use for each split element.
+ *
+ * @return Number of layers.
+ */
+int ProcessBL::HartmannLayers(const vector<ElementSharedPtr> &el,
+                              const map<int, int> &splitEls,
+                              map<int, NekDouble> &ratio)
+{
+    NekDouble ha   = m_config["hartmann"].as<NekDouble>();
+    NekDouble lref = m_config["lref"].as<NekDouble>();
+    NekDouble nh   = m_config["hlayers"].as<NekDouble>();
+    NekDouble rmax = m_config["rmax"].as<NekDouble>();
+
+    vector<NekDouble> bdir;
+    ASSERTL0(ParseUtils::GenerateVector(m_config["bdir"].as<string>(), bdir),
+             "Failed to parse magnetic field direction.");
+    ASSERTL0(bdir.size() == 3, "Magnetic field direction should have three "
+                               "components.");
+    ASSERTL0(nh > 0.0, "Number of layers in Hartmann layer must be positive.");
+    ASSERTL0(rmax >= 1.0, "Maximum ratio should be at least 1.");
+
+    Node b(0, bdir[0], bdir[1], bdir[2]);
+    ASSERTL0(b.abs2() > 0.0, "Magnetic field direction should be non-zero.");
+    b /= sqrt(b.abs2());
+
+    // Height of each macro element and the first layer it requires.
+    map<int, pair<NekDouble, NekDouble> > sizes;
+    int nl = 1;
+
+    // Elements sharing each split edge, i.e. each edge with one vertex on
+    // the wall.
+    map<int, vector<int> > edgeEls;
+
+    for (int i = 0; i < el.size(); ++i)
+    {
+        auto it = splitEls.find(el[i]->GetId());
+        if (it == splitEls.end())
+        {
+            continue;
+        }
+
+        // Find the vertices on the wall and the wall normal.
+        vector<NodeSharedPtr> wall;
+        Node normal;
+        if (m_mesh->m_expDim == 2)
+        {
+            EdgeSharedPtr e = el[i]->GetEdge(it->second);
+            wall.push_back(e->m_n1);
+            wall.push_back(e->m_n2);
+            Node t = *e->m_n2 - *e->m_n1;
+            normal = Node(0, t.m_y, -t.m_x, 0.0);
+        }
+        else
+        {
+            FaceSharedPtr f = el[i]->GetFace(it->second);
+            wall = f->m_vertexList;
+            if (wall.size() == 3)
+            {
+                normal = (*wall[1] - *wall[0]).curl(*wall[2] - *wall[0]);
+            }
+            else
+            {
+                normal = (*wall[2] - *wall[0]).curl(*wall[3] - *wall[1]);
+            }
+        }
+        normal /= sqrt(normal.abs2());
+
+        // The height of the macro element is the wall-normal distance
+        // between the centroids of the wall and the opposite side.
+        Node cw(0, 0.0, 0.0, 0.0), co(0, 0.0, 0.0, 0.0);
+        int nw = 0, no = 0;
+        vector<NodeSharedPtr> verts = el[i]->GetVertexList();
+        for (auto &v : verts)
+        {
+            if (find(wall.begin(), wall.end(), v) != wall.end())
+            {
+                cw += *v;
+                ++nw;
+            }
+            else
+            {
+                co += *v;
+                ++no;
+            }
+        }
+        ASSERTL0(nw > 0 && no > 0, "Unable to determine element height.");
+
+        vector<EdgeSharedPtr> edges = el[i]->GetEdgeList();
+        for (auto &e : edges)
+        {
+            bool w1 = find(wall.begin(), wall.end(), e->m_n1) != wall.end();
+            bool w2 = find(wall.begin(), wall.end(), e->m_n2) != wall.end();
+            if (w1 != w2)
+            {
+                edgeEls[e->m_id].push_back(el[i]->GetId());
+            }
+        }
+
+        cw /= nw;
+        co /= no;
+
+        NekDouble h = fabs((co - cw).dot(normal));
+
+        // Hartmann layer thickness on this wall, bounded by the side layer
+        // thickness where the wall is parallel to the field.
+        NekDouble cosb  = fabs(normal.dot(b));
+        NekDouble delta = lref / (ha * max(cosb, 1.0 / sqrt(ha)));
+        NekDouble h1    = delta / nh;
+
+        sizes[el[i]->GetId()] = make_pair(h, h1);
+
+        int n;
+        if (h <= h1)
+        {
+            n = 1;
+        }
+        else if (rmax - 1.0 < 1e-6)
+        {
+            n = (int)ceil(h / h1);
+        }
+        else
+        {
+            n = (int)ceil(log(1.0 + h * (rmax - 1.0) / h1) / log(rmax));
+        }
+        nl = max(nl, n);
+    }
+
+    // Now find the ratio for each element such that the first layer has
+    // height h1 and the nl layers fill the element. The height of the
+    // layers is monotonic in r, so bisection is sufficient.
+    NekDouble rmin = rmax, rmx = 1.0;
+    for (auto &sIt : sizes)
+    {
+        NekDouble h  = sIt.second.first;
+        NekDouble h1 = sIt.second.second;
+        NekDouble r  = 1.0;
+
+        if (h > nl * h1)
+        {
+            NekDouble lo = 1.0, hi = rmax;
+            for (int k = 0; k < 60; ++k)
+            {
+                r = 0.5 * (lo + hi);
+
+                NekDouble sum = 0.0, rk = 1.0;
+                for (int j = 0; j < nl; ++j)
+                {
+                    sum += rk;
+                    rk  *= r;
+                }
+
+                if (h1 * sum > h)
+                {
+                    hi = r;
+                }
+                else
+                {
+                    lo = r;
+                }
+            }
+        }
+
+        ratio[sIt.first] = r;
+    }
+
+    // Use the largest ratio of each set of elements connected through split
+    // edges, since the vertices along a shared edge are only generated by
+    // the first element which splits it.
+    map<int, vector<int> > elEdges;
+    for (auto &eIt : edgeEls)
+    {
+        for (auto &id : eIt.second)
+        {
+            elEdges[id].push_back(eIt.first);
+        }
+    }
+
+    set<int> visited;
+    for (auto &sIt : sizes)
+    {
+        if (!visited.insert(sIt.first).second)
+        {
+            continue;
+        }
+
+        vector<int> group(1, sIt.first), stack(1, sIt.first);
+        while (stack.size() > 0)
+        {
+            int id = stack.back();
+            stack.pop_back();
+            for (auto &edgeId : elEdges[id])
+            {
+                for (auto &nbr : edgeEls[edgeId])
+                {
+                    if (visited.insert(nbr).second)
+                    {
+                        group.push_back(nbr);
+                        stack.push_back(nbr);
+                    }
+                }
+            }
+        }
+
+        NekDouble r = 1.0;
+        for (auto &id : group)
+        {
+            r = max(r, ratio[id]);
+        }
+        for (auto &id : group)
+        {
+            ratio[id] = r;
+        }
+
+        rmin = min(rmin, r);
+        rmx  = max(rmx, r);
+    }
+
+    if (m_mesh->m_verbose)
+    {
+        cout << "\t Hartmann number " << ha << ": " << nl
+             << " layers, ratio between " << rmin << " and " << rmx << endl;
+    }
+
+    return nl;
+}
+
 void ProcessBL::BoundaryLayer2D()
 {
     int nodeId  = m_mesh->m_vertexSet.size();
@@ -179,6 +441,8 @@ void ProcessBL::BoundaryLayer2D()
         ratioIsString = true;
     }
 
+    bool hartmann = m_config["hartmann"].as<NekDouble>() > 0.0;
+
     // Default PointsType.
     LibUtilities::PointsType pt = LibUtilities::eGaussLobattoLegendre;
 
@@ -263,6 +527,14 @@ void ProcessBL::BoundaryLayer2D()
     vector<ElementSharedPtr> el = m_mesh->m_element[m_mesh->m_expDim];
     m_mesh->m_element[m_mesh->m_expDim].clear();
 
+    // If a Hartmann number is given, size the layers to resolve the
+    // Hartmann layers.
+    map<int, NekDouble> haRatio;
+    if (hartmann)
+    {
+        nl = HartmannLayers(el, splitEls, haRatio);
+    }
+
     // Iterate over list of elements of expansion dimension.
     for (int i = 0; i < el.size(); ++i)
     {
@@ -297,7 +569,11 @@ void ProcessBL::BoundaryLayer2D()
             LibUtilities::eBoundaryLayerPointsRev;
 
 
-        if(ratioIsString) // determine value of r base on geom
+        if (hartmann)
+        {
+            r = haRatio[el[i]->GetId()];
+        }
+        else if(ratioIsString) // determine value of r base on geom
         {
             NekDouble x,y,z;
             NekDouble x1,y1,z1;
@@ -608,6 +884,8 @@ void ProcessBL::BoundaryLayer3D()
         ratioIsString    = true;
     }
 
+    bool hartmann = m_config["hartmann"].as<NekDouble>() > 0.0;
+
     // Prismatic node -> face map.
     int prismFaceNodes[5][4] = {
         {0, 1, 2, 3}, {0, 1, 4, -1}, {1, 2, 5, 4}, {3, 2, 5, -1}, {0, 3, 5, 4}};
@@ -628,98 +906,6 @@ void ProcessBL::BoundaryLayer3D()
     // splitting to occur in either y-direction of the prism.
     std::unordered_map<int, int> splitEls;
 
-    // Set up maps which takes an edge (in nektar++ ordering) and return
-    // their offset and stride in the 3d array of collapsed quadrature
-    // points. Note that this map includes only the edges that are on
-    // the triangular faces as the edges in the normal direction are
-    // linear.
-    map<LibUtilities::ShapeType, map<int, SplitMapHelper> > splitMap;
-    int po = nq * (nl + 1);
-
-    SplitMapHelper splitPrism;
-    int splitMapEdgePrism[6]    = {0, 2, 4, 5, 6, 7};
-    int splitMapOffsetPrism[6]  = {0, nq, 0, nq - 1, nq + nq - 1, nq};
-    int splitMapIncPrism[6]     = {1, 1, po, po, po, po};
-    int splitMapBFacesPrism[3]  = {0, 2, 4};
-    int splitMapConnPrism[6][2] = {
-        {0, 0}, {1, 0}, {1, 1}, {0, 1}, {2, 0}, {2, 1}};
-    splitPrism.size                   = 6;
-    splitPrism.layerOff               = nq;
-    splitPrism.edge                   = splitMapEdgePrism;
-    splitPrism.offset                 = splitMapOffsetPrism;
-    splitPrism.inc                    = splitMapIncPrism;
-    splitPrism.conn                   = helper2d(6, splitMapConnPrism);
-    splitPrism.bfacesSize             = 3;
-    splitPrism.bfaces                 = splitMapBFacesPrism;
-    splitMap[LibUtilities::ePrism][1] = splitPrism;
-    splitMap[LibUtilities::ePrism][3] = splitPrism;
-
-    int ho = nq * (nq - 1);
-    int tl = nq * nq;
-    SplitMapHelper splitHex0;
-    int splitMapEdgeHex0[8]   = {0, 1, 2, 3, 8, 9, 10, 11};
-    int splitMapOffsetHex0[8] = {
-        0, nq - 1, tl - 1, ho, tl, tl + nq - 1, 2 * tl - 1, tl + ho};
-    int splitMapIncHex0[8]     = {1, nq, -1, -nq, 1, nq, -1, -nq};
-    int splitMapBFacesHex0[4]  = {1, 2, 3, 4};
-    int splitMapConnHex0[8][2] = {
-        {0, 0}, {1, 0}, {2, 0}, {3, 0}, {0, 1}, {1, 1}, {2, 1}, {3, 1}};
-    splitHex0.size                         = 8;
-    splitHex0.layerOff                     = nq * nq;
-    splitHex0.edge                         = splitMapEdgeHex0;
-    splitHex0.offset                       = splitMapOffsetHex0;
-    splitHex0.inc                          = splitMapIncHex0;
-    splitHex0.conn                         = helper2d(8, splitMapConnHex0);
-    splitHex0.bfacesSize                   = 4;
-    splitHex0.bfaces                       = splitMapBFacesHex0;
-    splitMap[LibUtilities::eHexahedron][0] = splitHex0;
-    splitMap[LibUtilities::eHexahedron][5] = splitHex0;
-
-    // splitEdge enumerates the edges in the standard prism along which
-    // new nodes should be generated. These edges are the three between
-    // the two triangular faces.
-    //
-    // edgeVertMap specifies the vertices which comprise those edges in
-    // splitEdge; for example splitEdge[0] = 3 which connects vertices 0
-    // and 3.
-    //
-    // edgeOffset holds the offset of each of edges 3, 1 and 8
-    // respectively inside the collapsed coordinate system.
-    map<LibUtilities::ShapeType, map<int, SplitEdgeHelper> > splitEdge;
-
-    int splitPrismEdges[3]       = {3, 1, 8};
-    int splitPrismEdgeVert[3][2] = {{0, 3}, {1, 2}, {4, 5}};
-    int splitPrismOffset[3]      = {0, nq - 1, nq * (nl + 1) * (nq - 1)};
-    int splitPrismInc[3]         = {nq, nq, nq};
-    SplitEdgeHelper splitPrismEdge;
-    splitPrismEdge.size                = 3;
-    splitPrismEdge.edge                = splitPrismEdges;
-    splitPrismEdge.edgeVert            = helper2d(3, splitPrismEdgeVert);
-    splitPrismEdge.offset              = splitPrismOffset;
-    splitPrismEdge.inc                 = splitPrismInc;
-    splitEdge[LibUtilities::ePrism][1] = splitPrismEdge;
-    splitEdge[LibUtilities::ePrism][3] = splitPrismEdge;
-
-    int splitHex0Edges[4]       = {4, 5, 6, 7};
-    int splitHex0EdgeVert[4][2] = {{0, 4}, {1, 5}, {2, 6}, {3, 7}};
-    int splitHex0Offset[4]      = {0, nq - 1, nq * nq - 1, nq * (nq - 1)};
-    int splitHex0Inc[4]         = {nq * nq, nq * nq, nq * nq, nq * nq};
-    SplitEdgeHelper splitHex0Edge;
-    splitHex0Edge.size                      = 4;
-    splitHex0Edge.edge                      = splitHex0Edges;
-    splitHex0Edge.edgeVert                  = helper2d(4, splitHex0EdgeVert);
-    splitHex0Edge.offset                    = splitHex0Offset;
-    splitHex0Edge.inc                       = splitHex0Inc;
-    splitEdge[LibUtilities::eHexahedron][0] = splitHex0Edge;
-    splitEdge[LibUtilities::eHexahedron][5] = splitHex0Edge;
-
-    map<LibUtilities::ShapeType, map<int, bool> > revPoints;
-    revPoints[LibUtilities::ePrism][1] = true;
-    revPoints[LibUtilities::ePrism][3] = false;
-
-    revPoints[LibUtilities::eHexahedron][0] = true;
-    revPoints[LibUtilities::eHexahedron][5] = false;
-
     // edgeMap associates geometry edge IDs to the (nl+1) vertices which
     // are generated along that edge when a prism is split, and is used
     // to avoid generation of duplicate vertices. It is stored as an
@@ -840,6 +1026,108 @@ void ProcessBL::BoundaryLayer3D()
             el[i]->GetGeom(m_mesh->m_spaceDim));
     }
 
+    // If a Hartmann number is given, size the layers to resolve the
+    // Hartmann layers. This must happen before the split maps below are
+    // constructed, since they depend on the number of layers.
+    map<int, NekDouble> haRatio;
+    if (hartmann)
+    {
+        nl = HartmannLayers(
+            el, map<int, int>(splitEls.begin(), splitEls.end()), haRatio);
+    }
+
+    // Set up maps which takes an edge (in nektar++ ordering) and return
+    // their offset and stride in the 3d array of collapsed quadrature
+    // points. Note that this map includes only the edges that are on
+    // the triangular faces as the edges in the normal direction are
+    // linear.
+    map<LibUtilities::ShapeType, map<int, SplitMapHelper> > splitMap;
+    int po = nq * (nl + 1);
+
+    SplitMapHelper splitPrism;
+    int splitMapEdgePrism[6]    = {0, 2, 4, 5, 6, 7};
+    int splitMapOffsetPrism[6]  = {0, nq, 0, nq - 1, nq + nq - 1, nq};
+    int splitMapIncPrism[6]     = {1, 1, po, po, po, po};
+    int splitMapBFacesPrism[3]  = {0, 2, 4};
+    int splitMapConnPrism[6][2] = {
+        {0, 0}, {1, 0}, {1, 1}, {0, 1}, {2, 0}, {2, 1}};
+    splitPrism.size                   = 6;
+    splitPrism.layerOff               = nq;
+    splitPrism.edge                   = splitMapEdgePrism;
+    splitPrism.offset                 = splitMapOffsetPrism;
+    splitPrism.inc                    = splitMapIncPrism;
+    splitPrism.conn                   = helper2d(6, splitMapConnPrism);
+    splitPrism.bfacesSize             = 3;
+    splitPrism.bfaces                 = splitMapBFacesPrism;
+    splitMap[LibUtilities::ePrism][1] = splitPrism;
+    splitMap[LibUtilities::ePrism][3] = splitPrism;
+
+    int ho = nq * (nq - 1);
+    int tl = nq * nq;
+    SplitMapHelper splitHex0;
+    int splitMapEdgeHex0[8]   = {0, 1, 2, 3, 8, 9, 10, 11};
+    int splitMapOffsetHex0[8] = {
+        0, nq - 1, tl - 1, ho, tl, tl + nq - 1, 2 * tl - 1, tl + ho};
+    int splitMapIncHex0[8]     = {1, nq, -1, -nq, 1, nq, -1, -nq};
+    int splitMapBFacesHex0[4]  = {1, 2, 3, 4};
+    int splitMapConnHex0[8][2] = {
+        {0, 0}, {1, 0}, {2, 0}, {3, 0}, {0, 1}, {1, 1}, {2, 1}, {3, 1}};
+    splitHex0.size                         = 8;
+    splitHex0.layerOff                     = nq * nq;
+    splitHex0.edge                         = splitMapEdgeHex0;
+    splitHex0.offset                       = splitMapOffsetHex0;
+    splitHex0.inc                          = splitMapIncHex0;
+    splitHex0.conn                         = helper2d(8, splitMapConnHex0);
+    splitHex0.bfacesSize                   = 4;
+    splitHex0.bfaces                       = splitMapBFacesHex0;
+    splitMap[LibUtilities::eHexahedron][0] = splitHex0;
+    splitMap[LibUtilities::eHexahedron][5] = splitHex0;
+
+    // splitEdge enumerates the edges in the standard prism along which
+    // new nodes should be generated. These edges are the three between
+    // the two triangular faces.
+    //
+    // edgeVertMap specifies the vertices which comprise those edges in
+    // splitEdge; for example splitEdge[0] = 3 which connects vertices 0
+    // and 3.
+    //
+    // edgeOffset holds the offset of each of edges 3, 1 and 8
+    // respectively inside the collapsed coordinate system.
+    map<LibUtilities::ShapeType, map<int, SplitEdgeHelper> > splitEdge;
+
+    int splitPrismEdges[3]       = {3, 1, 8};
+    int splitPrismEdgeVert[3][2] = {{0, 3}, {1, 2}, {4, 5}};
+    int splitPrismOffset[3]      = {0, nq - 1, nq * (nl + 1) * (nq - 1)};
+    int splitPrismInc[3]         = {nq, nq, nq};
+    SplitEdgeHelper splitPrismEdge;
+    splitPrismEdge.size                = 3;
+    splitPrismEdge.edge                = splitPrismEdges;
+    splitPrismEdge.edgeVert            = helper2d(3, splitPrismEdgeVert);
+    splitPrismEdge.offset              = splitPrismOffset;
+    splitPrismEdge.inc                 = splitPrismInc;
+    splitEdge[LibUtilities::ePrism][1] = splitPrismEdge;
+    splitEdge[LibUtilities::ePrism][3] = splitPrismEdge;
+
+    int splitHex0Edges[4]       = {4, 5, 6, 7};
+    int splitHex0EdgeVert[4][2] = {{0, 4}, {1, 5}, {2, 6}, {3, 7}};
+    int splitHex0Offset[4]      = {0, nq - 1, nq * nq - 1, nq * (nq - 1)};
+    int splitHex0Inc[4]         = {nq * nq, nq * nq, nq * nq, nq * nq};
+    SplitEdgeHelper splitHex0Edge;
+    splitHex0Edge.size                      = 4;
+    splitHex0Edge.edge                      = splitHex0Edges;
+    splitHex0Edge.edgeVert                  = helper2d(4, splitHex0EdgeVert);
+    splitHex0Edge.offset                    = splitHex0Offset;
+    splitHex0Edge.inc                       = splitHex0Inc;
+    splitEdge[LibUtilities::eHexahedron][0] = splitHex0Edge;
+    splitEdge[LibUtilities::eHexahedron][5] = splitHex0Edge;
+
+    map<LibUtilities::ShapeType, map<int, bool> > revPoints;
+    revPoints[LibUtilities::ePrism][1] = true;
+    revPoints[LibUtilities::ePrism][3] = false;
+
+    revPoints[LibUtilities::eHexahedron][0] = true;
+    revPoints[LibUtilities::eHexahedron][5] = false;
+
     // Iterate over list of elements of expansion dimension.
     for (int i = 0; i < el.size(); ++i)
     {
@@ -877,7 +1165,11 @@ void ProcessBL::BoundaryLayer3D()
                                        : LibUtilities::eBoundaryLayerPointsRev;
 
         // Determine value of r based on geometry.
-        if (ratioIsString)
+        if (hartmann)
+        {
+            r = haRatio[elId];
+        }
+        else if (ratioIsString)
         {
             NekDouble x, y, z;
             NekDouble x1, y1, z1;
@@ -65,6 +65,10 @@ public:
     void BoundaryLayer2D();
     // Create the boundary layer in 3D
     void BoundaryLayer3D();
+    // Determine the layers needed to resolve Hartmann layers
+    int HartmannLayers(const std::vector<NekMeshUtils::ElementSharedPtr> &el,
+                       const std::map<int, int> &splitEls,
+                       std::map<int, NekDouble> &ratio);
     /// Write mesh to output file.
     virtual void Process();
 };
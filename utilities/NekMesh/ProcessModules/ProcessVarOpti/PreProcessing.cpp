@@ -620,6 +620,32 @@ vector<ElUtilSharedPtr> ProcessVarOpti::GetLockedElements(NekDouble thres)
     return ret;
 }
 
+vector<ElUtilSharedPtr> ProcessVarOpti::GetAnisotropicElements(
+    NekDouble thres)
+{
+    vector<ElUtilSharedPtr> ret;
+    for (int i = 0; i < m_dataSet.size(); ++i)
+    {
+        vector<EdgeSharedPtr> e = m_dataSet[i]->GetEl()->GetEdgeList();
+
+        NekDouble lmin = numeric_limits<NekDouble>::max();
+        NekDouble lmax = 0.0;
+        for (int j = 0; j < e.size(); ++j)
+        {
+            NekDouble l = e[j]->m_n1->Distance(e[j]->m_n2);
+            lmin = min(lmin, l);
+            lmax = max(lmax, l);
+        }
+
+        if (lmax > thres * lmin)
+        {
+            ret.push_back(m_dataSet[i]);
+        }
+    }
+
+    return ret;
+}
+
 void ProcessVarOpti::RemoveLinearCurvature()
 {
     for(int i = 0; i < m_dataSet.size(); i++)
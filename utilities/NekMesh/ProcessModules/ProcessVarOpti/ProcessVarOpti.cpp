@@ -98,6 +98,8 @@ ProcessVarOpti::ProcessVarOpti(MeshSharedPtr m) : ProcessModule(m)
         ConfigOption(false, "6", "over integration order");
     m_config["analytics"] =
         ConfigOption(false, "", "basic analytics module");
+    m_config["aniso"] =
+        ConfigOption(false, "0.0", "lock elements above this aspect ratio");
     // clang-format on
 }
 
@@ -209,6 +211,17 @@ void ProcessVarOpti::Process()
         elLock = GetLockedElements(m_config["region"].as<NekDouble>());
     }
 
+    // Thin boundary layer elements, e.g. those sized by the bl module to
+    // resolve Hartmann layers, are already valid by construction and far
+    // more numerous than the elements away from the wall, so leave them
+    // untouched if requested.
+    if (m_config["aniso"].beenSet)
+    {
+        vector<ElUtilSharedPtr> elAniso =
+            GetAnisotropicElements(m_config["aniso"].as<NekDouble>());
+        elLock.insert(elLock.end(), elAniso.begin(), elAniso.end());
+    }
+
     
     vector<vector<NodeSharedPtr> > freenodes = GetColouredNodes(elLock);
     vector<vector<NodeOptiSharedPtr> > optiNodes;
@@ -103,6 +103,7 @@ private:
     void GetElementMap(
         int o, std::map<LibUtilities::ShapeType, DerivUtilSharedPtr> derMap);
     std::vector<ElUtilSharedPtr> GetLockedElements(NekDouble thres);
+    std::vector<ElUtilSharedPtr> GetAnisotropicElements(NekDouble thres);
     std::vector<std::vector<NodeSharedPtr> > CreateColoursets(
         std::vector<NodeSharedPtr> remain);
     std::vector<std::vector<NodeSharedPtr> > GetColouredNodes(
@@ -0,0 +1,38 @@
+<?xml version="1.0" encoding="utf-8" ?>
+<test>
+    <description>Test BL refinement sized from the Hartmann number in 2D</description>
+    <executable>NekMesh</executable>
+    <parameters>-v -m bl:surf=1:hartmann=100:bdir=0,1,0:hlayers=2:rmax=1.5 bl_hartmann.xml bl_hartmann-out.xml:xml:uncompress:test</parameters>
+    <files>
+        <file description="Input File">bl_hartmann.xml</file>
+    </files>
+    <metrics>
+        <metric type="regex" id="1">
+            <regex>^\s*Hartmann number 100: (\d+) layers, ratio between (\S+) and (\S+)</regex>
+            <matches>
+                <match>
+                    <field id="0">12</field>
+                    <field id="1" tolerance="1e-5">1.45858</field>
+                    <field id="2" tolerance="1e-5">1.45858</field>
+                </match>
+            </matches>
+        </metric>
+        <metric type="regex" id="2" file="bl_hartmann-out.xml">
+            <regex>^\s*&lt;V ID="\d+"&gt;\S+ (\S+e-03) \S+&lt;/V&gt;</regex>
+            <matches>
+                <match>
+                    <field id="0" tolerance="1e-8">5.0e-03</field>
+                </match>
+                <match>
+                    <field id="0" tolerance="1e-8">5.0e-03</field>
+                </match>
+                <match>
+                    <field id="0" tolerance="1e-8">4.0e-03</field>
+                </match>
+                <match>
+                    <field id="0" tolerance="1e-8">9.83430731e-03</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
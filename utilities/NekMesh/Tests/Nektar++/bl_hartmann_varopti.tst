@@ -0,0 +1,19 @@
+<?xml version="1.0" encoding="utf-8" ?>
+<test>
+    <description>Test variational optimiser locking the Hartmann boundary layers</description>
+    <executable>NekMesh</executable>
+    <parameters>-v -m bl:surf=1:hartmann=100:hlayers=2:rmax=1.5 -m varopti:linearelastic:aniso=10:maxiter=5 bl_hartmann.xml bl_hartmann_varopti-out.xml:xml:test</parameters>
+    <files>
+        <file description="Input File">bl_hartmann.xml</file>
+    </files>
+    <metrics>
+        <metric type="regex" id="1">
+            <regex>^N elements:\s+(\d+)</regex>
+            <matches>
+                <match>
+                    <field id="0">10</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>